@@ -26,6 +26,20 @@
 #include "StringGenerator.h"
 
 #include "../vectorset.h"
+#include "../buffered_vectorset.h"
+#include "../pma_vectorset.h"
+#include "../tiered_vector.h"
+#include "../small_vector.h"
+#include "../compact_vector.h"
+#include "../logarithmic_vectorset.h"
+#include "../vectorset_algo.h"
+#include "../vectorset_parallel.h"
+#include "../vectorset_view.h"
+#include "../vectorset_array.h"
+#include "../frozen_vectorset.h"
+#include "../roaring_vectorset.h"
+#include "../string_vectorset.h"
+#include "../vectormap.h"
 
 #include <iostream>
 #include <vector>
@@ -33,6 +47,11 @@
 #include <unordered_set>
 #include <string>
 #include <chrono>
+#include <random>
+#include <iterator>
+#include <numeric>
+#include <array>
+#include <memory_resource>
 
 using namespace std;
 
@@ -66,6 +85,11 @@ getRandomVal() {
 static set<string> setData;
 static unordered_set<string> unorderedSetData;
 static vectorset<string> vectorSetData;
+static buffered_vectorset<string> bufferedVectorSetData;
+static pma_vectorset<string> pmaVectorSetData;
+static tiered_vectorset<string> tieredVectorSetData;
+static logarithmic_vectorset<string> logVectorSetData;
+static string_vectorset stringVectorSetData;
 static StringGenerator gen;
 
 
@@ -176,6 +200,74 @@ teardownVectorSet(const benchmark::State& state) {
 }
 
 
+void
+setupStringVectorSet(const benchmark::State& state) {
+    setupData(state);
+    stringVectorSetData = string_vectorset(firstData, lastData);
+    stringVectorSetData.set_mode(vectorset_mode::unique_ordered);
+}
+
+void
+teardownStringVectorSet(const benchmark::State& state) {
+    stringVectorSetData.clear();
+    teardownData(state);
+}
+
+
+void
+setupBufferedVectorSet(const benchmark::State& state) {
+    setupData(state);
+    bufferedVectorSetData =
+        buffered_vectorset<string>(firstData, lastData);
+}
+
+void
+teardownBufferedVectorSet(const benchmark::State& state) {
+    bufferedVectorSetData.clear();
+    teardownData(state);
+}
+
+
+void
+setupPmaVectorSet(const benchmark::State& state) {
+    setupData(state);
+    pmaVectorSetData = pma_vectorset<string>(firstData, lastData);
+}
+
+void
+teardownPmaVectorSet(const benchmark::State& state) {
+    pmaVectorSetData.clear();
+    teardownData(state);
+}
+
+
+void
+setupTieredVectorSet(const benchmark::State& state) {
+    setupData(state);
+    tieredVectorSetData = tiered_vectorset<string>(firstData, lastData);
+    tieredVectorSetData.set_mode(vectorset_mode::unique_ordered);
+}
+
+void
+teardownTieredVectorSet(const benchmark::State& state) {
+    tieredVectorSetData.clear();
+    teardownData(state);
+}
+
+
+void
+setupLogVectorSet(const benchmark::State& state) {
+    setupData(state);
+    logVectorSetData = logarithmic_vectorset<string>(firstData, lastData);
+}
+
+void
+teardownLogVectorSet(const benchmark::State& state) {
+    logVectorSetData.clear();
+    teardownData(state);
+}
+
+
 
 static void
 construct_set(benchmark::State& state) {
@@ -212,6 +304,15 @@ construct_vectorset_unique_ordered(benchmark::State& state) {
     }
 }
 
+static void
+construct_string_vectorset_unique_ordered(benchmark::State& state) {
+    for (auto _ : state) {
+        string_vectorset test(firstData, lastData);
+        test.set_mode(vectorset_mode::unique_ordered);
+        benchmark::DoNotOptimize(test);
+    }
+}
+
 BENCHMARK(construct_vectorset_unordered)
 ->Setup(setupData)
 ->Teardown(teardownData)
@@ -226,6 +327,13 @@ BENCHMARK(construct_vectorset_unique_ordered)
         {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
         {1<<8}});
 
+BENCHMARK(construct_string_vectorset_unique_ordered)
+->Setup(setupData)
+->Teardown(teardownData)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
 BENCHMARK(construct_set)
 ->Setup(setupData)
 ->Teardown(teardownData)
@@ -322,6 +430,15 @@ find_vectorset_ordered(benchmark::State& state) {
 }
 
 
+static void
+find_string_vectorset(benchmark::State& state) {
+    for (auto _ : state) {
+        auto strIter = stringVectorSetData.find(getRandomVal());
+        benchmark::DoNotOptimize(strIter);
+    }
+}
+
+
 BENCHMARK(find_vectorset_ordered)
 ->Setup(setupVectorSet)
 ->Teardown(teardownVectorSet)
@@ -329,6 +446,13 @@ BENCHMARK(find_vectorset_ordered)
         {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
         {1<<8}});
 
+BENCHMARK(find_string_vectorset)
+->Setup(setupStringVectorSet)
+->Teardown(teardownStringVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
 BENCHMARK(find_set)
 ->Setup(setupSet)
 ->Teardown(teardownSet)
@@ -371,6 +495,644 @@ insert_erase_vectorset_ordered(benchmark::State& state) {
 }
 
 
+static void
+insert_range_vectorset_ordered(benchmark::State& state) {
+    TextData batch;
+
+    for (auto _ : state) {
+        batch.clear();
+        for (size_t idx = 0; idx < 64; ++idx) {
+            batch.push_back(getRandomVal());
+        }
+
+        vectorSetData.insert(batch.begin(), batch.end());
+
+        state.PauseTiming();
+        for (const auto &value : batch) {
+            vectorSetData.erase(value);
+        }
+        state.ResumeTiming();
+    }
+}
+
+
+static void
+insert_range_vectorset_ordered_scratch(benchmark::State& state) {
+    TextData batch;
+    std::array<std::byte, 1<<14> buffer;
+    std::pmr::monotonic_buffer_resource scratch(
+        buffer.data(), buffer.size());
+
+    for (auto _ : state) {
+        batch.clear();
+        for (size_t idx = 0; idx < 64; ++idx) {
+            batch.push_back(getRandomVal());
+        }
+
+        vectorSetData.insert(batch.begin(), batch.end(), &scratch);
+        scratch.release();
+
+        state.PauseTiming();
+        for (const auto &value : batch) {
+            vectorSetData.erase(value);
+        }
+        state.ResumeTiming();
+    }
+}
+
+
+static void
+erase_many_vectorset_ordered(benchmark::State& state) {
+    TextData batch;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        batch.clear();
+        for (size_t idx = 0; idx < 64; ++idx) {
+            batch.push_back(getRandomVal());
+        }
+
+        vectorSetData.insert(batch.begin(), batch.end());
+        state.ResumeTiming();
+
+        vectorSetData.erase_many(batch.begin(), batch.end());
+    }
+}
+
+
+
+template<class T = int>
+static vectorset<T>
+makeIntSet(size_t count, unsigned seed) {
+    mt19937 rnd(seed);
+    uniform_int_distribution<T> dist(0, 1<<24);
+    vector<T> data;
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        data.push_back(dist(rnd));
+    }
+
+    vectorset<T> result;
+    result.set_mode(vectorset_mode::unique_ordered);
+    result.insert(data.begin(), data.end());
+
+    return result;
+}
+
+
+static void
+intersection_std_algorithm(benchmark::State& state) {
+    auto large = makeIntSet(state.range(0), 1);
+    auto small = makeIntSet(state.range(1), 2);
+
+    for (auto _ : state) {
+        vector<int> result;
+        std::set_intersection(
+            large.begin(), large.end(), small.begin(), small.end(),
+            back_inserter(result));
+        benchmark::DoNotOptimize(result.data());
+    }
+}
+
+
+static void
+intersection_vectorset(benchmark::State& state) {
+    auto large = makeIntSet(state.range(0), 1);
+    auto small = makeIntSet(state.range(1), 2);
+
+    for (auto _ : state) {
+        auto result = set_intersection(large, small);
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+intersection_size_std_algorithm(benchmark::State& state) {
+    auto large = makeIntSet<uint32_t>(state.range(0), 1);
+    auto small = makeIntSet<uint32_t>(state.range(1), 2);
+
+    for (auto _ : state) {
+        vector<uint32_t> result;
+        std::set_intersection(
+            large.begin(), large.end(), small.begin(), small.end(),
+            back_inserter(result));
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+intersection_size_vectorset(benchmark::State& state) {
+    auto large = makeIntSet<uint32_t>(state.range(0), 1);
+    auto small = makeIntSet<uint32_t>(state.range(1), 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(intersection_size(large, small));
+    }
+}
+
+
+static void
+difference_parallel_vectorset(benchmark::State& state) {
+    auto lhs = makeIntSet(state.range(0), 1);
+    auto rhs = makeIntSet(state.range(0), 2);
+
+    for (auto _ : state) {
+        auto result = parallel_set_difference(lhs, rhs, state.range(1));
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+intersection_top_vectorset(benchmark::State& state) {
+    auto lhs = makeIntSet(state.range(0), 1);
+    auto rhs = makeIntSet(state.range(0), 2);
+
+    for (auto _ : state) {
+        auto result = set_intersection(lhs, rhs);
+        auto last = result.begin() + std::min<size_t>(result.size(), 10);
+        benchmark::DoNotOptimize(
+            std::accumulate(result.begin(), last, 0));
+    }
+}
+
+
+static void
+intersection_top_view(benchmark::State& state) {
+    auto lhs = makeIntSet(state.range(0), 1);
+    auto rhs = makeIntSet(state.range(0), 2);
+
+    for (auto _ : state) {
+        auto view = make_intersection_view(lhs, rhs);
+        int sum = 0;
+        int count = 0;
+
+        for (auto iter = view.begin(); iter != view.end() && count < 10;
+             ++iter, ++count)
+        {
+            sum += *iter;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+
+static void
+intersection_many_pairwise(benchmark::State& state) {
+    vector<vectorset<int>> sets;
+
+    for (int idx = 0; idx < state.range(1); ++idx) {
+        sets.push_back(makeIntSet(state.range(0) << idx % 4, idx + 1));
+    }
+
+    for (auto _ : state) {
+        auto result = sets.front();
+
+        for (size_t idx = 1; idx < sets.size(); ++idx) {
+            result = set_intersection(result, sets[idx]);
+        }
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+intersection_many_vectorset(benchmark::State& state) {
+    vector<vectorset<int>> sets;
+    vector<const vectorset<int>*> setPtrs;
+
+    for (int idx = 0; idx < state.range(1); ++idx) {
+        sets.push_back(makeIntSet(state.range(0) << idx % 4, idx + 1));
+    }
+    for (const auto &set : sets) {
+        setPtrs.push_back(&set);
+    }
+
+    for (auto _ : state) {
+        auto result = set_intersection(setPtrs);
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+union_many_pairwise(benchmark::State& state) {
+    vector<vectorset<int>> sets;
+
+    for (int idx = 0; idx < state.range(1); ++idx) {
+        sets.push_back(makeIntSet(state.range(0), idx + 1));
+    }
+
+    for (auto _ : state) {
+        auto result = sets.front();
+
+        for (size_t idx = 1; idx < sets.size(); ++idx) {
+            result = set_union(result, sets[idx]);
+        }
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+union_many_vectorset(benchmark::State& state) {
+    vector<vectorset<int>> sets;
+    vector<const vectorset<int>*> setPtrs;
+
+    for (int idx = 0; idx < state.range(1); ++idx) {
+        sets.push_back(makeIntSet(state.range(0), idx + 1));
+    }
+    for (const auto &set : sets) {
+        setPtrs.push_back(&set);
+    }
+
+    for (auto _ : state) {
+        auto result = set_union(setPtrs);
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+intersection_vectorset_uint32(benchmark::State& state) {
+    auto large = makeIntSet<uint32_t>(state.range(0), 1);
+    auto small = makeIntSet<uint32_t>(state.range(1), 2);
+
+    for (auto _ : state) {
+        auto result = set_intersection(large, small);
+        benchmark::DoNotOptimize(result.size());
+    }
+}
+
+
+static void
+adjacency_vectorsets(benchmark::State& state) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<uint32_t> dist(0, state.range(0) - 1);
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        vector<vectorset<uint32_t>> adjacency(state.range(0));
+
+        for (int64_t edge = 0; edge < state.range(0) * state.range(1); ++edge) {
+            adjacency[dist(gen)].push_back(dist(gen));
+        }
+        for (auto &set : adjacency) {
+            set.set_mode(vectorset_mode::unique_ordered);
+        }
+
+        bytes = adjacency.size() * sizeof(vectorset<uint32_t>);
+        for (const auto &set : adjacency) {
+            bytes += set.get_vector().capacity() * sizeof(uint32_t);
+        }
+        benchmark::DoNotOptimize(adjacency.data());
+    }
+
+    state.counters["bytes_per_set"] =
+        static_cast<double>(bytes) / state.range(0);
+}
+
+
+static void
+adjacency_vectorset_array(benchmark::State& state) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<uint32_t> dist(0, state.range(0) - 1);
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        vectorset_array<uint32_t>::builder builder(state.range(0));
+
+        builder.reserve(state.range(0) * state.range(1));
+        for (int64_t edge = 0; edge < state.range(0) * state.range(1); ++edge) {
+            builder.insert(dist(gen), dist(gen));
+        }
+
+        auto adjacency = builder.build();
+
+        bytes = (adjacency.get_offsets().capacity() * sizeof(std::size_t)
+                 + adjacency.get_keys().capacity() * sizeof(uint32_t));
+        benchmark::DoNotOptimize(adjacency.get_keys().data());
+    }
+
+    state.counters["bytes_per_set"] =
+        static_cast<double>(bytes) / state.range(0);
+}
+
+
+static void
+find_vectorset_uint64(benchmark::State& state) {
+    auto set = makeIntSet<uint64_t>(state.range(0), 1);
+    auto probes = makeIntSet<uint64_t>(1<<10, 2);
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.contains(*probe));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+
+    state.counters["bytes_per_key"] =
+        static_cast<double>(set.get_vector().capacity() * sizeof(uint64_t))
+        / set.size();
+}
+
+
+static void
+find_frozen_vectorset_uint64(benchmark::State& state) {
+    auto frozen = freeze(makeIntSet<uint64_t>(state.range(0), 1));
+    auto probes = makeIntSet<uint64_t>(1<<10, 2);
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(frozen.contains(*probe));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+
+    state.counters["bytes_per_key"] =
+        static_cast<double>(frozen.memory_bytes()) / frozen.size();
+}
+
+
+/// Mapped value of 64 bytes.
+struct Payload64 {
+    uint64_t data[8];
+};
+
+/// Compare pairs by the key only.
+struct PairKeyLess {
+    bool
+    operator()(
+        const pair<uint64_t, Payload64> &lhs,
+        const pair<uint64_t, Payload64> &rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+
+static void
+find_pair_vectorset(benchmark::State& state) {
+    auto keys = makeIntSet<uint64_t>(state.range(0), 1);
+    auto probes = makeIntSet<uint64_t>(1<<10, 2);
+    vectorset<pair<uint64_t, Payload64>, PairKeyLess> map;
+
+    map.set_mode(vectorset_mode::unique_ordered);
+    for (auto key : keys) {
+        map.insert(map.end(), {key, Payload64()});
+    }
+
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            map.contains(pair<uint64_t, Payload64>(*probe, Payload64())));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+}
+
+
+static void
+find_vectormap(benchmark::State& state) {
+    auto keys = makeIntSet<uint64_t>(state.range(0), 1);
+    auto probes = makeIntSet<uint64_t>(1<<10, 2);
+    vectormap<uint64_t, Payload64> map(
+        keys.get_vector(), vector<Payload64>(keys.size()));
+
+    map.set_mode(vectorset_mode::unique_ordered);
+
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(*probe));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+}
+
+
+/// Timestamps with duplicates (about 8 events per timestamp).
+static vector<uint64_t>
+makeTimestamps(size_t count, unsigned seed) {
+    mt19937 rnd(seed);
+    uniform_int_distribution<uint64_t> dist(0, count / 8);
+    vector<uint64_t> data;
+
+    for (size_t idx = 0; idx < count; ++idx) {
+        data.push_back(dist(rnd));
+    }
+
+    return data;
+}
+
+
+static void
+count_timestamps_vectorset_ordered(benchmark::State& state) {
+    auto stamps = makeTimestamps(state.range(0), 1);
+    auto probes = makeTimestamps(state.range(0), 2);
+    vectorset<uint64_t> set(stamps.begin(), stamps.end());
+
+    set.set_mode(vectorset_mode::ordered);
+
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.count(*probe));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+
+    state.counters["bytes_per_event"] =
+        static_cast<double>(set.get_vector().capacity() * sizeof(uint64_t))
+        / set.size();
+}
+
+
+static void
+count_timestamps_tiebreak(benchmark::State& state) {
+    using Entry = std::pair<uint64_t, uint64_t>;
+
+    auto stamps = makeTimestamps(state.range(0), 1);
+    auto probes = makeTimestamps(state.range(0), 2);
+    vectorset<Entry> set;
+
+    // unique keys by a sequence number as tie-breaker
+    for (size_t idx = 0; idx < stamps.size(); ++idx) {
+        set.push_back(Entry(stamps[idx], idx));
+    }
+    set.set_mode(vectorset_mode::unique_ordered);
+
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::distance(
+                set.lower_bound(Entry(*probe, 0)),
+                set.lower_bound(Entry(*probe + 1, 0))));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+
+    state.counters["bytes_per_event"] =
+        static_cast<double>(set.get_vector().capacity() * sizeof(Entry))
+        / set.size();
+}
+
+
+static void
+count_timestamps_multiset(benchmark::State& state) {
+    auto stamps = makeTimestamps(state.range(0), 1);
+    auto probes = makeTimestamps(state.range(0), 2);
+    multiset<uint64_t> set(stamps.begin(), stamps.end());
+
+    auto probe = probes.begin();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.count(*probe));
+        if (++probe == probes.end()) {
+            probe = probes.begin();
+        }
+    }
+}
+
+
+static vector<uint32_t>
+makeMixedIds(size_t ranges, unsigned seed) {
+    mt19937 rnd(seed);
+    uniform_int_distribution<uint32_t> dist(0, 1<<26);
+    vector<uint32_t> data;
+
+    // dense ranges with sparse outliers
+    for (size_t range = 0; range < ranges; ++range) {
+        auto first = dist(rnd);
+
+        for (uint32_t id = first; id < first + 50000; ++id) {
+            data.push_back(id);
+            if (id % 64 == 0) {
+                data.push_back(dist(rnd));
+            }
+        }
+    }
+
+    return data;
+}
+
+
+static void
+intersection_mixed_vectorset(benchmark::State& state) {
+    auto lhsIds = makeMixedIds(state.range(0), 1);
+    auto rhsIds = makeMixedIds(state.range(0), 2);
+    vectorset<uint32_t> lhs(lhsIds.begin(), lhsIds.end());
+    vectorset<uint32_t> rhs(rhsIds.begin(), rhsIds.end());
+
+    lhs.set_mode(vectorset_mode::unique_ordered);
+    rhs.set_mode(vectorset_mode::unique_ordered);
+
+    for (auto _ : state) {
+        auto result = set_intersection(lhs, rhs);
+        benchmark::DoNotOptimize(result.size());
+    }
+
+    state.counters["bytes_per_key"] =
+        static_cast<double>(lhs.get_vector().capacity() * sizeof(uint32_t))
+        / lhs.size();
+}
+
+
+static void
+intersection_mixed_roaring_vectorset(benchmark::State& state) {
+    auto lhsIds = makeMixedIds(state.range(0), 1);
+    auto rhsIds = makeMixedIds(state.range(0), 2);
+    roaring_vectorset lhs(lhsIds.begin(), lhsIds.end());
+    roaring_vectorset rhs(rhsIds.begin(), rhsIds.end());
+
+    for (auto _ : state) {
+        auto result = set_intersection(lhs, rhs);
+        benchmark::DoNotOptimize(result.size());
+    }
+
+    state.counters["bytes_per_key"] =
+        static_cast<double>(lhs.memory_bytes()) / lhs.size();
+}
+
+
+template<class Set>
+static void
+memory_small_sets(benchmark::State& state) {
+    std::size_t bytes = 0;
+
+    for (auto _ : state) {
+        vector<Set> sets(state.range(0));
+
+        for (std::size_t idx = 0; idx < sets.size(); ++idx) {
+            auto &set = sets[idx];
+
+            set.set_mode(vectorset_mode::unique_ordered);
+            for (int val = 0; val < state.range(1); ++val) {
+                set.insert(static_cast<int>(idx) + val);
+            }
+        }
+
+        bytes = sets.size() * sizeof(Set);
+        for (const auto &set : sets) {
+            bytes += set.get_vector().capacity() * sizeof(int);
+        }
+        benchmark::DoNotOptimize(sets.data());
+    }
+
+    state.counters["header_bytes"] = sizeof(Set);
+    state.counters["bytes_per_set"] =
+        static_cast<double>(bytes) / state.range(0);
+    state.counters["total_MiB"] = static_cast<double>(bytes) / (1 << 20);
+}
+
+
+static void
+insert_erase_buffered_vectorset(benchmark::State& state) {
+    for (auto _ : state) {
+        bufferedVectorSetData.insert(getRandomVal());
+        bufferedVectorSetData.erase(getRandomVal());
+    }
+}
+
+
+static void
+insert_erase_pma_vectorset(benchmark::State& state) {
+    for (auto _ : state) {
+        pmaVectorSetData.insert(getRandomVal());
+        pmaVectorSetData.erase(getRandomVal());
+    }
+}
+
+
+static void
+insert_erase_tiered_vectorset(benchmark::State& state) {
+    for (auto _ : state) {
+        tieredVectorSetData.insert(getRandomVal());
+        tieredVectorSetData.erase(getRandomVal());
+    }
+}
+
+
+static void
+insert_find_logarithmic_vectorset(benchmark::State& state) {
+    for (auto _ : state) {
+        logVectorSetData.insert(getRandomVal());
+        auto test = logVectorSetData.contains(getRandomVal());
+        benchmark::DoNotOptimize(test);
+    }
+}
+
+
 BENCHMARK(insert_erase_vectorset_ordered)
 ->Setup(setupVectorSet)
 ->Teardown(teardownVectorSet)
@@ -378,6 +1140,171 @@ BENCHMARK(insert_erase_vectorset_ordered)
         {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
         {1<<8}});
 
+BENCHMARK(insert_range_vectorset_ordered)
+->Setup(setupVectorSet)
+->Teardown(teardownVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16},
+        {1<<8}});
+
+BENCHMARK(insert_range_vectorset_ordered_scratch)
+->Setup(setupVectorSet)
+->Teardown(teardownVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16},
+        {1<<8}});
+
+BENCHMARK(erase_many_vectorset_ordered)
+->Setup(setupVectorSet)
+->Teardown(teardownVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16},
+        {1<<8}});
+
+BENCHMARK(intersection_std_algorithm)
+->ArgsProduct({
+        {1<<16, 1<<20},
+        {1<<4, 1<<10, 1<<16}});
+
+BENCHMARK(intersection_vectorset)
+->ArgsProduct({
+        {1<<16, 1<<20},
+        {1<<4, 1<<10, 1<<16}});
+
+BENCHMARK(intersection_size_std_algorithm)
+->ArgsProduct({
+        {1<<10, 1<<16},
+        {1<<4, 1<<10}});
+
+BENCHMARK(intersection_size_vectorset)
+->ArgsProduct({
+        {1<<10, 1<<16},
+        {1<<4, 1<<10}});
+
+BENCHMARK(difference_parallel_vectorset)
+->ArgsProduct({
+        {1<<20, 1<<22},
+        {1, 2, 4}});
+
+BENCHMARK(intersection_top_vectorset)
+->ArgsProduct({
+        {1<<16, 1<<20}});
+
+BENCHMARK(intersection_top_view)
+->ArgsProduct({
+        {1<<16, 1<<20}});
+
+BENCHMARK(intersection_many_pairwise)
+->ArgsProduct({
+        {1<<12, 1<<16},
+        {5, 20, 50}});
+
+BENCHMARK(intersection_many_vectorset)
+->ArgsProduct({
+        {1<<12, 1<<16},
+        {5, 20, 50}});
+
+BENCHMARK(union_many_pairwise)
+->ArgsProduct({
+        {1<<12, 1<<16},
+        {5, 20, 50}});
+
+BENCHMARK(union_many_vectorset)
+->ArgsProduct({
+        {1<<12, 1<<16},
+        {5, 20, 50}});
+
+BENCHMARK(intersection_vectorset_uint32)
+->ArgsProduct({
+        {1<<16, 1<<20},
+        {1<<4, 1<<10, 1<<16}});
+
+BENCHMARK(adjacency_vectorsets)
+->Unit(benchmark::kMillisecond)
+->ArgsProduct({
+        {1<<20},
+        {4, 16}});
+
+BENCHMARK(adjacency_vectorset_array)
+->Unit(benchmark::kMillisecond)
+->ArgsProduct({
+        {1<<20},
+        {4, 16}});
+
+BENCHMARK(find_vectorset_uint64)
+->Args({1<<20});
+
+BENCHMARK(find_frozen_vectorset_uint64)
+->Args({1<<20});
+
+BENCHMARK(find_pair_vectorset)
+->Args({1<<16})
+->Args({1<<20});
+
+BENCHMARK(find_vectormap)
+->Args({1<<16})
+->Args({1<<20});
+
+BENCHMARK(count_timestamps_vectorset_ordered)
+->Args({1<<16})
+->Args({1<<20});
+
+BENCHMARK(count_timestamps_tiebreak)
+->Args({1<<16})
+->Args({1<<20});
+
+BENCHMARK(count_timestamps_multiset)
+->Args({1<<16})
+->Args({1<<20});
+
+BENCHMARK(intersection_mixed_vectorset)
+->Args({16});
+
+BENCHMARK(intersection_mixed_roaring_vectorset)
+->Args({16});
+
+BENCHMARK_TEMPLATE(memory_small_sets, vectorset<int>)
+->Unit(benchmark::kMillisecond)
+->Iterations(1)
+->ArgsProduct({
+        {10000000},
+        {0, 2, 4}});
+
+BENCHMARK_TEMPLATE(memory_small_sets, compact_vectorset<int>)
+->Unit(benchmark::kMillisecond)
+->Iterations(1)
+->ArgsProduct({
+        {10000000},
+        {0, 2, 4}});
+
+BENCHMARK(insert_erase_buffered_vectorset)
+->Setup(setupBufferedVectorSet)
+->Teardown(teardownBufferedVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
+BENCHMARK(insert_erase_pma_vectorset)
+->Setup(setupPmaVectorSet)
+->Teardown(teardownPmaVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
+BENCHMARK(insert_erase_tiered_vectorset)
+->Setup(setupTieredVectorSet)
+->Teardown(teardownTieredVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
+BENCHMARK(insert_find_logarithmic_vectorset)
+->Setup(setupLogVectorSet)
+->Teardown(teardownLogVectorSet)
+->ArgsProduct({
+        {1<<4, 1<<8, 1<<12, 1<<16, 1<<20},
+        {1<<8}});
+
 BENCHMARK(insert_erase_set)
 ->Setup(setupSet)
 ->Teardown(teardownSet)
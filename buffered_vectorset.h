@@ -0,0 +1,928 @@
+//
+// Sorted vector container with write buffer.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef BUFFERED_VECTOR_SET_H
+#define BUFFERED_VECTOR_SET_H
+
+#include "vectorset.h"
+
+#include <cmath>
+#include <iterator>
+
+
+/**
+ * A write buffered set based on `std::vector` containers.
+ *
+ * The elements are kept in a sorted main vector. New elements are
+ * collected in a small sorted insertion buffer (about `sqrt(n)`
+ * elements) and erased elements of the main vector are only marked
+ * as erased (tombstones). Lookups and iteration consult both. The
+ * buffer and the tombstones are merged into the main vector, if they
+ * reach their limit.
+ *
+ * Inserts and erases are amortized sublinear, while the main
+ * vector stays contiguous. The container is always unique ordered.
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+class buffered_vectorset {
+public:
+
+    using vector_type = std::vector<Key, Allocator>;
+    using key_type = Key;
+    using value_type = Key;
+    using size_type  = typename vector_type::size_type;
+    using difference_type = typename vector_type::difference_type;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    /// Minimal size limit of insertion buffer and tombstones.
+    static constexpr size_type min_buffer_size = 16;
+
+    /**
+     * Iterator through main vector and insertion buffer.
+     *
+     * Elements of the set are constant (like `std::set`).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Key;
+        using difference_type =
+            typename buffered_vectorset::difference_type;
+        using pointer = const Key*;
+        using reference = const Key&;
+
+        const_iterator() : owner(nullptr), mainPos(0), bufPos(0) {
+            /* empty */
+        }
+
+        reference
+        operator*() const {
+            return (from_main()
+                    ? owner->mainValues[mainPos]
+                    : owner->bufValues[bufPos]);
+        }
+
+        pointer
+        operator->() const {
+            return std::addressof(**this);
+        }
+
+        const_iterator &
+        operator++() {
+            if (from_main()) {
+                mainPos = owner->skip_erased(mainPos + 1);
+            }
+            else {
+                ++bufPos;
+            }
+
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        friend bool
+        operator==(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.mainPos == rhs.mainPos && lhs.bufPos == rhs.bufPos);
+        }
+
+        friend bool
+        operator!=(const const_iterator &lhs, const const_iterator &rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class buffered_vectorset;
+
+        const_iterator(
+            const buffered_vectorset *owner,
+            size_type mainPos,
+            size_type bufPos)
+            : owner(owner), mainPos(mainPos), bufPos(bufPos)
+        { /* empty */ }
+
+        // `true`, if the current element is part of the main vector.
+        bool
+        from_main() const {
+            if (mainPos == owner->mainValues.size()) {
+                return false;
+            }
+
+            if (bufPos == owner->bufValues.size()) {
+                return true;
+            }
+
+            return owner->comp(
+                owner->mainValues[mainPos], owner->bufValues[bufPos]);
+        }
+
+        const buffered_vectorset *owner;
+        size_type mainPos;
+        size_type bufPos;
+    };
+
+    using iterator = const_iterator;
+
+
+#if _VECTOR_SET_DO_TRACE == 1
+    // Debug informations
+
+    /**
+     * get debug trace messages of class.
+     */
+    const _Vectorset_Trace &
+    getDebugTrace() const noexcept {
+        return traceElements;
+    }
+
+    /**
+     * remove all trace log elements.
+     */
+    void
+    clearDebugTrace() {
+        traceElements.clear();
+    }
+
+private:
+
+    mutable _Vectorset_Trace traceElements;
+#endif
+
+private:
+    using erased_type =
+        std::vector<
+            bool,
+            typename std::allocator_traits<Allocator>
+            ::template rebind_alloc<bool>>;
+
+    /// sorted main vector (may contain erased elements).
+    vector_type mainValues;
+
+    /// tombstones of `mainValues`.
+    erased_type erased;
+
+    /// number of tombstones set in `erased`.
+    size_type erasedCount = 0;
+
+    /// sorted insertion buffer (disjoint to `mainValues`).
+    vector_type bufValues;
+
+    /// compare method
+    Compare comp;
+
+
+    /**
+     * Equal operator based on `comp`.
+     *
+     * @param lhv Left-hand value.
+     * @param rhv Right-hand value.
+     *
+     * @return `true`, if `lhv==rhv`
+     */
+    bool
+    comp_eq(const_reference lhv, const_reference rhv) const {
+        return !(comp(lhv, rhv) || comp(rhv, lhv));
+    }
+
+    /**
+     * Skip erased elements of main vector.
+     *
+     * @param pos Start position in main vector.
+     *
+     * @return Position of first not erased element at or after `pos`.
+     */
+    size_type
+    skip_erased(size_type pos) const {
+        if (erasedCount != 0) {
+            while (pos < mainValues.size() && erased[pos]) {
+                ++pos;
+            }
+        }
+
+        return pos;
+    }
+
+    /// Maximum size of insertion buffer (about `sqrt(n)`).
+    size_type
+    buffer_limit() const {
+        auto limit =
+            static_cast<size_type>(
+                std::sqrt(static_cast<double>(mainValues.size())));
+
+        return std::max(limit, min_buffer_size);
+    }
+
+    /// Maximum number of tombstones, before the main vector is compacted.
+    size_type
+    erased_limit() const {
+        return std::max(mainValues.size() / 4, min_buffer_size);
+    }
+
+    /// Lower bound of key in main vector (position).
+    size_type
+    main_lower_bound(const Key &key) const {
+        return std::distance(
+            mainValues.begin(),
+            std::lower_bound(mainValues.begin(), mainValues.end(), key, comp));
+    }
+
+    /// Lower bound of key in insertion buffer (position).
+    size_type
+    buf_lower_bound(const Key &key) const {
+        return std::distance(
+            bufValues.begin(),
+            std::lower_bound(bufValues.begin(), bufValues.end(), key, comp));
+    }
+
+    /// Upper bound of key in main vector (position).
+    size_type
+    main_upper_bound(const Key &key) const {
+        return std::distance(
+            mainValues.begin(),
+            std::upper_bound(mainValues.begin(), mainValues.end(), key, comp));
+    }
+
+    /// Upper bound of key in insertion buffer (position).
+    size_type
+    buf_upper_bound(const Key &key) const {
+        return std::distance(
+            bufValues.begin(),
+            std::upper_bound(bufValues.begin(), bufValues.end(), key, comp));
+    }
+
+
+    /**
+     * Remove all elements marked as erased from main vector.
+     */
+    void
+    compact_erased() {
+        _VECTOR_SET_TRACE_SET_NAME("compact_erased()");
+        _VECTOR_SET_TRACE_INT("start", erasedCount);
+
+        size_type out = 0;
+        for (size_type pos = 0; pos < mainValues.size(); ++pos) {
+            if (!erased[pos]) {
+                if (out != pos) {
+                    mainValues[out] = std::move(mainValues[pos]);
+                }
+                ++out;
+            }
+        }
+
+        mainValues.erase(
+            std::next(mainValues.begin(), out), mainValues.end());
+        erased.assign(mainValues.size(), false);
+        erasedCount = 0;
+    }
+
+
+    /**
+     * Insert value into main vector or insertion buffer.
+     *
+     * @param value Value to insert.
+     *
+     * @return result pair: iterator to inserted value and flag, if
+     *         values has been inserted.
+     */
+    template<class ValType>
+    std::pair<iterator, bool>
+    impl_insert(ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_insert(ValType&&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto mainPos = main_lower_bound(value);
+
+        if (mainPos != mainValues.size()
+            && !comp(value, mainValues[mainPos]))
+        {
+            auto bufPos = buf_lower_bound(value);
+
+            if (erased[mainPos]) {
+                _VECTOR_SET_TRACE("revive-main");
+
+                mainValues[mainPos] = std::forward<ValType>(value);
+                erased[mainPos] = false;
+                --erasedCount;
+
+                return std::make_pair(iterator(this, mainPos, bufPos), true);
+            }
+
+            _VECTOR_SET_TRACE("found-main-no-insert");
+
+            return std::make_pair(iterator(this, mainPos, bufPos), false);
+        }
+
+        auto bufIter =
+            std::lower_bound(bufValues.begin(), bufValues.end(), value, comp);
+        auto nextMainPos = skip_erased(mainPos);
+
+        if (bufIter != bufValues.end() && !comp(value, *bufIter)) {
+            _VECTOR_SET_TRACE("found-buffer-no-insert");
+
+            return std::make_pair(
+                iterator(
+                    this, nextMainPos,
+                    std::distance(bufValues.begin(), bufIter)),
+                false);
+        }
+
+        if (bufValues.size() >= buffer_limit()) {
+            _VECTOR_SET_TRACE("buffer-full");
+
+            flush();
+            return impl_insert(std::forward<ValType>(value));
+        }
+
+        bufIter = bufValues.insert(bufIter, std::forward<ValType>(value));
+
+        _VECTOR_SET_TRACE("insert-buffer");
+
+        return std::make_pair(
+            iterator(
+                this, nextMainPos, std::distance(bufValues.begin(), bufIter)),
+            true);
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /**
+     * Default constructor.
+     *
+     * Constructs empty container.
+     */
+    buffered_vectorset() : comp(Compare()) {
+        /* empty */
+    }
+
+    /**
+     * Construct empty container (comparator / allocator).
+     *
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    buffered_vectorset(
+        const Compare& comp,
+        const Allocator& alloc = Allocator())
+        : mainValues(alloc)
+        , erased(alloc)
+        , bufValues(alloc)
+        , comp(comp)
+    {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    buffered_vectorset(const Allocator& alloc)
+        : buffered_vectorset(Compare(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor (comparator / allocator).
+     *
+     * The range is sorted once into the main vector.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<class InputIt>
+    buffered_vectorset(
+        InputIt first, InputIt last,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : mainValues(first, last, alloc)
+        , erased(alloc)
+        , bufValues(alloc)
+        , comp(comp)
+    {
+        std::sort(mainValues.begin(), mainValues.end(), this->comp);
+        auto rmIter =
+            std::unique(
+                mainValues.begin(), mainValues.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return this->comp_eq(lhv, rhv);
+                });
+        mainValues.erase(rmIter, mainValues.end());
+        erased.assign(mainValues.size(), false);
+    }
+
+    /**
+     * Initializer-list constructor (comparator / allocator).
+     *
+     * @param init Initializer-list to copy.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    buffered_vectorset(
+        std::initializer_list<value_type> init,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : buffered_vectorset(init.begin(), init.end(), comp, alloc)
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Miscellaneous
+
+    /// @{
+
+    /**
+     * Get allocator associated with the container.
+     *
+     * @return allocator.
+     */
+    allocator_type
+    get_allocator() const noexcept {
+        return mainValues.get_allocator();
+    }
+
+    /**
+     * Merge insertion buffer and tombstones into the main vector.
+     *
+     * Is called automatically, if the insertion buffer is full.
+     */
+    void
+    flush() {
+        _VECTOR_SET_TRACE_SET_NAME("flush()");
+        _VECTOR_SET_TRACE("start");
+
+        if (erasedCount != 0) {
+            compact_erased();
+        }
+
+        if (bufValues.empty()) {
+            _VECTOR_SET_TRACE("buffer-empty");
+            return;
+        }
+
+        _VECTOR_SET_TRACE_INT("merge", bufValues.size());
+
+        auto mainSize = mainValues.size();
+
+        mainValues.insert(
+            mainValues.end(),
+            std::make_move_iterator(bufValues.begin()),
+            std::make_move_iterator(bufValues.end()));
+        bufValues.clear();
+
+        std::inplace_merge(
+            mainValues.begin(),
+            std::next(mainValues.begin(), mainSize),
+            mainValues.end(),
+            comp);
+
+        erased.assign(mainValues.size(), false);
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    const_iterator
+    begin() const noexcept {
+        return cbegin();
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const noexcept {
+        return const_iterator(this, skip_erased(0), 0);
+    }
+
+    /// Iterator to the end.
+    const_iterator
+    end() const noexcept {
+        return cend();
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const noexcept {
+        return const_iterator(this, mainValues.size(), bufValues.size());
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return (size() == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return mainValues.size() - erasedCount + bufValues.size();
+    }
+
+    /// Maximum possible number of elements .
+    size_type
+    max_size() const noexcept {
+        return mainValues.max_size();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Clears the contents.
+     */
+    void
+    clear() noexcept {
+        mainValues.clear();
+        erased.clear();
+        erasedCount = 0;
+        bufValues.clear();
+    }
+
+    /**
+     * Inserts new element (copy), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to copy.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(const value_type& value) {
+        return impl_insert(value);
+    }
+
+    /**
+     * Inserts new element (move), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to move.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(value_type&& value) {
+        return impl_insert(std::move(value));
+    }
+
+    /**
+     * Inserts elements from range [first, last).
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            impl_insert(*first);
+        }
+    }
+
+    /**
+     * Constructs element in-place.
+     *
+     * @param args Arguments to forward to the constructor of the element.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         new element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator,bool>
+    emplace(Args&&... args) {
+        return impl_insert(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Erase element at position.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_TRACE_SET_NAME("erase(const_iterator)");
+        _VECTOR_SET_TRACE("start");
+
+        _VECTOR_SET_ASSERT(pos.owner == this && pos != end());
+
+        if (!pos.from_main()) {
+            _VECTOR_SET_TRACE("erase-buffer");
+
+            bufValues.erase(std::next(bufValues.begin(), pos.bufPos));
+            return const_iterator(this, pos.mainPos, pos.bufPos);
+        }
+
+        _VECTOR_SET_TRACE("erase-main");
+
+        erased[pos.mainPos] = true;
+        ++erasedCount;
+
+        auto next = const_iterator(this, skip_erased(pos.mainPos), pos.bufPos);
+
+        if (erasedCount > erased_limit()) {
+            auto erasedBefore =
+                std::count(
+                    erased.begin(),
+                    std::next(erased.begin(), next.mainPos),
+                    true);
+
+            compact_erased();
+            next.mainPos -= erasedBefore;
+        }
+
+        return next;
+    }
+
+    /**
+     * Erase element by key.
+     *
+     * @param key Key value of the element to remove.
+     *
+     * @return Number of elements removed (0 or 1).
+     */
+    size_type
+    erase(const Key& key) {
+        _VECTOR_SET_TRACE_SET_NAME("erase(const Key&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto mainPos = main_lower_bound(key);
+
+        if (mainPos != mainValues.size() && !comp(key, mainValues[mainPos])) {
+            if (erased[mainPos]) {
+                _VECTOR_SET_TRACE("already-erased:0");
+                return 0;
+            }
+
+            _VECTOR_SET_TRACE("erase-main:1");
+
+            erased[mainPos] = true;
+            ++erasedCount;
+
+            if (erasedCount > erased_limit()) {
+                compact_erased();
+            }
+
+            return 1;
+        }
+
+        auto bufIter =
+            std::lower_bound(bufValues.begin(), bufValues.end(), key, comp);
+
+        if (bufIter != bufValues.end() && !comp(key, *bufIter)) {
+            _VECTOR_SET_TRACE("erase-buffer:1");
+
+            bufValues.erase(bufIter);
+            return 1;
+        }
+
+        _VECTOR_SET_TRACE("not-found:0");
+
+        return 0;
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(buffered_vectorset& other) noexcept {
+        mainValues.swap(other.mainValues);
+        erased.swap(other.erased);
+        std::swap(erasedCount, other.erasedCount);
+        bufValues.swap(other.bufValues);
+        std::swap(comp, other.comp);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of elements matching specific key.
+     *
+     * @param key Key value of the elements to count.
+     *
+     * @return number of elements with key (0 or 1).
+     */
+    size_type
+    count(const Key& key) const {
+        return (contains(key) ? 1 : 0);
+    }
+
+    /**
+     * Find element matches key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return iterator to matched element or `end()`, if no matching
+     *         value is found.
+     */
+    const_iterator
+    find(const Key& key) const {
+        auto iter = lower_bound(key);
+
+        return ((iter == end() || comp(key, *iter)) ? end() : iter);
+    }
+
+    /**
+     * Checks if the container contains element with specific key.
+     *
+     * Does not create an iterator: Checks main vector (and its
+     * tombstone) and insertion buffer directly.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(const Key& key) const {
+        auto mainPos = main_lower_bound(key);
+
+        if (mainPos != mainValues.size() && !comp(key, mainValues[mainPos])) {
+            return !erased[mainPos];
+        }
+
+        return std::binary_search(
+            bufValues.begin(), bufValues.end(), key, comp);
+    }
+
+    /**
+     * Iterator to the first element not less than the given key.
+     *
+     * @param key Key to get lower bound iterator for.
+     *
+     * @return Iterator to the first element not less than the given key.
+     */
+    const_iterator
+    lower_bound(const Key& key) const {
+        return const_iterator(
+            this,
+            skip_erased(main_lower_bound(key)),
+            buf_lower_bound(key));
+    }
+
+    /**
+     * Iterator to the first element greater than the given key.
+     *
+     * @param key Key to get upper bound iterator for.
+     *
+     * @return Iterator to the first element greater than the given key.
+     */
+    const_iterator
+    upper_bound(const Key& key) const {
+        return const_iterator(
+            this,
+            skip_erased(main_upper_bound(key)),
+            buf_upper_bound(key));
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /**
+     * Get function object that compares the keys.
+     *
+     * @return Function object that compares the keys.
+     */
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+    /**
+     * Get function object that compares the values.
+     *
+     * It is the same as `key_comp.`
+     *
+     * @return Function object that compares the values.
+     */
+    value_compare
+    value_comp() const {
+        return comp;
+    }
+
+    /// @}
+
+}; // class buffered_vectorset
+
+
+template<class Key, class Compare, class Allocator>
+constexpr typename buffered_vectorset<Key, Compare, Allocator>::size_type
+buffered_vectorset<Key, Compare, Allocator>::min_buffer_size;
+
+
+/**
+ * Equal operator of `buffered_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator==(
+    const buffered_vectorset<T, Compare, Alloc>& lhs,
+    const buffered_vectorset<T, Compare, Alloc>& rhs)
+{
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+/**
+ * Not equal operator of `buffered_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator!=(
+    const buffered_vectorset<T, Compare, Alloc>& lhs,
+    const buffered_vectorset<T, Compare, Alloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+#endif /* BUFFERED_VECTOR_SET_H */
@@ -0,0 +1,473 @@
+//
+// Vector container with a compact (16 byte) header.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef COMPACT_VECTOR_H
+#define COMPACT_VECTOR_H
+
+#include "vectorset.h"
+#include "contiguous_vector_base.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+
+/**
+ * A sequence container with a compact header.
+ *
+ * The container object holds a pointer to the elements, a 32 bit
+ * size and a 32 bit word with the capacity (30 bits) and two owner
+ * bits. With an empty allocator, it occupies 16 bytes on 64 bit
+ * platforms (`std::vector` needs 24 bytes). An empty container
+ * allocates no memory. The storage is contiguous, the iterators are
+ * pointers.
+ *
+ * The owner bits are free for the user of the container and are not
+ * copied, moved or swapped together with the elements. `vectorset`
+ * stores its mode in them (see `compact_vectorset`), so the set
+ * needs no additional member.
+ *
+ * The container provides the interface of `std::vector` used by
+ * `vectorset` (see `contiguous_vector_base`). The number of elements
+ * is limited to `2^30 - 1`.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Allocator Allocator to use for all memory allocations.
+ */
+template<
+    class T,
+    class Allocator = std::allocator<T>
+    >
+class compact_vector
+    : public contiguous_vector_base<compact_vector<T, Allocator>, T, Allocator>
+{
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    friend class contiguous_vector_base<compact_vector, T, Allocator>;
+
+    static_assert(
+        std::is_same<typename alloc_traits::pointer, T*>::value,
+        "Allocator of compact_vector must use raw pointers");
+
+public:
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    /// Position of the owner bits in `capBits`.
+    static constexpr unsigned owner_shift = 30;
+
+    /// Mask of the capacity in `capBits`.
+    static constexpr std::uint32_t cap_mask = (1u << owner_shift) - 1;
+
+    T *elems = nullptr;         ///< Storage (`nullptr` if no capacity).
+    std::uint32_t count = 0;    ///< Number of elements.
+    std::uint32_t capBits = 0;  ///< Capacity and owner bits.
+
+    /// Allocator of the storage.
+    VSET_no_unique_address Allocator alloc;
+
+    /// Capacity of the storage.
+    size_type
+    cap() const noexcept {
+        return (capBits & cap_mask);
+    }
+
+    /// Set storage (owner bits are kept).
+    void
+    set_storage(T *storage, size_type storageCap) noexcept {
+        elems = storage;
+        capBits = ((capBits & ~cap_mask)
+                   | static_cast<std::uint32_t>(storageCap));
+    }
+
+    /// Destroy all elements and free the storage.
+    void
+    release() noexcept {
+        this->clear();
+        if (elems != nullptr) {
+            alloc_traits::deallocate(alloc, elems, cap());
+            set_storage(nullptr, 0);
+        }
+    }
+
+    /// Move elements into a new storage for `new_cap` elements.
+    void
+    grow(size_type new_cap) {
+        if (new_cap > max_size()) {
+            throw std::length_error("compact_vector");
+        }
+
+        auto target = alloc_traits::allocate(alloc, new_cap);
+        size_type pos = 0;
+
+        try {
+            for (; pos < count; ++pos) {
+                alloc_traits::construct(
+                    alloc, target + pos, std::move_if_noexcept(elems[pos]));
+            }
+        }
+        catch (...) {
+            while (pos > 0) {
+                alloc_traits::destroy(alloc, target + --pos);
+            }
+            alloc_traits::deallocate(alloc, target, new_cap);
+            throw;
+        }
+
+        for (pos = 0; pos < count; ++pos) {
+            alloc_traits::destroy(alloc, elems + pos);
+        }
+        if (elems != nullptr) {
+            alloc_traits::deallocate(alloc, elems, cap());
+        }
+        set_storage(target, new_cap);
+    }
+
+    /// Capacity after growing by one element.
+    size_type
+    next_capacity() const {
+        auto limit = max_size();
+
+        if (cap() >= limit) {
+            throw std::length_error("compact_vector");
+        }
+
+        return (cap() == 0 ? 1 : std::min(cap() * 2, limit));
+    }
+
+    /// Take the storage of `other`.
+    void
+    take(compact_vector &other) noexcept {
+        set_storage(other.elems, other.cap());
+        count = other.count;
+        other.set_storage(nullptr, 0);
+        other.count = 0;
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor.
+    compact_vector() : compact_vector(Allocator()) {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    compact_vector(const Allocator& alloc) noexcept
+        : alloc(alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    compact_vector(
+        InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : compact_vector(alloc)
+    {
+        try {
+            this->append(
+                first, last,
+                typename std::iterator_traits<InputIt>::iterator_category());
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /**
+     * Initializer-list constructor.
+     *
+     * @param init Initializer-list to copy.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    compact_vector(
+        std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : compact_vector(init.begin(), init.end(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Copy constructor.
+     *
+     * The owner bits are not copied.
+     *
+     * @param other Another container to copy.
+     */
+    compact_vector(const compact_vector &other)
+        : compact_vector(
+            other.begin(), other.end(),
+            alloc_traits::select_on_container_copy_construction(other.alloc))
+    {
+        /* empty */
+    }
+
+    /**
+     * Move constructor.
+     *
+     * The owner bits are not moved.
+     *
+     * @param other Another container to move.
+     */
+    compact_vector(compact_vector &&other) noexcept
+        : compact_vector(other.alloc)
+    {
+        take(other);
+    }
+
+    /// Destructor.
+    ~compact_vector() {
+        release();
+    }
+
+    /**
+     * Copy assignment.
+     *
+     * The owner bits are not copied.
+     *
+     * @param other Another container to copy.
+     *
+     * @return `*this`
+     */
+    compact_vector &
+    operator=(const compact_vector &other) {
+        if (this != &other) {
+            if (alloc_traits::propagate_on_container_copy_assignment::value
+                && alloc != other.alloc)
+            {
+                release();
+                alloc = other.alloc;
+            }
+            this->clear();
+            this->append(
+                other.begin(), other.end(), std::forward_iterator_tag());
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment.
+     *
+     * The owner bits are not moved.
+     *
+     * @param other Another container to move.
+     *
+     * @return `*this`
+     */
+    compact_vector &
+    operator=(compact_vector &&other) {
+        if (this != &other) {
+            release();
+            if (alloc_traits::propagate_on_container_move_assignment::value
+                || alloc == other.alloc)
+            {
+                alloc = other.alloc;
+                take(other);
+            }
+            else {
+                this->append(
+                    std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()),
+                    std::forward_iterator_tag());
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Initializer-list assignment.
+     *
+     * @param ilist Initializer-list to copy.
+     *
+     * @return `*this`
+     */
+    compact_vector &
+    operator=(std::initializer_list<T> ilist) {
+        this->clear();
+        this->append(ilist.begin(), ilist.end(), std::forward_iterator_tag());
+        return *this;
+    }
+
+    /// @}
+
+    /// Get allocator associated with the container.
+    allocator_type
+    get_allocator() const noexcept {
+        return alloc;
+    }
+
+    /// @name Owner bits
+
+    /// @{
+
+    /// Get the two owner bits (0 to 3).
+    unsigned
+    get_owner_bits() const noexcept {
+        return (capBits >> owner_shift);
+    }
+
+    /// Set the two owner bits (0 to 3).
+    void
+    set_owner_bits(unsigned bits) noexcept {
+        capBits = ((capBits & cap_mask)
+                   | (static_cast<std::uint32_t>(bits & 3u) << owner_shift));
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Maximum possible number of elements (at most `2^30 - 1`).
+    size_type
+    max_size() const noexcept {
+        return std::min<size_type>(cap_mask, alloc_traits::max_size(alloc));
+    }
+
+    /// Reserves storage for `new_cap` elements.
+    void
+    reserve(size_type new_cap) {
+        if (new_cap > cap()) {
+            grow(new_cap);
+        }
+    }
+
+    /// Number of elements that can be held in current storage.
+    size_type
+    capacity() const noexcept {
+        return cap();
+    }
+
+    /// Reduces memory usage (frees the storage of an empty container).
+    void
+    shrink_to_fit() {
+        if (count == 0) {
+            release();
+        }
+        else if (count < cap()) {
+            grow(count);
+        }
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Exchange content with `other`.
+     *
+     * The owner bits are not exchanged.
+     */
+    void
+    swap(compact_vector &other) noexcept {
+        using std::swap;
+
+        auto storage = elems;
+        auto storageCap = cap();
+
+        set_storage(other.elems, other.cap());
+        other.set_storage(storage, storageCap);
+        swap(count, other.count);
+        swap(alloc, other.alloc);
+    }
+
+    /// @}
+
+}; // class compact_vector
+
+
+template<class T, class Allocator>
+constexpr unsigned compact_vector<T, Allocator>::owner_shift;
+
+template<class T, class Allocator>
+constexpr std::uint32_t compact_vector<T, Allocator>::cap_mask;
+
+
+/// `compact_vector` stores the mode of a `vectorset` in its owner bits.
+template<class T, class Allocator>
+struct vectorset_embeds_mode<compact_vector<T, Allocator>>
+    : std::true_type
+{};
+
+
+/**
+ * `vectorset` with a compact (16 byte) header.
+ *
+ * The mode is stored in the owner bits of `compact_vector` and an
+ * empty `Compare` occupies no storage, so the set has the size of its
+ * container. Useful for huge numbers of small sets.
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+using compact_vectorset =
+    vectorset<Key, Compare, Allocator, compact_vector<Key, Allocator>>;
+
+#endif /* COMPACT_VECTOR_H */
@@ -0,0 +1,582 @@
+//
+// Common element access and modifiers of contiguous vector containers.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef CONTIGUOUS_VECTOR_BASE_H
+#define CONTIGUOUS_VECTOR_BASE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+/**
+ * Base of vector containers with contiguous storage (CRTP).
+ *
+ * The base implements element access, iterators and the modifiers
+ * of `std::vector` on top of the storage policy of `Derived`
+ * (`small_vector`, `compact_vector`). `Derived` declares this class
+ * as friend and provides:
+ *
+ * * the members `elems` (begin of storage), `count` (number of
+ *   elements) and `alloc` (allocator),
+ * * `capacity()` and `reserve(size_type)`,
+ * * `grow(size_type)`, which moves the elements into a new storage
+ *   (strong exception guarantee), and `next_capacity()`, the
+ *   capacity after growing by one element.
+ *
+ * @tparam Derived Vector container class.
+ * @tparam T Type of the elements.
+ * @tparam Allocator Allocator of the storage.
+ */
+template<class Derived, class T, class Allocator>
+class contiguous_vector_base {
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    /// Derived container.
+    Derived &
+    self() noexcept {
+        return static_cast<Derived&>(*this);
+    }
+
+    /// Derived container (const).
+    const Derived &
+    self() const noexcept {
+        return static_cast<const Derived&>(*this);
+    }
+
+    /// Insert value at index.
+    iterator
+    insert_at(size_type idx, T &&value) {
+        auto &vec = self();
+
+        if (vec.count == vec.capacity()) {
+            vec.grow(vec.next_capacity());
+        }
+
+        if (idx == vec.count) {
+            alloc_traits::construct(
+                vec.alloc, vec.elems + vec.count, std::move(value));
+        }
+        else {
+            alloc_traits::construct(
+                vec.alloc, vec.elems + vec.count,
+                std::move(vec.elems[vec.count - 1]));
+            std::move_backward(
+                vec.elems + idx, vec.elems + vec.count - 1,
+                vec.elems + vec.count);
+            vec.elems[idx] = std::move(value);
+        }
+        ++vec.count;
+
+        return vec.elems + idx;
+    }
+
+protected:
+
+    /// Append range (input iterators).
+    template<class InputIt>
+    void
+    append(InputIt first, InputIt last, std::input_iterator_tag) {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    /// Append range (forward iterators, single allocation).
+    template<class ForwardIt>
+    void
+    append(ForwardIt first, ForwardIt last, std::forward_iterator_tag) {
+        auto &vec = self();
+
+        vec.reserve(vec.count + std::distance(first, last));
+        for (; first != last; ++first) {
+            alloc_traits::construct(vec.alloc, vec.elems + vec.count, *first);
+            ++vec.count;
+        }
+    }
+
+public:
+
+    /// @name Element access
+
+    /// @{
+
+    /// Access element with bounds checking.
+    reference
+    at(size_type pos) {
+        if (pos >= size()) {
+            throw std::out_of_range("vector::at");
+        }
+        return data()[pos];
+    }
+
+    /// Access element with bounds checking (const).
+    const_reference
+    at(size_type pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("vector::at");
+        }
+        return data()[pos];
+    }
+
+    /// Access element.
+    reference
+    operator[](size_type pos) {
+        return data()[pos];
+    }
+
+    /// Access element (const).
+    const_reference
+    operator[](size_type pos) const {
+        return data()[pos];
+    }
+
+    /// Access first element.
+    reference
+    front() {
+        return data()[0];
+    }
+
+    /// Access first element (const).
+    const_reference
+    front() const {
+        return data()[0];
+    }
+
+    /// Access last element.
+    reference
+    back() {
+        return data()[size() - 1];
+    }
+
+    /// Access last element (const).
+    const_reference
+    back() const {
+        return data()[size() - 1];
+    }
+
+    /// Direct access to the underlying storage.
+    T *
+    data() noexcept {
+        return self().elems;
+    }
+
+    /// Direct access to the underlying storage (const).
+    const T *
+    data() const noexcept {
+        return self().elems;
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    iterator
+    begin() noexcept {
+        return data();
+    }
+
+    const_iterator
+    begin() const noexcept {
+        return data();
+    }
+
+    const_iterator
+    cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator
+    end() noexcept {
+        return data() + size();
+    }
+
+    const_iterator
+    end() const noexcept {
+        return data() + size();
+    }
+
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator
+    rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    crbegin() const noexcept {
+        return rbegin();
+    }
+
+    reverse_iterator
+    rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    crend() const noexcept {
+        return rend();
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    bool
+    empty() const noexcept {
+        return (size() == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return self().count;
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /// Clears the contents (keeps the storage).
+    void
+    clear() noexcept {
+        auto &vec = self();
+
+        for (size_type pos = 0; pos < vec.count; ++pos) {
+            alloc_traits::destroy(vec.alloc, vec.elems + pos);
+        }
+        vec.count = 0;
+    }
+
+    /// Inserts element (copy) before `pos`.
+    iterator
+    insert(const_iterator pos, const T &value) {
+        return insert_at(pos - begin(), T(value));
+    }
+
+    /// Inserts element (move) before `pos`.
+    iterator
+    insert(const_iterator pos, T &&value) {
+        return insert_at(pos - begin(), std::move(value));
+    }
+
+    /// Inserts elements of range [first, last) before `pos`.
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    iterator
+    insert(const_iterator pos, InputIt first, InputIt last) {
+        auto idx = pos - begin();
+        auto oldSize = size();
+
+        append(
+            first, last,
+            typename std::iterator_traits<InputIt>::iterator_category());
+
+        std::rotate(begin() + idx, begin() + oldSize, end());
+
+        return begin() + idx;
+    }
+
+    /// Inserts elements of initializer list before `pos`.
+    iterator
+    insert(const_iterator pos, std::initializer_list<T> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    /// Constructs element in-place before `pos`.
+    template<class... Args>
+    iterator
+    emplace(const_iterator pos, Args&&... args) {
+        return insert_at(pos - begin(), T(std::forward<Args>(args)...));
+    }
+
+    /// Erase element at `pos`.
+    iterator
+    erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    /// Erase elements of range [first, last).
+    iterator
+    erase(const_iterator first, const_iterator last) {
+        auto idx = first - begin();
+        auto num = static_cast<size_type>(last - first);
+
+        if (num > 0) {
+            std::move(begin() + idx + num, end(), begin() + idx);
+
+            for (; num > 0; --num) {
+                pop_back();
+            }
+        }
+
+        return begin() + idx;
+    }
+
+    /// Adds an element (copy) to the end.
+    void
+    push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    /// Adds an element (move) to the end.
+    void
+    push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    /// Constructs an element in-place at the end.
+    template<class... Args>
+    reference
+    emplace_back(Args&&... args) {
+        auto &vec = self();
+
+        if (vec.count == vec.capacity()) {
+            // the storage moves: args may refer to its elements.
+            T value(std::forward<Args>(args)...);
+
+            vec.grow(vec.next_capacity());
+            alloc_traits::construct(
+                vec.alloc, vec.elems + vec.count, std::move(value));
+        }
+        else {
+            alloc_traits::construct(
+                vec.alloc, vec.elems + vec.count, std::forward<Args>(args)...);
+        }
+
+        return vec.elems[vec.count++];
+    }
+
+    /// Removes the last element.
+    void
+    pop_back() {
+        auto &vec = self();
+
+        alloc_traits::destroy(vec.alloc, vec.elems + vec.count - 1);
+        --vec.count;
+    }
+
+    /// Changes the number of elements stored.
+    void
+    resize(size_type new_size) {
+        self().reserve(new_size);
+        while (size() > new_size) {
+            pop_back();
+        }
+        while (size() < new_size) {
+            emplace_back();
+        }
+    }
+
+    /// Changes the number of elements stored (copy `value`).
+    void
+    resize(size_type new_size, const value_type& value) {
+        while (size() > new_size) {
+            pop_back();
+        }
+        while (size() < new_size) {
+            emplace_back(value);
+        }
+    }
+
+    /// @}
+
+}; // class contiguous_vector_base
+
+
+/**
+ * Equal operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator==(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+#if __cplusplus >= 202002L // c++20
+
+/**
+ * Three way compare of contiguous vector containers.
+ *
+ * Requires *C++20* or higher.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Comparison category type (`std::lexicographical_compare_three_way`).
+ */
+template<class Derived, class T, class Alloc>
+inline auto
+operator<=>(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return std::lexicographical_compare_three_way(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+#else // until c++20, __cplusplus < 202002L
+
+/**
+ * Not equal operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator!=(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * Less operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs < rhs` (`std::lexicographical_compare`).
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator<(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return std::lexicographical_compare(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/**
+ * Less or equal operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs <= rhs` (`std::lexicographical_compare`).
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator<=(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+/**
+ * Greater operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs > rhs` (`std::lexicographical_compare`).
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator>(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return (rhs < lhs);
+}
+
+/**
+ * Greater or equal operator of contiguous vector containers.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs >= rhs` (`std::lexicographical_compare`).
+ */
+template<class Derived, class T, class Alloc>
+inline bool
+operator>=(
+    const contiguous_vector_base<Derived, T, Alloc>& lhs,
+    const contiguous_vector_base<Derived, T, Alloc>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+#endif // __cplusplus < 202002L
+
+#endif /* CONTIGUOUS_VECTOR_BASE_H */
@@ -0,0 +1,576 @@
+//
+// Compressed read only integer set.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Elias-Fano encoded read only copy of an unique ordered vectorset.
+
+#ifndef VECTOR_SET_FROZEN_H
+#define VECTOR_SET_FROZEN_H
+
+#include "vectorset_algo.h"
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+/**
+ * Read only set of unsigned integers in Elias-Fano encoding.
+ *
+ * Each value is split into `l = floor(log2(max / n))` low bits and
+ * the remaining high bits. The low bits are stored packed, the high
+ * bits are stored in unary code in a bit vector of `n + (max >> l) +
+ * 1` bits, so the set needs about `2 + log2(max / n)` bits per
+ * element. Every 256th set bit and every 256th clear bit of the high
+ * bit vector is sampled to accelerate `operator[]` (select) and
+ * `lower_bound()`.
+ *
+ * The set is created from an unique ordered `vectorset` by `freeze()`
+ * and provides the lookup interface of a constant unique ordered
+ * `vectorset`. Its iterators are constant forward iterators, which
+ * decode the values in order.
+ *
+ * @tparam UInt Unsigned integer type of the values (e.g. `uint32_t`
+ *              or `uint64_t`).
+ */
+template<class UInt>
+class frozen_vectorset {
+    static_assert(
+        std::is_integral<UInt>::value && std::is_unsigned<UInt>::value,
+        "frozen_vectorset requires an unsigned integer type");
+
+public:
+
+    using key_type = UInt;
+    using value_type = UInt;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = std::less<UInt>;
+    using value_compare = std::less<UInt>;
+
+    /// Distance of sampled bits in the high bit vector.
+    static constexpr size_type sample_rate = 256;
+
+    /**
+     * Constant forward iterator of `frozen_vectorset`.
+     *
+     * The iterator stores the index of the element, the position of
+     * its high bit and the decoded value.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = UInt;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const UInt*;
+        using reference = const UInt&;
+
+        const_iterator() = default;
+
+        reference
+        operator*() const {
+            return value;
+        }
+
+        pointer
+        operator->() const {
+            return &value;
+        }
+
+        const_iterator &
+        operator++() {
+            if (++idx < owner->elemCount) {
+                pos = owner->next_one(pos + 1);
+                value = owner->decode(idx, pos);
+            }
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        /// Index of the element in the set.
+        size_type
+        index() const noexcept {
+            return idx;
+        }
+
+        bool
+        operator==(const const_iterator &other) const {
+            return (idx == other.idx);
+        }
+
+        bool
+        operator!=(const const_iterator &other) const {
+            return (idx != other.idx);
+        }
+
+    private:
+        friend class frozen_vectorset;
+
+        const_iterator(
+            const frozen_vectorset *owner, size_type idx, size_type pos)
+            : owner(owner), idx(idx), pos(pos), value()
+        {
+            if (idx < owner->elemCount) {
+                value = owner->decode(idx, pos);
+            }
+        }
+
+        const frozen_vectorset *owner = nullptr;
+        size_type idx = 0;
+        size_type pos = 0;
+        UInt value = 0;
+    };
+
+    using iterator = const_iterator;
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor (empty set).
+    frozen_vectorset() = default;
+
+    /**
+     * Range constructor.
+     *
+     * @throws std::logic_error The values are not sorted or not
+     *                          unique.
+     *
+     * @param first Forward iterator to the first value.
+     * @param last Forward iterator after the last value.
+     */
+    template<
+        class ForwardIt,
+        class = typename std::enable_if<
+            !std::is_integral<ForwardIt>::value>::type>
+    frozen_vectorset(ForwardIt first, ForwardIt last) {
+        encode(first, last);
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    const_iterator
+    begin() const {
+        return const_iterator(this, 0, elemCount > 0 ? next_one(0) : 0);
+    }
+
+    const_iterator
+    cbegin() const {
+        return begin();
+    }
+
+    const_iterator
+    end() const noexcept {
+        return const_iterator(this, elemCount, upperBits);
+    }
+
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the set has no elements.
+    bool
+    empty() const noexcept {
+        return (elemCount == 0);
+    }
+
+    /// Number of elements in the set.
+    size_type
+    size() const noexcept {
+        return elemCount;
+    }
+
+    /// Number of low bits per element.
+    unsigned
+    low_bits() const noexcept {
+        return lowBits;
+    }
+
+    /// Memory used by the encoded elements and samples (bytes).
+    size_type
+    memory_bytes() const noexcept {
+        return ((lower.size() + upper.size()) * sizeof(uint64_t)
+                + (ones.size() + zeros.size()) * sizeof(size_type));
+    }
+
+    /// @}
+
+    /// @name Element access
+
+    /// @{
+
+    /// Access element (select).
+    UInt
+    operator[](size_type idx) const {
+        return decode(idx, select1(idx));
+    }
+
+    /// Access element with bounds checking.
+    UInt
+    at(size_type idx) const {
+        if (idx >= elemCount) {
+            throw std::out_of_range("frozen_vectorset::at");
+        }
+        return (*this)[idx];
+    }
+
+    /// Access first element.
+    UInt
+    front() const {
+        return (*this)[0];
+    }
+
+    /// Access last element.
+    UInt
+    back() const {
+        return maxValue;
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Iterator to the first element not less than `key`.
+     *
+     * The bucket of the high bits of `key` is found by select on the
+     * clear bits, then the bucket is scanned.
+     */
+    const_iterator
+    lower_bound(UInt key) const {
+        if (elemCount == 0 || key > maxValue) {
+            return end();
+        }
+
+        auto high = static_cast<size_type>(key >> lowBits);
+        size_type pos = 0;
+        size_type idx = 0;
+
+        if (high > 0) {
+            pos = select0(high - 1) + 1;
+            idx = pos - high;
+        }
+
+        for (pos = next_one(pos); ; pos = next_one(pos + 1), ++idx) {
+            if (decode(idx, pos) >= key) {
+                return const_iterator(this, idx, pos);
+            }
+        }
+    }
+
+    /// Iterator to the first element greater than `key`.
+    const_iterator
+    upper_bound(UInt key) const {
+        return (key >= maxValue ? end() : lower_bound(key + 1));
+    }
+
+    /// Range of elements equal to `key` (at most one).
+    std::pair<const_iterator, const_iterator>
+    equal_range(UInt key) const {
+        auto iter = lower_bound(key);
+
+        if (iter != end() && *iter == key) {
+            auto next = iter;
+            return {iter, ++next};
+        }
+
+        return {iter, iter};
+    }
+
+    /// Find element equal to `key` (`end()` if not found).
+    const_iterator
+    find(UInt key) const {
+        auto iter = lower_bound(key);
+
+        return ((iter != end() && *iter == key) ? iter : end());
+    }
+
+    /// Number of elements equal to `key` (0 or 1).
+    size_type
+    count(UInt key) const {
+        return (contains(key) ? 1 : 0);
+    }
+
+    /// Checks if the set contains `key`.
+    bool
+    contains(UInt key) const {
+        auto iter = lower_bound(key);
+
+        return (iter != end() && *iter == key);
+    }
+
+    /// @}
+
+    /// Get compare function of keys.
+    key_compare
+    key_comp() const {
+        return key_compare();
+    }
+
+    /// Decode all elements into an unique ordered `vectorset`.
+    vectorset<UInt>
+    to_vectorset() const {
+        std::vector<UInt> sorted(begin(), end());
+
+        return vectorset<UInt>(vectorset_sorted_unique, std::move(sorted));
+    }
+
+private:
+    size_type elemCount = 0;    ///< Number of elements.
+    unsigned lowBits = 0;       ///< Number of low bits per element.
+    UInt maxValue = 0;          ///< Largest element.
+    size_type upperBits = 0;    ///< Size of the high bit vector.
+
+    std::vector<uint64_t> lower;    ///< Packed low bits.
+    std::vector<uint64_t> upper;    ///< High bits (unary code).
+    std::vector<size_type> ones;    ///< Position of every 256th set bit.
+    std::vector<size_type> zeros;   ///< Position of every 256th clear bit.
+
+    /// Mask of the low bits.
+    uint64_t
+    low_mask() const noexcept {
+        return (uint64_t(1) << lowBits) - 1;
+    }
+
+    /// Get low bits of element `idx`.
+    uint64_t
+    get_low(size_type idx) const {
+        if (lowBits == 0) {
+            return 0;
+        }
+
+        auto bit = idx * lowBits;
+        auto word = bit / 64;
+        auto offset = bit % 64;
+        auto result = lower[word] >> offset;
+
+        if (offset + lowBits > 64) {
+            result |= lower[word + 1] << (64 - offset);
+        }
+
+        return (result & low_mask());
+    }
+
+    /// Set low bits of element `idx`.
+    void
+    set_low(size_type idx, uint64_t bits) {
+        auto bit = idx * lowBits;
+        auto word = bit / 64;
+        auto offset = bit % 64;
+
+        lower[word] |= bits << offset;
+        if (offset + lowBits > 64) {
+            lower[word + 1] |= bits >> (64 - offset);
+        }
+    }
+
+    /// Value of element `idx` with its high bit at `pos`.
+    UInt
+    decode(size_type idx, size_type pos) const {
+        return static_cast<UInt>(
+            (static_cast<uint64_t>(pos - idx) << lowBits) | get_low(idx));
+    }
+
+    /// Position of the first set bit at or after `pos` (must exist).
+    size_type
+    next_one(size_type pos) const {
+        auto word = pos / 64;
+        auto bits = upper[word] & (~uint64_t(0) << (pos % 64));
+
+        while (bits == 0) {
+            bits = upper[++word];
+        }
+
+        return word * 64 + _vectorset_select64(bits, 0);
+    }
+
+    /**
+     * Position of the `rank`-th set or clear bit of the high bits.
+     *
+     * @param samples Sampled positions (`ones` or `zeros`).
+     * @param rank Number of set (clear) bits to skip.
+     * @param invert `true` to search clear bits.
+     */
+    size_type
+    select(
+        const std::vector<size_type> &samples, size_type rank,
+        bool invert) const
+    {
+        auto pos = samples[rank / sample_rate];
+        auto remaining = rank % sample_rate;
+        auto word = pos / 64;
+        auto flip = invert ? ~uint64_t(0) : 0;
+        auto bits = (upper[word] ^ flip) & (~uint64_t(0) << (pos % 64));
+
+        for (;;) {
+            auto found = _vectorset_popcount64(bits);
+
+            if (remaining < found) {
+                return (word * 64
+                        + _vectorset_select64(
+                            bits, static_cast<unsigned>(remaining)));
+            }
+
+            remaining -= found;
+            bits = upper[++word] ^ flip;
+        }
+    }
+
+    /// Position of the `rank`-th set bit (select1).
+    size_type
+    select1(size_type rank) const {
+        return select(ones, rank, false);
+    }
+
+    /// Position of the `rank`-th clear bit (select0).
+    size_type
+    select0(size_type rank) const {
+        return select(zeros, rank, true);
+    }
+
+    /// Encode sorted unique values.
+    template<class ForwardIt>
+    void
+    encode(ForwardIt first, ForwardIt last) {
+        for (auto iter = first; iter != last; ++iter) {
+            if (elemCount > 0 && !(maxValue < *iter)) {
+                throw std::logic_error(
+                    "frozen_vectorset requires sorted unique values");
+            }
+            maxValue = *iter;
+            ++elemCount;
+        }
+
+        if (elemCount == 0) {
+            return;
+        }
+
+        auto ratio = static_cast<uint64_t>(maxValue) / elemCount;
+
+        while (ratio > 1) {
+            ratio >>= 1;
+            ++lowBits;
+        }
+
+        auto highMax = static_cast<size_type>(
+            static_cast<uint64_t>(maxValue) >> lowBits);
+
+        upperBits = elemCount + highMax + 1;
+        upper.assign((upperBits + 63) / 64 + 1, 0);
+        lower.assign((elemCount * lowBits + 63) / 64, 0);
+        ones.reserve((elemCount + sample_rate - 1) / sample_rate);
+
+        size_type idx = 0;
+
+        for (; first != last; ++first, ++idx) {
+            auto value = static_cast<uint64_t>(*first);
+            auto pos = static_cast<size_type>(value >> lowBits) + idx;
+
+            if (lowBits > 0) {
+                set_low(idx, value & low_mask());
+            }
+            upper[pos / 64] |= uint64_t(1) << (pos % 64);
+            if (idx % sample_rate == 0) {
+                ones.push_back(pos);
+            }
+        }
+
+        // sample clear bits (highMax + 1 buckets)
+        zeros.reserve((highMax + sample_rate) / sample_rate);
+
+        size_type seen = 0;
+
+        for (size_type word = 0; word * 64 < upperBits; ++word) {
+            auto bits = ~upper[word];
+
+            if ((word + 1) * 64 > upperBits) {
+                bits &= (uint64_t(1) << (upperBits % 64)) - 1;
+            }
+
+            auto found = _vectorset_popcount64(bits);
+
+            while (zeros.size() * sample_rate < seen + found) {
+                zeros.push_back(
+                    word * 64
+                    + _vectorset_select64(
+                        bits,
+                        static_cast<unsigned>(
+                            zeros.size() * sample_rate - seen)));
+            }
+            seen += found;
+        }
+    }
+};
+
+
+template<class UInt>
+constexpr typename frozen_vectorset<UInt>::size_type
+frozen_vectorset<UInt>::sample_rate;
+
+
+/**
+ * Create an Elias-Fano encoded read only copy of a vectorset.
+ *
+ * @throws std::logic_error The container is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param set Unique ordered vectorset of unsigned integers.
+ *
+ * @return Frozen copy of `set`.
+ */
+template<class UInt, class Allocator, class Container>
+frozen_vectorset<UInt>
+freeze(const vectorset<UInt, std::less<UInt>, Allocator, Container>& set) {
+    if (set.get_mode() != vectorset_mode::unique_ordered) {
+        throw std::logic_error(
+            "freeze is only available in vectorset_mode::unique_ordered");
+    }
+
+    return frozen_vectorset<UInt>(set.begin(), set.end());
+}
+
+#endif /* VECTOR_SET_FROZEN_H */
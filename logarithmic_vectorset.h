@@ -0,0 +1,894 @@
+//
+// Sorted container based on logarithmic sorted runs.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef LOGARITHMIC_VECTOR_SET_H
+#define LOGARITHMIC_VECTOR_SET_H
+
+#include "vectorset.h"
+
+#include <iterator>
+
+
+/**
+ * A set based on sorted runs of geometrically increasing size
+ * (logarithmic method).
+ *
+ * Run `i` holds at most `min_run_size * 2^i` sorted elements; all runs
+ * are disjoint. New elements are inserted into the small run 0. If it
+ * overflows, it is merged into the next run with enough room; full
+ * runs on the way are merged as well (like a binary counter or the
+ * in-memory levels of a LSM tree). Inserts cost amortized O(log n)
+ * moves, lookups search each of the O(log n) runs.
+ *
+ * `compact()` merges all runs into a single one before read-heavy
+ * phases. The container is always unique ordered.
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+class logarithmic_vectorset {
+public:
+
+    using vector_type = std::vector<Key, Allocator>;
+    using key_type = Key;
+    using value_type = Key;
+    using size_type  = typename vector_type::size_type;
+    using difference_type = typename vector_type::difference_type;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    /// Maximal size of run 0.
+    static constexpr size_type min_run_size = 16;
+
+    /**
+     * Iterator merging all runs.
+     *
+     * Elements of the set are constant (like `std::set`).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Key;
+        using difference_type =
+            typename logarithmic_vectorset::difference_type;
+        using pointer = const Key*;
+        using reference = const Key&;
+
+        const_iterator() : owner(nullptr), cur(no_run) {
+            /* empty */
+        }
+
+        reference
+        operator*() const {
+            return owner->runs[cur][positions[cur]];
+        }
+
+        pointer
+        operator->() const {
+            return std::addressof(**this);
+        }
+
+        const_iterator &
+        operator++() {
+            ++positions[cur];
+            select();
+
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        friend bool
+        operator==(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.cur == rhs.cur
+                    && (lhs.cur == no_run
+                        || lhs.positions[lhs.cur] == rhs.positions[rhs.cur]));
+        }
+
+        friend bool
+        operator!=(const const_iterator &lhs, const const_iterator &rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class logarithmic_vectorset;
+
+        /// run index of end iterator.
+        static constexpr size_type no_run = size_type(-1);
+
+        explicit
+        const_iterator(const logarithmic_vectorset *owner)
+            : owner(owner), positions(owner->runs.size(), 0), cur(no_run)
+        { /* empty */ }
+
+        // select run with smallest current element.
+        void
+        select() {
+            cur = no_run;
+
+            for (size_type run = 0; run < positions.size(); ++run) {
+                if (positions[run] < owner->runs[run].size()
+                    && (cur == no_run
+                        || owner->comp(
+                            owner->runs[run][positions[run]],
+                            owner->runs[cur][positions[cur]])))
+                {
+                    cur = run;
+                }
+            }
+        }
+
+        const logarithmic_vectorset *owner;
+
+        /// current position in each run.
+        std::vector<size_type> positions;
+
+        /// run with current element.
+        size_type cur;
+    };
+
+    using iterator = const_iterator;
+
+
+#if _VECTOR_SET_DO_TRACE == 1
+    // Debug informations
+
+    /**
+     * get debug trace messages of class.
+     */
+    const _Vectorset_Trace &
+    getDebugTrace() const noexcept {
+        return traceElements;
+    }
+
+    /**
+     * remove all trace log elements.
+     */
+    void
+    clearDebugTrace() {
+        traceElements.clear();
+    }
+
+private:
+
+    mutable _Vectorset_Trace traceElements;
+#endif
+
+private:
+    using run_vector =
+        std::vector<
+            vector_type,
+            typename std::allocator_traits<Allocator>
+            ::template rebind_alloc<vector_type>>;
+
+    /// sorted runs (disjoint).
+    run_vector runs;
+
+    /// number of elements in all runs.
+    size_type numElems = 0;
+
+    /// compare method
+    Compare comp;
+
+
+    /**
+     * Equal operator based on `comp`.
+     *
+     * @param lhv Left-hand value.
+     * @param rhv Right-hand value.
+     *
+     * @return `true`, if `lhv==rhv`
+     */
+    bool
+    comp_eq(const_reference lhv, const_reference rhv) const {
+        return !(comp(lhv, rhv) || comp(rhv, lhv));
+    }
+
+    /// Maximal size of a run.
+    static size_type
+    run_capacity(size_type run) {
+        return (min_run_size << run);
+    }
+
+    /**
+     * Merge source run into target run.
+     *
+     * @param target Target run.
+     * @param source Source run (disjoint to `target`).
+     */
+    void
+    merge_run(vector_type &target, vector_type &source) {
+        if (target.empty()) {
+            target.swap(source);
+            return;
+        }
+
+        vector_type merged(target.get_allocator());
+
+        merged.reserve(target.size() + source.size());
+        std::merge(
+            std::make_move_iterator(target.begin()),
+            std::make_move_iterator(target.end()),
+            std::make_move_iterator(source.begin()),
+            std::make_move_iterator(source.end()),
+            std::back_inserter(merged),
+            comp);
+
+        target.swap(merged);
+        source.clear();
+    }
+
+    /**
+     * Store a sorted run as only run.
+     *
+     * @param values Sorted values (no duplicates).
+     */
+    void
+    set_single_run(vector_type &values) {
+        size_type run = 0;
+
+        while (run_capacity(run) < values.size()) {
+            ++run;
+        }
+
+        runs.clear();
+        runs.resize(run + 1, vector_type(values.get_allocator()));
+        runs[run].swap(values);
+    }
+
+    /**
+     * Iterator with all runs positioned at a bound.
+     *
+     * @param key Key to search for.
+     * @param lowerBound `true` for lower bound, `false` for upper bound.
+     *
+     * @return Iterator to bound.
+     */
+    const_iterator
+    bound(const Key &key, bool lowerBound) const {
+        const_iterator result(this);
+
+        for (size_type run = 0; run < runs.size(); ++run) {
+            auto &values = runs[run];
+            auto iter =
+                (lowerBound
+                 ? std::lower_bound(values.begin(), values.end(), key, comp)
+                 : std::upper_bound(values.begin(), values.end(), key, comp));
+
+            result.positions[run] = std::distance(values.begin(), iter);
+        }
+
+        result.select();
+
+        return result;
+    }
+
+    /**
+     * Insert value.
+     *
+     * @param value Value to insert.
+     *
+     * @return result pair: iterator to inserted value and flag, if
+     *         values has been inserted.
+     */
+    template<class ValType>
+    std::pair<iterator, bool>
+    impl_insert(ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_insert(ValType&&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto iter = bound(value, true);
+
+        if (iter != end() && !comp(value, *iter)) {
+            _VECTOR_SET_TRACE("found-no-insert");
+
+            return std::make_pair(iter, false);
+        }
+
+        if (runs.empty()) {
+            runs.emplace_back(runs.get_allocator());
+            iter.positions.push_back(0);
+        }
+
+        auto &first = runs.front();
+
+        first.insert(
+            std::next(first.begin(), iter.positions.front()),
+            std::forward<ValType>(value));
+        ++numElems;
+
+        if (first.size() <= run_capacity(0)) {
+            _VECTOR_SET_TRACE("insert-run");
+
+            iter.cur = 0;
+
+            return std::make_pair(iter, true);
+        }
+
+        // merge overflowing runs
+        vector_type carry(runs.get_allocator());
+        carry.swap(first);
+
+        // position of the new value in the merged runs
+        auto newPos = iter.positions.front();
+        iter.positions.front() = 0;
+
+        for (size_type run = 1; ; ++run) {
+            if (run == runs.size()) {
+                runs.emplace_back(runs.get_allocator());
+                iter.positions.push_back(0);
+            }
+
+            merge_run(runs[run], carry);
+            newPos += iter.positions[run];
+
+            if (runs[run].size() <= run_capacity(run)) {
+                _VECTOR_SET_TRACE_INT("merge", run);
+
+                iter.positions[run] = newPos;
+                iter.cur = run;
+                break;
+            }
+
+            iter.positions[run] = 0;
+            carry.swap(runs[run]);
+        }
+
+        return std::make_pair(iter, true);
+    }
+
+    /**
+     * Find value in runs.
+     *
+     * @param key Key to search for.
+     *
+     * @return pointer to element or `nullptr`.
+     */
+    const Key *
+    find_ptr(const Key &key) const {
+        for (auto &values : runs) {
+            auto iter =
+                std::lower_bound(values.begin(), values.end(), key, comp);
+
+            if (iter != values.end() && !comp(key, *iter)) {
+                return std::addressof(*iter);
+            }
+        }
+
+        return nullptr;
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /**
+     * Default constructor.
+     *
+     * Constructs empty container.
+     */
+    logarithmic_vectorset() : comp(Compare()) {
+        /* empty */
+    }
+
+    /**
+     * Construct empty container (comparator / allocator).
+     *
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    logarithmic_vectorset(
+        const Compare& comp,
+        const Allocator& alloc = Allocator())
+        : runs(alloc), comp(comp)
+    {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    logarithmic_vectorset(const Allocator& alloc)
+        : logarithmic_vectorset(Compare(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor (comparator / allocator).
+     *
+     * The range is sorted into a single run.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<class InputIt>
+    logarithmic_vectorset(
+        InputIt first, InputIt last,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : runs(alloc), comp(comp)
+    {
+        vector_type values(first, last, alloc);
+
+        std::sort(values.begin(), values.end(), this->comp);
+        auto rmIter =
+            std::unique(
+                values.begin(), values.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return this->comp_eq(lhv, rhv);
+                });
+        values.erase(rmIter, values.end());
+
+        numElems = values.size();
+        set_single_run(values);
+    }
+
+    /**
+     * Initializer-list constructor (comparator / allocator).
+     *
+     * @param init Initializer-list to copy.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    logarithmic_vectorset(
+        std::initializer_list<value_type> init,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : logarithmic_vectorset(init.begin(), init.end(), comp, alloc)
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Miscellaneous
+
+    /// @{
+
+    /**
+     * Get allocator associated with the container.
+     *
+     * @return allocator.
+     */
+    allocator_type
+    get_allocator() const noexcept {
+        return runs.get_allocator();
+    }
+
+    /**
+     * Merge all runs into a single run.
+     *
+     * Lookups search only one run afterwards.
+     */
+    void
+    compact() {
+        _VECTOR_SET_TRACE_SET_NAME("compact()");
+
+        auto used = run_count();
+
+        _VECTOR_SET_TRACE_INT("start", used);
+
+        if (used <= 1) {
+            return;
+        }
+
+        vector_type values(runs.get_allocator());
+
+        for (auto &run : runs) {
+            merge_run(values, run);
+        }
+
+        set_single_run(values);
+    }
+
+    /**
+     * Number of non-empty runs.
+     *
+     * @return Number of runs a lookup has to search.
+     */
+    size_type
+    run_count() const noexcept {
+        size_type result = 0;
+
+        for (auto &run : runs) {
+            if (!run.empty()) {
+                ++result;
+            }
+        }
+
+        return result;
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    const_iterator
+    begin() const {
+        return cbegin();
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const {
+        const_iterator result(this);
+        result.select();
+
+        return result;
+    }
+
+    /// Iterator to the end.
+    const_iterator
+    end() const noexcept {
+        return cend();
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const noexcept {
+        const_iterator result;
+        result.owner = this;
+
+        return result;
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return (numElems == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return numElems;
+    }
+
+    /// Maximum possible number of elements .
+    size_type
+    max_size() const noexcept {
+        return vector_type(runs.get_allocator()).max_size();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Clears the contents.
+     */
+    void
+    clear() noexcept {
+        runs.clear();
+        numElems = 0;
+    }
+
+    /**
+     * Inserts new element (copy), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to copy.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(const value_type& value) {
+        return impl_insert(value);
+    }
+
+    /**
+     * Inserts new element (move), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to move.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(value_type&& value) {
+        return impl_insert(std::move(value));
+    }
+
+    /**
+     * Inserts elements from range [first, last).
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            impl_insert(*first);
+        }
+    }
+
+    /**
+     * Constructs element in-place.
+     *
+     * @param args Arguments to forward to the constructor of the element.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         new element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator,bool>
+    emplace(Args&&... args) {
+        return impl_insert(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Erase element at position.
+     *
+     * Only the run of the element is shifted.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_ASSERT(pos.owner == this && pos.cur != pos.no_run);
+
+        auto &values = runs[pos.cur];
+
+        values.erase(std::next(values.begin(), pos.positions[pos.cur]));
+        --numElems;
+
+        pos.select();
+
+        return pos;
+    }
+
+    /**
+     * Erase element by key.
+     *
+     * @param key Key value of the element to remove.
+     *
+     * @return Number of elements removed (0 or 1).
+     */
+    size_type
+    erase(const Key& key) {
+        for (auto &values : runs) {
+            auto iter =
+                std::lower_bound(values.begin(), values.end(), key, comp);
+
+            if (iter != values.end() && !comp(key, *iter)) {
+                values.erase(iter);
+                --numElems;
+
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(logarithmic_vectorset& other) noexcept {
+        runs.swap(other.runs);
+        std::swap(numElems, other.numElems);
+        std::swap(comp, other.comp);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of elements matching specific key.
+     *
+     * @param key Key value of the elements to count.
+     *
+     * @return number of elements with key (0 or 1).
+     */
+    size_type
+    count(const Key& key) const {
+        return (contains(key) ? 1 : 0);
+    }
+
+    /**
+     * Find element matches key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return iterator to matched element or `end()`, if no matching
+     *         value is found.
+     */
+    const_iterator
+    find(const Key& key) const {
+        if (find_ptr(key) == nullptr) {
+            return end();
+        }
+
+        return bound(key, true);
+    }
+
+    /**
+     * Checks if the container contains element with specific key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(const Key& key) const {
+        return (find_ptr(key) != nullptr);
+    }
+
+    /**
+     * Iterator to the first element not less than the given key.
+     *
+     * @param key Key to get lower bound iterator for.
+     *
+     * @return Iterator to the first element not less than the given key.
+     */
+    const_iterator
+    lower_bound(const Key& key) const {
+        return bound(key, true);
+    }
+
+    /**
+     * Iterator to the first element greater than the given key.
+     *
+     * @param key Key to get upper bound iterator for.
+     *
+     * @return Iterator to the first element greater than the given key.
+     */
+    const_iterator
+    upper_bound(const Key& key) const {
+        return bound(key, false);
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /**
+     * Get function object that compares the keys.
+     *
+     * @return Function object that compares the keys.
+     */
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+    /**
+     * Get function object that compares the values.
+     *
+     * It is the same as `key_comp.`
+     *
+     * @return Function object that compares the values.
+     */
+    value_compare
+    value_comp() const {
+        return comp;
+    }
+
+    /// @}
+
+}; // class logarithmic_vectorset
+
+
+template<class Key, class Compare, class Allocator>
+constexpr typename logarithmic_vectorset<Key, Compare, Allocator>::size_type
+logarithmic_vectorset<Key, Compare, Allocator>::min_run_size;
+
+template<class Key, class Compare, class Allocator>
+constexpr typename logarithmic_vectorset<Key, Compare, Allocator>::size_type
+logarithmic_vectorset<Key, Compare, Allocator>::const_iterator::no_run;
+
+
+/**
+ * Equal operator of `logarithmic_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator==(
+    const logarithmic_vectorset<T, Compare, Alloc>& lhs,
+    const logarithmic_vectorset<T, Compare, Alloc>& rhs)
+{
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+/**
+ * Not equal operator of `logarithmic_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator!=(
+    const logarithmic_vectorset<T, Compare, Alloc>& lhs,
+    const logarithmic_vectorset<T, Compare, Alloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+#endif /* LOGARITHMIC_VECTOR_SET_H */
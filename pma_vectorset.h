@@ -0,0 +1,1159 @@
+//
+// Sorted container based on a packed memory array.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef PMA_VECTOR_SET_H
+#define PMA_VECTOR_SET_H
+
+#include "vectorset.h"
+
+#include <iterator>
+
+
+/**
+ * A set based on a packed memory array (PMA).
+ *
+ * The elements are stored sorted in one `std::vector` with gaps. The
+ * vector is divided into segments of about `log2(capacity)` slots;
+ * the elements of a segment are packed at its beginning. If a segment
+ * overflows (or underflows), the smallest enclosing window of
+ * segments with an acceptable density is redistributed evenly. The
+ * allowed density of a window is tighter for larger windows, so
+ * inserts and erases cost O(log^2 n) amortized moves instead of the
+ * O(n) shift in `vectorset`.
+ *
+ * Scans and binary searches stay nearly contiguous. The container is
+ * always unique ordered. `Key` has to be default constructible (gap
+ * slots) and move assignable.
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+class pma_vectorset {
+public:
+
+    using vector_type = std::vector<Key, Allocator>;
+    using key_type = Key;
+    using value_type = Key;
+    using size_type  = typename vector_type::size_type;
+    using difference_type = typename vector_type::difference_type;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+    /**
+     * Iterator over the used slots of the packed memory array.
+     *
+     * Elements of the set are constant (like `std::set`).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Key;
+        using difference_type = typename pma_vectorset::difference_type;
+        using pointer = const Key*;
+        using reference = const Key&;
+
+        const_iterator() : owner(nullptr), slot(0) {
+            /* empty */
+        }
+
+        reference
+        operator*() const {
+            return owner->slots[slot];
+        }
+
+        pointer
+        operator->() const {
+            return std::addressof(owner->slots[slot]);
+        }
+
+        const_iterator &
+        operator++() {
+            slot = owner->next_slot(slot);
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++(*this);
+            return result;
+        }
+
+        const_iterator &
+        operator--() {
+            slot = owner->prev_slot(slot);
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) {
+            auto result = *this;
+            --(*this);
+            return result;
+        }
+
+        friend bool
+        operator==(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.slot == rhs.slot);
+        }
+
+        friend bool
+        operator!=(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.slot != rhs.slot);
+        }
+
+    private:
+        friend class pma_vectorset;
+
+        const_iterator(const pma_vectorset *owner, size_type slot)
+            : owner(owner), slot(slot)
+        { /* empty */ }
+
+        const pma_vectorset *owner;
+        size_type slot;
+    };
+
+    using iterator = const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+
+#if _VECTOR_SET_DO_TRACE == 1
+    // Debug informations
+
+    /**
+     * get debug trace messages of class.
+     */
+    const _Vectorset_Trace &
+    getDebugTrace() const noexcept {
+        return traceElements;
+    }
+
+    /**
+     * remove all trace log elements.
+     */
+    void
+    clearDebugTrace() {
+        traceElements.clear();
+    }
+
+private:
+
+    mutable _Vectorset_Trace traceElements;
+#endif
+
+private:
+    using count_vector =
+        std::vector<
+            size_type,
+            typename std::allocator_traits<Allocator>
+            ::template rebind_alloc<size_type>>;
+
+    /// Minimal number of slots in a segment.
+    static constexpr size_type min_segment_size = 8;
+
+    /// Minimal number of segments.
+    static constexpr size_type min_segments = 4;
+
+    /// slots of the array (used and gaps).
+    vector_type slots;
+
+    /// number of used slots per segment (packed at segment start).
+    count_vector segCount;
+
+    /// number of slots per segment (power of two).
+    size_type segSize = 0;
+
+    /// number of elements.
+    size_type numElems = 0;
+
+    /// compare method
+    Compare comp;
+
+
+    /// Number of segments.
+    size_type
+    num_segments() const {
+        return segCount.size();
+    }
+
+    /// Height of window tree (log2 of number of segments).
+    size_type
+    height() const {
+        size_type result = 0;
+        while ((size_type(1) << result) < num_segments()) {
+            ++result;
+        }
+
+        return result;
+    }
+
+    /**
+     * Upper density threshold of a window.
+     *
+     * From 1.0 (segment) to 0.75 (whole array).
+     */
+    double
+    upper_density(size_type level) const {
+        return 1.0 - 0.25 * double(level) / double(height());
+    }
+
+    /**
+     * Lower density threshold of a window.
+     *
+     * From 0.125 (segment) to 0.25 (whole array).
+     */
+    double
+    lower_density(size_type level) const {
+        return 0.125 + 0.125 * double(level) / double(height());
+    }
+
+    /// First segment, which is not empty at or after `seg`.
+    size_type
+    next_used_segment(size_type seg) const {
+        while (seg < num_segments() && segCount[seg] == 0) {
+            ++seg;
+        }
+
+        return seg;
+    }
+
+    /// Slot of element after `slot`.
+    size_type
+    next_slot(size_type slot) const {
+        auto seg = slot / segSize;
+
+        if (slot % segSize + 1 < segCount[seg]) {
+            return slot + 1;
+        }
+
+        seg = next_used_segment(seg + 1);
+
+        return (seg < num_segments() ? seg * segSize : slots.size());
+    }
+
+    /// Slot of element before `slot`.
+    size_type
+    prev_slot(size_type slot) const {
+        auto seg = slot / segSize;
+
+        if (slot < slots.size() && slot % segSize != 0) {
+            return slot - 1;
+        }
+
+        do {
+            --seg;
+        } while (segCount[seg] == 0);
+
+        return seg * segSize + segCount[seg] - 1;
+    }
+
+    /// Slot of first element of segment `seg` or later.
+    size_type
+    segment_begin_slot(size_type seg) const {
+        seg = next_used_segment(seg);
+
+        return (seg < num_segments() ? seg * segSize : slots.size());
+    }
+
+    /// First slot of segment `seg`.
+    typename vector_type::const_iterator
+    segment_begin(size_type seg) const {
+        return std::next(slots.begin(), seg * segSize);
+    }
+
+    /// Slot after the last used slot of segment `seg`.
+    typename vector_type::const_iterator
+    segment_end(size_type seg) const {
+        return std::next(slots.begin(), seg * segSize + segCount[seg]);
+    }
+
+
+    /**
+     * Find segment for a key.
+     *
+     * @param key Key to search for.
+     *
+     * @return The last used segment with a first element not greater
+     *         than `key`. If all first elements are greater than `key`
+     *         the first used segment. If all segments are empty `0`.
+     */
+    size_type
+    find_segment(const Key &key) const {
+        size_type lower = 0;
+        size_type upper = num_segments();
+        size_type result = num_segments();
+
+        while (lower < upper) {
+            auto mid = lower + (upper - lower) / 2;
+            auto used = mid;
+
+            while (used > lower && segCount[used] == 0) {
+                --used;
+            }
+
+            if (segCount[used] == 0) {
+                // [lower, mid] is empty
+                lower = mid + 1;
+            }
+            else if (comp(key, slots[used * segSize])) {
+                upper = used;
+            }
+            else {
+                result = used;
+                lower = mid + 1;
+            }
+        }
+
+        if (result == num_segments()) {
+            result = next_used_segment(0);
+        }
+
+        return (result == num_segments() ? 0 : result);
+    }
+
+
+    /**
+     * Move all elements of a window into a vector.
+     *
+     * @param firstSeg First segment of window.
+     * @param numSegs Number of segments of window.
+     * @param target Vector to append the elements to.
+     */
+    void
+    collect(size_type firstSeg, size_type numSegs, vector_type *target) {
+        for (auto seg = firstSeg; seg < firstSeg + numSegs; ++seg) {
+            auto first = std::next(slots.begin(), seg * segSize);
+
+            target->insert(
+                target->end(),
+                std::make_move_iterator(first),
+                std::make_move_iterator(std::next(first, segCount[seg])));
+            segCount[seg] = 0;
+        }
+    }
+
+
+    /**
+     * Spread elements evenly over the segments of a window.
+     *
+     * @param firstSeg First segment of window.
+     * @param numSegs Number of segments of window.
+     * @param source Elements to distribute (sorted).
+     * @param tracked Index of an element in `source`.
+     *
+     * @return Slot of the element `tracked` or `slots.size()`, if
+     *         `tracked` is not an index of `source`.
+     */
+    size_type
+    distribute(
+        size_type firstSeg, size_type numSegs,
+        vector_type *source, size_type tracked)
+    {
+        _VECTOR_SET_TRACE_SET_NAME("distribute(...)");
+        _VECTOR_SET_TRACE_INT("segments", numSegs);
+
+        auto result = slots.size();
+        auto base = source->size() / numSegs;
+        auto extra = source->size() % numSegs;
+        size_type srcPos = 0;
+
+        for (size_type idx = 0; idx < numSegs; ++idx) {
+            auto seg = firstSeg + idx;
+
+            // spread extra elements over the window.
+            auto cnt = base + (((idx + 1) * extra) / numSegs
+                               - (idx * extra) / numSegs);
+
+            for (size_type off = 0; off < cnt; ++off, ++srcPos) {
+                if (srcPos == tracked) {
+                    result = seg * segSize + off;
+                }
+                slots[seg * segSize + off] = std::move((*source)[srcPos]);
+            }
+
+            segCount[seg] = cnt;
+        }
+
+        return result;
+    }
+
+
+    /**
+     * Rebuild array with new number of slots.
+     *
+     * @param source All elements (sorted).
+     * @param tracked Index of an element in `source`.
+     *
+     * @return Slot of the element `tracked`.
+     */
+    size_type
+    rebuild(vector_type *source, size_type tracked) {
+        _VECTOR_SET_TRACE_SET_NAME("rebuild(...)");
+
+        // target density 0.5
+        size_type newSegSize = min_segment_size;
+        size_type newSlots = newSegSize * min_segments;
+
+        while (newSlots < 2 * source->size()) {
+            newSlots *= 2;
+
+            size_type log2Slots = 0;
+            while ((size_type(1) << log2Slots) < newSlots) {
+                ++log2Slots;
+            }
+            while (newSegSize < log2Slots) {
+                newSegSize *= 2;
+            }
+        }
+
+        _VECTOR_SET_TRACE_INT("slots", newSlots);
+
+        vector_type newSlotVec(newSlots, Key(), slots.get_allocator());
+
+        slots.swap(newSlotVec);
+        segSize = newSegSize;
+        segCount.assign(newSlots / newSegSize, 0);
+        numElems = source->size();
+
+        return distribute(0, num_segments(), source, tracked);
+    }
+
+
+    /**
+     * Number of elements in a window.
+     */
+    size_type
+    window_count(size_type firstSeg, size_type numSegs) const {
+        size_type result = 0;
+        for (auto seg = firstSeg; seg < firstSeg + numSegs; ++seg) {
+            result += segCount[seg];
+        }
+
+        return result;
+    }
+
+
+    /**
+     * Insert value into full segment (rebalance window).
+     *
+     * @param seg Segment of value.
+     * @param offset Position of value in segment.
+     * @param value Value to insert.
+     *
+     * @return Slot of inserted value.
+     */
+    template<class ValType>
+    size_type
+    insert_rebalance(size_type seg, size_type offset, ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME("insert_rebalance(...)");
+
+        auto h = height();
+        vector_type window(slots.get_allocator());
+
+        for (size_type level = 1; level <= h; ++level) {
+            auto numSegs = size_type(1) << level;
+            auto firstSeg = seg & ~(numSegs - 1);
+            auto cnt = window_count(firstSeg, numSegs) + 1;
+
+            if (double(cnt) <= upper_density(level) * numSegs * segSize) {
+                _VECTOR_SET_TRACE_INT("level", level);
+
+                auto tracked =
+                    window_count(firstSeg, seg - firstSeg) + offset;
+
+                window.reserve(cnt);
+                collect(firstSeg, numSegs, &window);
+                window.insert(
+                    std::next(window.begin(), tracked),
+                    std::forward<ValType>(value));
+                ++numElems;
+
+                return distribute(firstSeg, numSegs, &window, tracked);
+            }
+        }
+
+        _VECTOR_SET_TRACE("grow");
+
+        auto tracked = window_count(0, seg) + offset;
+
+        window.reserve(numElems + 1);
+        collect(0, num_segments(), &window);
+        window.insert(
+            std::next(window.begin(), tracked),
+            std::forward<ValType>(value));
+
+        return rebuild(&window, tracked);
+    }
+
+
+    /**
+     * Rebalance after an element of segment has been erased.
+     *
+     * @param seg Segment of erased element.
+     * @param tracked Slot of an element to track.
+     *
+     * @return New slot of `tracked`.
+     */
+    size_type
+    erase_rebalance(size_type seg, size_type tracked) {
+        _VECTOR_SET_TRACE_SET_NAME("erase_rebalance(...)");
+
+        if (double(segCount[seg]) >= lower_density(0) * segSize) {
+            return tracked;
+        }
+
+        auto h = height();
+        vector_type window(slots.get_allocator());
+
+        for (size_type level = 1; level <= h; ++level) {
+            auto numSegs = size_type(1) << level;
+            auto firstSeg = seg & ~(numSegs - 1);
+            auto cnt = window_count(firstSeg, numSegs);
+
+            if (double(cnt) >= lower_density(level) * numSegs * segSize
+                || (level == h && num_segments() * segSize
+                    <= min_segment_size * min_segments))
+            {
+                _VECTOR_SET_TRACE_INT("level", level);
+
+                auto trackedIdx = slots.size();
+                auto trackedSeg = tracked / segSize;
+
+                if (trackedSeg >= firstSeg
+                    && trackedSeg < firstSeg + numSegs)
+                {
+                    trackedIdx =
+                        window_count(firstSeg, trackedSeg - firstSeg)
+                        + tracked % segSize;
+                }
+
+                window.reserve(cnt);
+                collect(firstSeg, numSegs, &window);
+
+                auto result =
+                    distribute(firstSeg, numSegs, &window, trackedIdx);
+
+                return (trackedIdx == slots.size() ? tracked : result);
+            }
+        }
+
+        _VECTOR_SET_TRACE("shrink");
+
+        auto trackedIdx =
+            (tracked == slots.size()
+             ? numElems
+             : window_count(0, tracked / segSize) + tracked % segSize);
+
+        window.reserve(numElems);
+        collect(0, num_segments(), &window);
+
+        auto result = rebuild(&window, trackedIdx);
+
+        return (trackedIdx == numElems ? slots.size() : result);
+    }
+
+
+    /**
+     * Erase element in slot.
+     *
+     * @param slot Slot of element.
+     *
+     * @return Slot of element after erased element.
+     */
+    size_type
+    erase_slot(size_type slot) {
+        auto seg = slot / segSize;
+        auto segFirst = std::next(slots.begin(), seg * segSize);
+
+        std::move(
+            std::next(slots.begin(), slot + 1),
+            std::next(segFirst, segCount[seg]),
+            std::next(slots.begin(), slot));
+
+        --segCount[seg];
+        --numElems;
+
+        auto next =
+            (slot % segSize < segCount[seg]
+             ? slot
+             : segment_begin_slot(seg + 1));
+
+        return erase_rebalance(seg, next);
+    }
+
+
+    /**
+     * Insert value.
+     *
+     * @param value Value to insert.
+     *
+     * @return result pair: iterator to inserted value and flag, if
+     *         values has been inserted.
+     */
+    template<class ValType>
+    std::pair<iterator, bool>
+    impl_insert(ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_insert(ValType&&)");
+        _VECTOR_SET_TRACE("start");
+
+        if (slots.empty()) {
+            _VECTOR_SET_TRACE("init");
+
+            vector_type source(slots.get_allocator());
+            source.push_back(std::forward<ValType>(value));
+
+            return std::make_pair(iterator(this, rebuild(&source, 0)), true);
+        }
+
+        auto seg = find_segment(value);
+        auto first = segment_begin(seg);
+        auto last = segment_end(seg);
+        auto iter = std::lower_bound(first, last, value, comp);
+
+        if (iter != last && !comp(value, *iter)) {
+            _VECTOR_SET_TRACE("found-no-insert");
+
+            return std::make_pair(
+                iterator(this, std::distance(slots.cbegin(), iter)), false);
+        }
+
+        auto offset = size_type(std::distance(first, iter));
+
+        if (segCount[seg] < segSize) {
+            _VECTOR_SET_TRACE("insert-segment");
+
+            auto slot = seg * segSize + offset;
+            auto segBegin = std::next(slots.begin(), seg * segSize);
+
+            std::move_backward(
+                std::next(segBegin, offset),
+                std::next(segBegin, segCount[seg]),
+                std::next(segBegin, segCount[seg] + 1));
+            slots[slot] = std::forward<ValType>(value);
+
+            ++segCount[seg];
+            ++numElems;
+
+            return std::make_pair(iterator(this, slot), true);
+        }
+
+        _VECTOR_SET_TRACE("segment-full");
+
+        auto slot = insert_rebalance(seg, offset, std::forward<ValType>(value));
+
+        return std::make_pair(iterator(this, slot), true);
+    }
+
+
+    /**
+     * Slot of lower or upper bound.
+     */
+    size_type
+    bound_slot(const Key &key, bool lowerBound) const {
+        if (numElems == 0) {
+            return slots.size();
+        }
+
+        auto seg = find_segment(key);
+        auto first = segment_begin(seg);
+        auto last = segment_end(seg);
+        auto iter =
+            (lowerBound
+             ? std::lower_bound(first, last, key, comp)
+             : std::upper_bound(first, last, key, comp));
+
+        if (iter == last) {
+            return segment_begin_slot(seg + 1);
+        }
+
+        return std::distance(slots.cbegin(), iter);
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /**
+     * Default constructor.
+     *
+     * Constructs empty container.
+     */
+    pma_vectorset() : comp(Compare()) {
+        /* empty */
+    }
+
+    /**
+     * Construct empty container (comparator / allocator).
+     *
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    pma_vectorset(const Compare& comp, const Allocator& alloc = Allocator())
+        : slots(alloc), segCount(alloc), comp(comp)
+    {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    pma_vectorset(const Allocator& alloc)
+        : pma_vectorset(Compare(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor (comparator / allocator).
+     *
+     * The range is sorted once and distributed over the array.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<class InputIt>
+    pma_vectorset(
+        InputIt first, InputIt last,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : slots(alloc), segCount(alloc), comp(comp)
+    {
+        vector_type source(first, last, alloc);
+
+        std::sort(source.begin(), source.end(), this->comp);
+        auto rmIter =
+            std::unique(
+                source.begin(), source.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return !(this->comp(lhv, rhv) || this->comp(rhv, lhv));
+                });
+        source.erase(rmIter, source.end());
+
+        if (!source.empty()) {
+            rebuild(&source, source.size());
+        }
+    }
+
+    /**
+     * Initializer-list constructor (comparator / allocator).
+     *
+     * @param init Initializer-list to copy.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    pma_vectorset(
+        std::initializer_list<value_type> init,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : pma_vectorset(init.begin(), init.end(), comp, alloc)
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Miscellaneous
+
+    /// @{
+
+    /**
+     * Get allocator associated with the container.
+     *
+     * @return allocator.
+     */
+    allocator_type
+    get_allocator() const noexcept {
+        return slots.get_allocator();
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    const_iterator
+    begin() const noexcept {
+        return cbegin();
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const noexcept {
+        return const_iterator(
+            this, (slots.empty() ? 0 : segment_begin_slot(0)));
+    }
+
+    /// Iterator to the end.
+    const_iterator
+    end() const noexcept {
+        return cend();
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const noexcept {
+        return const_iterator(this, slots.size());
+    }
+
+    /// Reverse iterator to the beginning.
+    const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    /// Reverse iterator to the end.
+    const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return (numElems == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return numElems;
+    }
+
+    /// Maximum possible number of elements .
+    size_type
+    max_size() const noexcept {
+        return slots.max_size() / 2;
+    }
+
+    /// Number of slots (used and gaps) of the array.
+    size_type
+    capacity() const noexcept {
+        return slots.size();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Clears the contents.
+     */
+    void
+    clear() noexcept {
+        slots.clear();
+        segCount.clear();
+        segSize = 0;
+        numElems = 0;
+    }
+
+    /**
+     * Inserts new element (copy), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to copy.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(const value_type& value) {
+        return impl_insert(value);
+    }
+
+    /**
+     * Inserts new element (move), if the container does not already
+     * contains the value.
+     *
+     * @param value Value to move.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(value_type&& value) {
+        return impl_insert(std::move(value));
+    }
+
+    /**
+     * Inserts elements from range [first, last).
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            impl_insert(*first);
+        }
+    }
+
+    /**
+     * Constructs element in-place.
+     *
+     * @param args Arguments to forward to the constructor of the element.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         new element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator,bool>
+    emplace(Args&&... args) {
+        return impl_insert(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Erase element at position.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_ASSERT(pos.owner == this && pos.slot < slots.size());
+
+        return iterator(this, erase_slot(pos.slot));
+    }
+
+    /**
+     * Erase element by key.
+     *
+     * @param key Key value of the element to remove.
+     *
+     * @return Number of elements removed (0 or 1).
+     */
+    size_type
+    erase(const Key& key) {
+        auto iter = find(key);
+
+        if (iter == end()) {
+            return 0;
+        }
+
+        erase_slot(iter.slot);
+        return 1;
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(pma_vectorset& other) noexcept {
+        slots.swap(other.slots);
+        segCount.swap(other.segCount);
+        std::swap(segSize, other.segSize);
+        std::swap(numElems, other.numElems);
+        std::swap(comp, other.comp);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of elements matching specific key.
+     *
+     * @param key Key value of the elements to count.
+     *
+     * @return number of elements with key (0 or 1).
+     */
+    size_type
+    count(const Key& key) const {
+        return (contains(key) ? 1 : 0);
+    }
+
+    /**
+     * Find element matches key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return iterator to matched element or `end()`, if no matching
+     *         value is found.
+     */
+    const_iterator
+    find(const Key& key) const {
+        auto slot = bound_slot(key, true);
+
+        return ((slot == slots.size() || comp(key, slots[slot]))
+                ? end()
+                : const_iterator(this, slot));
+    }
+
+    /**
+     * Checks if the container contains element with specific key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(const Key& key) const {
+        return (find(key) != end());
+    }
+
+    /**
+     * Iterator to the first element not less than the given key.
+     *
+     * @param key Key to get lower bound iterator for.
+     *
+     * @return Iterator to the first element not less than the given key.
+     */
+    const_iterator
+    lower_bound(const Key& key) const {
+        return const_iterator(this, bound_slot(key, true));
+    }
+
+    /**
+     * Iterator to the first element greater than the given key.
+     *
+     * @param key Key to get upper bound iterator for.
+     *
+     * @return Iterator to the first element greater than the given key.
+     */
+    const_iterator
+    upper_bound(const Key& key) const {
+        return const_iterator(this, bound_slot(key, false));
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /**
+     * Get function object that compares the keys.
+     *
+     * @return Function object that compares the keys.
+     */
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+    /**
+     * Get function object that compares the values.
+     *
+     * It is the same as `key_comp.`
+     *
+     * @return Function object that compares the values.
+     */
+    value_compare
+    value_comp() const {
+        return comp;
+    }
+
+    /// @}
+
+}; // class pma_vectorset
+
+
+template<class Key, class Compare, class Allocator>
+constexpr typename pma_vectorset<Key, Compare, Allocator>::size_type
+pma_vectorset<Key, Compare, Allocator>::min_segment_size;
+
+template<class Key, class Compare, class Allocator>
+constexpr typename pma_vectorset<Key, Compare, Allocator>::size_type
+pma_vectorset<Key, Compare, Allocator>::min_segments;
+
+
+/**
+ * Equal operator of `pma_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator==(
+    const pma_vectorset<T, Compare, Alloc>& lhs,
+    const pma_vectorset<T, Compare, Alloc>& rhs)
+{
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+/**
+ * Not equal operator of `pma_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class T, class Compare, class Alloc>
+inline bool
+operator!=(
+    const pma_vectorset<T, Compare, Alloc>& lhs,
+    const pma_vectorset<T, Compare, Alloc>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+#endif /* PMA_VECTOR_SET_H */
@@ -0,0 +1,1317 @@
+//
+// Chunked set of 32 bit integers (roaring bitmap).
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Unique ordered set of uint32_t keys in chunks of 2^16 keys, each
+// stored as sorted array, bitmap or list of runs.
+
+#ifndef VECTOR_SET_ROARING_H
+#define VECTOR_SET_ROARING_H
+
+#include "vectorset_algo.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/// Representation of a chunk of `roaring_vectorset`.
+enum class roaring_chunk : uint8_t {
+    /// Sorted array of the low 16 bits (at most 4096 elements).
+    array,
+
+    /// Bitmap of 2^16 bits.
+    bitmap,
+
+    /// Sorted list of runs (first and last low 16 bits).
+    runs
+};
+
+
+/**
+ * Unique ordered set of `uint32_t` keys (roaring bitmap).
+ *
+ * The key space is split by the high 16 bits of the keys into chunks
+ * of 2^16 keys. The high bits of the used chunks are kept in a sorted
+ * vector, each chunk stores the low 16 bits of its keys in the
+ * smallest of three representations:
+ *
+ * - a sorted array (2 bytes per key, at most `array_limit` keys),
+ * - a bitmap (8 KiB),
+ * - a sorted list of runs (4 bytes per run of consecutive keys).
+ *
+ * An array chunk becomes a bitmap, if it grows over `array_limit`,
+ * and a bitmap becomes an array (or runs), if it shrinks to
+ * `array_limit`. A run chunk is converted, if it needs more memory
+ * than an array or a bitmap. Chunks built at once (range
+ * constructor, set operations) always use the smallest
+ * representation.
+ *
+ * The container provides the interface of an unique ordered
+ * `vectorset<uint32_t>` (without random access). Its iterators are
+ * constant forward iterators.
+ */
+class roaring_vectorset {
+public:
+
+    using key_type = uint32_t;
+    using value_type = uint32_t;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = std::less<uint32_t>;
+    using value_compare = std::less<uint32_t>;
+
+    /// Maximal number of keys of an array chunk.
+    static constexpr uint32_t array_limit = 4096;
+
+    /// Number of 64 bit words of a bitmap chunk.
+    static constexpr uint32_t bitmap_words = 1024;
+
+private:
+
+    /// Keys of one chunk (low 16 bits).
+    struct chunk {
+        roaring_chunk type = roaring_chunk::array;
+
+        /// Number of keys in the chunk.
+        uint32_t card = 0;
+
+        /// Sorted keys (array) or pairs of first and last key (runs).
+        std::vector<uint16_t> data;
+
+        /// Bitmap (`bitmap_words` words).
+        std::vector<uint64_t> bits;
+    };
+
+    using bitmap_vector = std::vector<uint64_t>;
+
+    /// Sorted high 16 bits of the chunks.
+    std::vector<uint16_t> highs;
+
+    /// Chunks (same order as `highs`).
+    std::vector<chunk> chunks;
+
+    /// Number of elements.
+    size_type numElems = 0;
+
+public:
+
+    /**
+     * Constant forward iterator of `roaring_vectorset`.
+     *
+     * The iterator stores the index of the chunk, the position in the
+     * chunk (array index or run index) and the key.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = uint32_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint32_t*;
+        using reference = const uint32_t&;
+
+        const_iterator() = default;
+
+        reference
+        operator*() const {
+            return value;
+        }
+
+        pointer
+        operator->() const {
+            return &value;
+        }
+
+        const_iterator &
+        operator++() {
+            owner->advance(*this);
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        friend bool
+        operator==(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.chunkIdx == rhs.chunkIdx && lhs.value == rhs.value);
+        }
+
+        friend bool
+        operator!=(const const_iterator &lhs, const const_iterator &rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class roaring_vectorset;
+
+        const roaring_vectorset *owner = nullptr;
+        size_type chunkIdx = 0;
+        uint32_t pos = 0;
+        uint32_t value = 0;
+    };
+
+    using iterator = const_iterator;
+
+private:
+
+    /// Number of runs of a run chunk.
+    static size_type
+    run_count(const chunk &c) noexcept {
+        return c.data.size() / 2;
+    }
+
+    /// Number of runs of `c`, which start at or before `low`.
+    static size_type
+    runs_before(const chunk &c, uint32_t low) noexcept {
+        size_type first = 0;
+        size_type last = run_count(c);
+
+        while (first < last) {
+            auto mid = first + (last - first) / 2;
+
+            if (c.data[2 * mid] <= low) {
+                first = mid + 1;
+            }
+            else {
+                last = mid;
+            }
+        }
+
+        return first;
+    }
+
+    /// Checks if a run chunk is smaller than an array or bitmap.
+    static bool
+    use_runs(size_type card, size_type runs) noexcept {
+        return (4 * runs < std::min<size_type>(2 * card, 8 * bitmap_words));
+    }
+
+    /**
+     * First bit equal to `set` at or after `low` in a bitmap.
+     *
+     * @return Position of the bit or 2^16, if not found.
+     */
+    static uint32_t
+    next_bit(const bitmap_vector &words, uint32_t low, bool set) noexcept {
+        if (low >= 64 * bitmap_words) {
+            return 64 * bitmap_words;
+        }
+
+        auto flip = set ? uint64_t(0) : ~uint64_t(0);
+        auto word = low / 64;
+        auto bits = (words[word] ^ flip) & (~uint64_t(0) << (low % 64));
+
+        while (bits == 0) {
+            if (++word == bitmap_words) {
+                return 64 * bitmap_words;
+            }
+            bits = words[word] ^ flip;
+        }
+
+        return word * 64 + _vectorset_select64(bits, 0);
+    }
+
+    /// Checks if chunk `c` contains `low`.
+    static bool
+    chunk_contains(const chunk &c, uint32_t low) {
+        switch (c.type) {
+        case roaring_chunk::array:
+            return std::binary_search(c.data.begin(), c.data.end(), low);
+
+        case roaring_chunk::bitmap:
+            return ((c.bits[low / 64] >> (low % 64)) & 1) != 0;
+
+        case roaring_chunk::runs: {
+            auto run = runs_before(c, low);
+
+            return (run > 0 && c.data[2 * run - 1] >= low);
+        }
+        }
+
+        return false;
+    }
+
+    /**
+     * Find first key of chunk `c` not less than `low`.
+     *
+     * @param c Chunk to search.
+     * @param low Low bits to search for (up to 2^16).
+     * @param pos Position of the found key (array or run index).
+     * @param found Found key.
+     *
+     * @return `true`, if a key is found.
+     */
+    static bool
+    chunk_seek(const chunk &c, uint32_t low, uint32_t &pos, uint32_t &found) {
+        switch (c.type) {
+        case roaring_chunk::array: {
+            auto iter = std::lower_bound(c.data.begin(), c.data.end(), low);
+
+            if (iter == c.data.end()) {
+                return false;
+            }
+            pos = static_cast<uint32_t>(iter - c.data.begin());
+            found = *iter;
+            return true;
+        }
+
+        case roaring_chunk::bitmap:
+            found = next_bit(c.bits, low, true);
+            pos = 0;
+            return (found < 64 * bitmap_words);
+
+        case roaring_chunk::runs: {
+            auto run = runs_before(c, low);
+
+            if (run > 0 && c.data[2 * run - 1] >= low) {
+                pos = static_cast<uint32_t>(run - 1);
+                found = low;
+                return true;
+            }
+            if (run < run_count(c)) {
+                pos = static_cast<uint32_t>(run);
+                found = c.data[2 * run];
+                return true;
+            }
+            return false;
+        }
+        }
+
+        return false;
+    }
+
+    /// Step to the next key of chunk `c` (`false` at end of chunk).
+    static bool
+    chunk_next(const chunk &c, uint32_t &pos, uint32_t &low) {
+        switch (c.type) {
+        case roaring_chunk::array:
+            if (pos + 1 < c.card) {
+                low = c.data[++pos];
+                return true;
+            }
+            return false;
+
+        case roaring_chunk::bitmap:
+            return chunk_seek(c, low + 1, pos, low);
+
+        case roaring_chunk::runs:
+            if (low < c.data[2 * pos + 1]) {
+                ++low;
+                return true;
+            }
+            if (pos + 1 < run_count(c)) {
+                low = c.data[2 * ++pos];
+                return true;
+            }
+            return false;
+        }
+
+        return false;
+    }
+
+    /// Bitmap of the keys of chunk `c`.
+    static void
+    chunk_bitmap(const chunk &c, bitmap_vector &words) {
+        if (c.type == roaring_chunk::bitmap) {
+            words = c.bits;
+            return;
+        }
+
+        words.assign(bitmap_words, 0);
+
+        if (c.type == roaring_chunk::array) {
+            for (auto low : c.data) {
+                words[low / 64] |= uint64_t(1) << (low % 64);
+            }
+        }
+        else {
+            for (size_type run = 0; run < run_count(c); ++run) {
+                for (uint32_t low = c.data[2 * run];
+                     low <= c.data[2 * run + 1];
+                     ++low)
+                {
+                    words[low / 64] |= uint64_t(1) << (low % 64);
+                }
+            }
+        }
+    }
+
+    /// Chunk with the smallest representation of sorted unique keys.
+    static chunk
+    chunk_from_sorted(std::vector<uint16_t> &&lows) {
+        chunk result;
+        size_type runs = 0;
+
+        for (size_type idx = 0; idx < lows.size(); ++idx) {
+            if (idx == 0 || lows[idx] != lows[idx - 1] + 1) {
+                ++runs;
+            }
+        }
+
+        result.card = static_cast<uint32_t>(lows.size());
+
+        if (use_runs(lows.size(), runs)) {
+            result.type = roaring_chunk::runs;
+            result.data.reserve(2 * runs);
+            for (size_type idx = 0; idx < lows.size(); ++idx) {
+                if (idx == 0 || lows[idx] != lows[idx - 1] + 1) {
+                    if (idx > 0) {
+                        result.data.push_back(lows[idx - 1]);
+                    }
+                    result.data.push_back(lows[idx]);
+                }
+            }
+            result.data.push_back(lows.back());
+        }
+        else if (lows.size() <= array_limit) {
+            result.type = roaring_chunk::array;
+            result.data = std::move(lows);
+        }
+        else {
+            result.type = roaring_chunk::bitmap;
+            result.bits.assign(bitmap_words, 0);
+            for (auto low : lows) {
+                result.bits[low / 64] |= uint64_t(1) << (low % 64);
+            }
+        }
+
+        return result;
+    }
+
+    /// Chunk with the smallest representation of a bitmap.
+    static chunk
+    chunk_from_bitmap(bitmap_vector &&words) {
+        chunk result;
+        size_type card = 0;
+        size_type runs = 0;
+        uint64_t carry = 0;
+
+        for (auto bits : words) {
+            card += _vectorset_popcount64(bits);
+            runs += _vectorset_popcount64(bits & ~((bits << 1) | carry));
+            carry = bits >> 63;
+        }
+
+        result.card = static_cast<uint32_t>(card);
+
+        if (use_runs(card, runs)) {
+            result.type = roaring_chunk::runs;
+            result.data.reserve(2 * runs);
+            for (auto low = next_bit(words, 0, true);
+                 low < 64 * bitmap_words;
+                 low = next_bit(words, low, true))
+            {
+                result.data.push_back(static_cast<uint16_t>(low));
+                low = next_bit(words, low, false);
+                result.data.push_back(static_cast<uint16_t>(low - 1));
+            }
+        }
+        else if (card <= array_limit) {
+            result.type = roaring_chunk::array;
+            result.data.reserve(card);
+            for (auto low = next_bit(words, 0, true);
+                 low < 64 * bitmap_words;
+                 low = next_bit(words, low + 1, true))
+            {
+                result.data.push_back(static_cast<uint16_t>(low));
+            }
+        }
+        else {
+            result.type = roaring_chunk::bitmap;
+            result.bits = std::move(words);
+        }
+
+        return result;
+    }
+
+    /// Convert chunk `c` to its smallest representation.
+    static void
+    chunk_optimize(chunk &c) {
+        bitmap_vector words;
+
+        chunk_bitmap(c, words);
+        c = chunk_from_bitmap(std::move(words));
+    }
+
+    /// Convert run chunk `c`, if an array or bitmap is smaller.
+    static void
+    chunk_check_runs(chunk &c) {
+        if (!use_runs(c.card, run_count(c))) {
+            chunk_optimize(c);
+        }
+    }
+
+    /// Insert `low` into chunk `c` (`false` if already contained).
+    static bool
+    chunk_insert(chunk &c, uint32_t low) {
+        switch (c.type) {
+        case roaring_chunk::array: {
+            auto iter = std::lower_bound(c.data.begin(), c.data.end(), low);
+
+            if (iter != c.data.end() && *iter == low) {
+                return false;
+            }
+
+            if (c.card < array_limit) {
+                c.data.insert(iter, static_cast<uint16_t>(low));
+                ++c.card;
+                return true;
+            }
+
+            // array is full: convert to bitmap
+            bitmap_vector words;
+
+            chunk_bitmap(c, words);
+            words[low / 64] |= uint64_t(1) << (low % 64);
+            c = chunk_from_bitmap(std::move(words));
+            return true;
+        }
+
+        case roaring_chunk::bitmap: {
+            auto &word = c.bits[low / 64];
+            auto mask = uint64_t(1) << (low % 64);
+
+            if ((word & mask) != 0) {
+                return false;
+            }
+            word |= mask;
+            ++c.card;
+            return true;
+        }
+
+        case roaring_chunk::runs: {
+            auto run = runs_before(c, low);
+
+            if (run > 0 && c.data[2 * run - 1] >= low) {
+                return false;
+            }
+
+            auto joinPrev = (run > 0 && c.data[2 * run - 1] + 1u == low);
+            auto joinNext = (run < run_count(c) && c.data[2 * run] == low + 1);
+
+            if (joinPrev && joinNext) {
+                c.data[2 * run - 1] = c.data[2 * run + 1];
+                c.data.erase(
+                    c.data.begin() + 2 * run, c.data.begin() + 2 * run + 2);
+            }
+            else if (joinPrev) {
+                c.data[2 * run - 1] = static_cast<uint16_t>(low);
+            }
+            else if (joinNext) {
+                c.data[2 * run] = static_cast<uint16_t>(low);
+            }
+            else {
+                c.data.insert(c.data.begin() + 2 * run, 2,
+                              static_cast<uint16_t>(low));
+            }
+
+            ++c.card;
+            chunk_check_runs(c);
+            return true;
+        }
+        }
+
+        return false;
+    }
+
+    /// Erase `low` from chunk `c` (`false` if not contained).
+    static bool
+    chunk_erase(chunk &c, uint32_t low) {
+        switch (c.type) {
+        case roaring_chunk::array: {
+            auto iter = std::lower_bound(c.data.begin(), c.data.end(), low);
+
+            if (iter == c.data.end() || *iter != low) {
+                return false;
+            }
+            c.data.erase(iter);
+            --c.card;
+            return true;
+        }
+
+        case roaring_chunk::bitmap: {
+            auto &word = c.bits[low / 64];
+            auto mask = uint64_t(1) << (low % 64);
+
+            if ((word & mask) == 0) {
+                return false;
+            }
+            word &= ~mask;
+            if (--c.card <= array_limit) {
+                chunk_optimize(c);
+            }
+            return true;
+        }
+
+        case roaring_chunk::runs: {
+            auto run = runs_before(c, low);
+
+            if (run == 0 || c.data[2 * run - 1] < low) {
+                return false;
+            }
+
+            auto &first = c.data[2 * run - 2];
+            auto &last = c.data[2 * run - 1];
+
+            if (first == last) {
+                c.data.erase(
+                    c.data.begin() + 2 * run - 2, c.data.begin() + 2 * run);
+            }
+            else if (first == low) {
+                ++first;
+            }
+            else if (last == low) {
+                --last;
+            }
+            else {
+                // split run
+                uint16_t tail[] = { static_cast<uint16_t>(low + 1), last };
+
+                last = static_cast<uint16_t>(low - 1);
+                c.data.insert(c.data.begin() + 2 * run, tail, tail + 2);
+            }
+
+            --c.card;
+            chunk_check_runs(c);
+            return true;
+        }
+        }
+
+        return false;
+    }
+
+    /**
+     * Set operation on two chunks with the same high bits.
+     *
+     * Two arrays are merged, an array is filtered if the result is a
+     * subset of it, all others are combined as bitmaps.
+     *
+     * @tparam Parts Parts to keep (`vectorset_algo::merge_part` mask).
+     */
+    template<unsigned Parts>
+    static chunk
+    chunk_combine(const chunk &lhs, const chunk &rhs) {
+        using namespace vectorset_algo;
+
+        if (lhs.type == roaring_chunk::array
+            && rhs.type == roaring_chunk::array)
+        {
+            std::vector<uint16_t> lows;
+
+            lows.reserve(
+                (Parts & (only_first | both) ? lhs.card : 0)
+                + (Parts & only_second ? rhs.card : 0));
+            merge_parts<Parts>(
+                lhs.data.begin(), lhs.data.end(),
+                rhs.data.begin(), rhs.data.end(),
+                std::back_inserter(lows), std::less<uint16_t>());
+
+            return chunk_from_sorted(std::move(lows));
+        }
+
+        if (!(Parts & only_second) && lhs.type == roaring_chunk::array) {
+            return chunk_filter(lhs, rhs, Parts & both, Parts & only_first);
+        }
+
+        if (!(Parts & only_first) && rhs.type == roaring_chunk::array) {
+            return chunk_filter(rhs, lhs, Parts & both, Parts & only_second);
+        }
+
+        bitmap_vector lhsWords;
+        bitmap_vector rhsWords;
+
+        chunk_bitmap(lhs, lhsWords);
+        chunk_bitmap(rhs, rhsWords);
+
+        for (uint32_t word = 0; word < bitmap_words; ++word) {
+            auto lhsBits = lhsWords[word];
+            auto rhsBits = rhsWords[word];
+
+            lhsWords[word] =
+                ((Parts & both ? lhsBits & rhsBits : 0)
+                 | (Parts & only_first ? lhsBits & ~rhsBits : 0)
+                 | (Parts & only_second ? rhsBits & ~lhsBits : 0));
+        }
+
+        return chunk_from_bitmap(std::move(lhsWords));
+    }
+
+    /**
+     * Keys of array chunk `source` filtered by chunk `other`.
+     *
+     * @param keepContained Keep keys contained in `other`.
+     * @param keepMissing Keep keys not contained in `other`.
+     */
+    static chunk
+    chunk_filter(
+        const chunk &source, const chunk &other,
+        bool keepContained, bool keepMissing)
+    {
+        std::vector<uint16_t> lows;
+
+        lows.reserve(source.card);
+        for (auto low : source.data) {
+            if (chunk_contains(other, low) ? keepContained : keepMissing) {
+                lows.push_back(low);
+            }
+        }
+
+        return chunk_from_sorted(std::move(lows));
+    }
+
+    /// Append chunk with high bits `high` (greater than all others).
+    void
+    append(uint16_t high, chunk &&c) {
+        numElems += c.card;
+        highs.push_back(high);
+        chunks.push_back(std::move(c));
+    }
+
+    /// Index of the first chunk with high bits not less than `high`.
+    size_type
+    chunk_index(uint32_t high) const {
+        return static_cast<size_type>(
+            std::lower_bound(highs.begin(), highs.end(), high)
+            - highs.begin());
+    }
+
+    /// Iterator to the first key of chunk `chunkIdx` not less than `low`.
+    const_iterator
+    make_iterator(size_type chunkIdx, uint32_t low) const {
+        const_iterator result;
+
+        result.owner = this;
+        for (; chunkIdx < chunks.size(); ++chunkIdx, low = 0) {
+            uint32_t found = 0;
+
+            if (chunk_seek(chunks[chunkIdx], low, result.pos, found)) {
+                result.chunkIdx = chunkIdx;
+                result.value = (uint32_t(highs[chunkIdx]) << 16) | found;
+                return result;
+            }
+        }
+
+        result.chunkIdx = chunks.size();
+        return result;
+    }
+
+    /// Step iterator `iter` to the next key.
+    void
+    advance(const_iterator &iter) const {
+        uint32_t low = iter.value & 0xffff;
+
+        if (chunk_next(chunks[iter.chunkIdx], iter.pos, low)) {
+            iter.value = (iter.value & 0xffff0000) | low;
+        }
+        else {
+            iter = make_iterator(iter.chunkIdx + 1, 0);
+        }
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor (empty set).
+    roaring_vectorset() = default;
+
+    /**
+     * Range constructor.
+     *
+     * The keys are sorted once and split into chunks.
+     *
+     * @param first Input iterator to the first key.
+     * @param last Input iterator after the last key.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    roaring_vectorset(InputIt first, InputIt last) {
+        std::vector<uint32_t> keys(first, last);
+
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        for (auto iter = keys.begin(); iter != keys.end(); ) {
+            auto high = *iter >> 16;
+            std::vector<uint16_t> lows;
+
+            for (; iter != keys.end() && (*iter >> 16) == high; ++iter) {
+                lows.push_back(static_cast<uint16_t>(*iter));
+            }
+
+            append(static_cast<uint16_t>(high),
+                   chunk_from_sorted(std::move(lows)));
+        }
+    }
+
+    /**
+     * Initializer-list constructor.
+     *
+     * @param init Initializer-list to copy.
+     */
+    roaring_vectorset(std::initializer_list<uint32_t> init)
+        : roaring_vectorset(init.begin(), init.end())
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    const_iterator
+    begin() const {
+        return make_iterator(0, 0);
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const {
+        return begin();
+    }
+
+    /// Iterator to the end.
+    const_iterator
+    end() const {
+        return make_iterator(chunks.size(), 0);
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const {
+        return end();
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return (numElems == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return numElems;
+    }
+
+    /// Maximum possible number of elements.
+    size_type
+    max_size() const noexcept {
+        return size_type(1) << 32;
+    }
+
+    /// Number of chunks.
+    size_type
+    chunk_count() const noexcept {
+        return chunks.size();
+    }
+
+    /// Representation of chunk `idx`.
+    roaring_chunk
+    chunk_type(size_type idx) const {
+        return chunks.at(idx).type;
+    }
+
+    /// Memory used by the chunks (bytes).
+    size_type
+    memory_bytes() const noexcept {
+        auto result =
+            highs.capacity() * sizeof(uint16_t)
+            + chunks.capacity() * sizeof(chunk);
+
+        for (const auto &c : chunks) {
+            result +=
+                c.data.capacity() * sizeof(uint16_t)
+                + c.bits.capacity() * sizeof(uint64_t);
+        }
+
+        return result;
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Clears the contents.
+     */
+    void
+    clear() noexcept {
+        highs.clear();
+        chunks.clear();
+        numElems = 0;
+    }
+
+    /**
+     * Inserts new key, if the container does not already contains it.
+     *
+     * @param key Key to insert.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(uint32_t key) {
+        auto high = key >> 16;
+        auto low = key & 0xffff;
+        auto chunkIdx = chunk_index(high);
+        bool inserted = true;
+
+        if (chunkIdx == chunks.size() || highs[chunkIdx] != high) {
+            chunk c;
+
+            c.card = 1;
+            c.data.push_back(static_cast<uint16_t>(low));
+            highs.insert(highs.begin() + chunkIdx, static_cast<uint16_t>(high));
+            chunks.insert(chunks.begin() + chunkIdx, std::move(c));
+        }
+        else {
+            inserted = chunk_insert(chunks[chunkIdx], low);
+        }
+
+        if (inserted) {
+            ++numElems;
+        }
+
+        return {make_iterator(chunkIdx, low), inserted};
+    }
+
+    /**
+     * Inserts keys from range [first, last).
+     *
+     * The keys are collected into chunks and merged chunk by chunk.
+     *
+     * @param first Iterator to first key to insert.
+     * @param last Iterator _after_ last key to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        roaring_vectorset other(first, last);
+
+        if (empty()) {
+            swap(other);
+        }
+        else {
+            *this = combine<
+                vectorset_algo::only_first | vectorset_algo::only_second
+                | vectorset_algo::both>(*this, other);
+        }
+    }
+
+    /**
+     * Inserts keys from initializer list.
+     *
+     * @param ilist Initializer list to insert the values from.
+     */
+    void
+    insert(std::initializer_list<uint32_t> ilist) {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * Constructs key in-place.
+     *
+     * @param args Arguments to forward to the constructor of the key.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         new element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool>
+    emplace(Args&&... args) {
+        return insert(uint32_t(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Erase element by key.
+     *
+     * @param key Key value of the element to remove.
+     *
+     * @return Number of elements removed (0 or 1).
+     */
+    size_type
+    erase(uint32_t key) {
+        auto high = key >> 16;
+        auto chunkIdx = chunk_index(high);
+
+        if (chunkIdx == chunks.size() || highs[chunkIdx] != high
+            || !chunk_erase(chunks[chunkIdx], key & 0xffff))
+        {
+            return 0;
+        }
+
+        if (chunks[chunkIdx].card == 0) {
+            highs.erase(highs.begin() + chunkIdx);
+            chunks.erase(chunks.begin() + chunkIdx);
+        }
+
+        --numElems;
+        return 1;
+    }
+
+    /**
+     * Erase element at position.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_ASSERT(pos.owner == this && pos.chunkIdx < chunks.size());
+
+        auto key = *pos;
+
+        erase(key);
+        return upper_bound(key);
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(roaring_vectorset &other) noexcept {
+        highs.swap(other.highs);
+        chunks.swap(other.chunks);
+        std::swap(numElems, other.numElems);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of elements matching specific key.
+     *
+     * @param key Key value of the elements to count.
+     *
+     * @return number of elements with key (0 or 1).
+     */
+    size_type
+    count(uint32_t key) const {
+        return (contains(key) ? 1 : 0);
+    }
+
+    /**
+     * Find element matches key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return iterator to matched element or `end()`, if no matching
+     *         value is found.
+     */
+    const_iterator
+    find(uint32_t key) const {
+        auto iter = lower_bound(key);
+
+        return ((iter != end() && *iter == key) ? iter : end());
+    }
+
+    /**
+     * Checks if the container contains element with specific key.
+     *
+     * @param key Key value of the element to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(uint32_t key) const {
+        auto high = key >> 16;
+        auto chunkIdx = chunk_index(high);
+
+        return (chunkIdx < chunks.size() && highs[chunkIdx] == high
+                && chunk_contains(chunks[chunkIdx], key & 0xffff));
+    }
+
+    /**
+     * Iterator to the first element not less than the given key.
+     *
+     * @param key Key to get lower bound iterator for.
+     *
+     * @return Iterator to the first element not less than the given key.
+     */
+    const_iterator
+    lower_bound(uint32_t key) const {
+        auto high = key >> 16;
+        auto chunkIdx = chunk_index(high);
+
+        return make_iterator(
+            chunkIdx,
+            ((chunkIdx < chunks.size() && highs[chunkIdx] == high)
+             ? key & 0xffff
+             : 0));
+    }
+
+    /**
+     * Iterator to the first element greater than the given key.
+     *
+     * @param key Key to get upper bound iterator for.
+     *
+     * @return Iterator to the first element greater than the given key.
+     */
+    const_iterator
+    upper_bound(uint32_t key) const {
+        return (key == ~uint32_t(0) ? end() : lower_bound(key + 1));
+    }
+
+    /**
+     * Range of elements equal to `key` (at most one).
+     *
+     * @param key Key value to compare the elements to.
+     *
+     * @return Pair of `lower_bound(key)` and `upper_bound(key)`.
+     */
+    std::pair<const_iterator, const_iterator>
+    equal_range(uint32_t key) const {
+        auto iter = lower_bound(key);
+
+        if (iter != end() && *iter == key) {
+            auto next = iter;
+            return {iter, ++next};
+        }
+
+        return {iter, iter};
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /// Get function object that compares the keys.
+    key_compare
+    key_comp() const {
+        return key_compare();
+    }
+
+    /// Get function object that compares the values.
+    value_compare
+    value_comp() const {
+        return value_compare();
+    }
+
+    /// @}
+
+    /// Copy all elements into an unique ordered `vectorset`.
+    vectorset<uint32_t>
+    to_vectorset() const {
+        std::vector<uint32_t> sorted;
+
+        sorted.reserve(numElems);
+        sorted.assign(begin(), end());
+
+        return vectorset<uint32_t>(vectorset_sorted_unique, std::move(sorted));
+    }
+
+    /**
+     * Set operation chunk by chunk.
+     *
+     * Chunks of only one side are copied, chunks of both sides are
+     * combined by their representations.
+     *
+     * @tparam Parts Parts to keep (`vectorset_algo::merge_part` mask).
+     *
+     * @param lhs Left hand side.
+     * @param rhs Right hand side.
+     *
+     * @return Result of the operation.
+     */
+    template<unsigned Parts>
+    static roaring_vectorset
+    combine(const roaring_vectorset &lhs, const roaring_vectorset &rhs) {
+        using namespace vectorset_algo;
+
+        roaring_vectorset result;
+        size_type lhsIdx = 0;
+        size_type rhsIdx = 0;
+
+        while (lhsIdx < lhs.chunks.size() || rhsIdx < rhs.chunks.size()) {
+            if (rhsIdx == rhs.chunks.size()
+                || (lhsIdx < lhs.chunks.size()
+                    && lhs.highs[lhsIdx] < rhs.highs[rhsIdx]))
+            {
+                if (Parts & only_first) {
+                    result.append(
+                        lhs.highs[lhsIdx], chunk(lhs.chunks[lhsIdx]));
+                }
+                ++lhsIdx;
+            }
+            else if (lhsIdx == lhs.chunks.size()
+                     || rhs.highs[rhsIdx] < lhs.highs[lhsIdx])
+            {
+                if (Parts & only_second) {
+                    result.append(
+                        rhs.highs[rhsIdx], chunk(rhs.chunks[rhsIdx]));
+                }
+                ++rhsIdx;
+            }
+            else {
+                auto c = chunk_combine<Parts>(
+                    lhs.chunks[lhsIdx], rhs.chunks[rhsIdx]);
+
+                if (c.card > 0) {
+                    result.append(lhs.highs[lhsIdx], std::move(c));
+                }
+                ++lhsIdx;
+                ++rhsIdx;
+            }
+        }
+
+        return result;
+    }
+
+}; // class roaring_vectorset
+
+
+/**
+ * Equal operator of `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+inline bool
+operator==(const roaring_vectorset& lhs, const roaring_vectorset& rhs) {
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+/**
+ * Not equal operator of `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+inline bool
+operator!=(const roaring_vectorset& lhs, const roaring_vectorset& rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * Swap content of two `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ */
+inline void
+swap(roaring_vectorset& lhs, roaring_vectorset& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+/**
+ * Union of two `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Set with the elements of both sides.
+ */
+inline roaring_vectorset
+set_union(const roaring_vectorset& lhs, const roaring_vectorset& rhs) {
+    return roaring_vectorset::combine<
+        vectorset_algo::only_first | vectorset_algo::only_second
+        | vectorset_algo::both>(lhs, rhs);
+}
+
+/**
+ * Intersection of two `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Set with the elements of `lhs`, which are contained in
+ *         `rhs`.
+ */
+inline roaring_vectorset
+set_intersection(const roaring_vectorset& lhs, const roaring_vectorset& rhs) {
+    return roaring_vectorset::combine<vectorset_algo::both>(lhs, rhs);
+}
+
+/**
+ * Difference of two `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Set with the elements of `lhs`, which are not contained in
+ *         `rhs`.
+ */
+inline roaring_vectorset
+set_difference(const roaring_vectorset& lhs, const roaring_vectorset& rhs) {
+    return roaring_vectorset::combine<vectorset_algo::only_first>(lhs, rhs);
+}
+
+/**
+ * Symmetric difference of two `roaring_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Set with the elements contained in exactly one side.
+ */
+inline roaring_vectorset
+set_symmetric_difference(
+    const roaring_vectorset& lhs, const roaring_vectorset& rhs)
+{
+    return roaring_vectorset::combine<
+        vectorset_algo::only_first | vectorset_algo::only_second>(lhs, rhs);
+}
+
+#endif /* VECTOR_SET_ROARING_H */
@@ -0,0 +1,493 @@
+//
+// Vector container with inline storage (small buffer).
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "vectorset.h"
+#include "contiguous_vector_base.h"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+/**
+ * A sequence container with inline storage for `N` elements.
+ *
+ * The elems `N` elements are stored inside the container object. The
+ * elements are moved into a heap buffer (allocated with `Allocator`)
+ * when the container outgrows its inline storage, and moved back by
+ * `shrink_to_fit()`. The storage is always contiguous, the iterators
+ * are pointers.
+ *
+ * The container provides the interface of `std::vector` used by
+ * `vectorset` (see `contiguous_vector_base`). It can be used as the
+ * storage of a `vectorset` (see `small_vectorset`).
+ *
+ * @tparam T Type of the elements.
+ * @tparam N Number of elements stored inline.
+ * @tparam Allocator Allocator to use for the heap buffer.
+ */
+template<
+    class T,
+    std::size_t N,
+    class Allocator = std::allocator<T>
+    >
+class small_vector
+    : public contiguous_vector_base<
+        small_vector<T, N, Allocator>, T, Allocator>
+{
+    static_assert(N > 0, "N of small_vector must be greater than 0");
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    friend class contiguous_vector_base<small_vector, T, Allocator>;
+
+    static_assert(
+        std::is_same<typename alloc_traits::pointer, T*>::value,
+        "Allocator of small_vector must use raw pointers");
+
+public:
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Number of elements stored inline.
+    static constexpr size_type inline_capacity = N;
+
+private:
+
+    T *elems;                   ///< Begin of storage (inline or heap).
+    size_type count;            ///< Number of elements.
+    size_type cap;              ///< Capacity of the storage.
+    Allocator alloc;            ///< Allocator of the heap buffer.
+
+    /// Inline storage.
+    alignas(T) unsigned char buffer[N * sizeof(T)];
+
+    /// Begin of inline storage.
+    T *
+    inline_data() noexcept {
+        return reinterpret_cast<T*>(buffer);
+    }
+
+    /// Check, if the elements are stored inline.
+    bool
+    is_inline() const noexcept {
+        return (elems == reinterpret_cast<const T*>(buffer));
+    }
+
+    /// Destroy all elements and free the heap buffer.
+    void
+    release() noexcept {
+        this->clear();
+        if (!is_inline()) {
+            alloc_traits::deallocate(alloc, elems, cap);
+            elems = inline_data();
+            cap = N;
+        }
+    }
+
+    /**
+     * Move all elements into a new storage.
+     *
+     * The old elements are destroyed after all elements have been
+     * moved (or copied). If a copy throws, the new storage is cleaned
+     * up and the container is unchanged.
+     *
+     * @param target Begin of the new storage (inline or heap).
+     * @param targetCap Capacity of the new storage.
+     */
+    void
+    relocate(T *target, size_type targetCap) {
+        size_type pos = 0;
+
+        try {
+            for (; pos < count; ++pos) {
+                alloc_traits::construct(
+                    alloc, target + pos, std::move_if_noexcept(elems[pos]));
+            }
+        }
+        catch (...) {
+            while (pos > 0) {
+                alloc_traits::destroy(alloc, target + --pos);
+            }
+            throw;
+        }
+
+        for (pos = 0; pos < count; ++pos) {
+            alloc_traits::destroy(alloc, elems + pos);
+        }
+        if (!is_inline()) {
+            alloc_traits::deallocate(alloc, elems, cap);
+        }
+        elems = target;
+        cap = targetCap;
+    }
+
+    /// Move elements into a heap buffer for `new_cap` elements.
+    void
+    grow(size_type new_cap) {
+        auto target = alloc_traits::allocate(alloc, new_cap);
+
+        try {
+            relocate(target, new_cap);
+        }
+        catch (...) {
+            alloc_traits::deallocate(alloc, target, new_cap);
+            throw;
+        }
+    }
+
+    /// Capacity after growing by one element.
+    size_type
+    next_capacity() const noexcept {
+        return cap * 2;
+    }
+
+    /// Take the heap buffer or the elements of `other`.
+    void
+    take(small_vector &other) {
+        if (other.is_inline()) {
+            for (size_type pos = 0; pos < other.count; ++pos) {
+                alloc_traits::construct(
+                    alloc, elems + pos, std::move(other.elems[pos]));
+                ++count;
+            }
+            other.clear();
+        }
+        else {
+            elems = other.elems;
+            count = other.count;
+            cap = other.cap;
+            other.elems = other.inline_data();
+            other.count = 0;
+            other.cap = N;
+        }
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor.
+    small_vector() : small_vector(Allocator()) {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for the heap buffer of this
+     *              container.
+     */
+    explicit
+    small_vector(const Allocator& alloc) noexcept
+        : elems(inline_data()), count(0), cap(N), alloc(alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param alloc Allocator to use for the heap buffer of this
+     *              container.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    small_vector(
+        InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : small_vector(alloc)
+    {
+        try {
+            this->append(
+                first, last,
+                typename std::iterator_traits<InputIt>::iterator_category());
+        }
+        catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /**
+     * Initializer-list constructor.
+     *
+     * @param init Initializer-list to copy.
+     * @param alloc Allocator to use for the heap buffer of this
+     *              container.
+     */
+    small_vector(
+        std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : small_vector(init.begin(), init.end(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Copy constructor.
+     *
+     * @param other Another container to copy.
+     */
+    small_vector(const small_vector &other)
+        : small_vector(
+            other.begin(), other.end(),
+            alloc_traits::select_on_container_copy_construction(other.alloc))
+    {
+        /* empty */
+    }
+
+    /**
+     * Move constructor.
+     *
+     * A heap buffer of `other` is taken over, inline elements are
+     * moved one by one.
+     *
+     * @param other Another container to move.
+     */
+    small_vector(small_vector &&other)
+        noexcept(std::is_nothrow_move_constructible<T>::value)
+        : small_vector(other.alloc)
+    {
+        take(other);
+    }
+
+    /// Destructor.
+    ~small_vector() {
+        release();
+    }
+
+    /**
+     * Copy assignment.
+     *
+     * @param other Another container to copy.
+     *
+     * @return `*this`
+     */
+    small_vector &
+    operator=(const small_vector &other) {
+        if (this != &other) {
+            if (alloc_traits::propagate_on_container_copy_assignment::value
+                && alloc != other.alloc)
+            {
+                release();
+                alloc = other.alloc;
+            }
+            this->clear();
+            this->append(
+                other.begin(), other.end(), std::forward_iterator_tag());
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment.
+     *
+     * @param other Another container to move.
+     *
+     * @return `*this`
+     */
+    small_vector &
+    operator=(small_vector &&other) {
+        if (this != &other) {
+            release();
+            if (alloc_traits::propagate_on_container_move_assignment::value
+                || alloc == other.alloc)
+            {
+                alloc = other.alloc;
+                take(other);
+            }
+            else {
+                this->append(
+                    std::make_move_iterator(other.begin()),
+                    std::make_move_iterator(other.end()),
+                    std::forward_iterator_tag());
+                other.clear();
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Initializer-list assignment.
+     *
+     * @param ilist Initializer-list to copy.
+     *
+     * @return `*this`
+     */
+    small_vector &
+    operator=(std::initializer_list<T> ilist) {
+        this->clear();
+        this->append(ilist.begin(), ilist.end(), std::forward_iterator_tag());
+        return *this;
+    }
+
+    /// @}
+
+    /// Get allocator associated with the container.
+    allocator_type
+    get_allocator() const noexcept {
+        return alloc;
+    }
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Maximum possible number of elements .
+    size_type
+    max_size() const noexcept {
+        return alloc_traits::max_size(alloc);
+    }
+
+    /// Reserves storage for `new_cap` elements.
+    void
+    reserve(size_type new_cap) {
+        if (new_cap > cap) {
+            grow(new_cap);
+        }
+    }
+
+    /// Number of elements that can be held in current storage.
+    size_type
+    capacity() const noexcept {
+        return cap;
+    }
+
+    /// Checks if the elements are stored inline (no heap buffer).
+    bool
+    is_small() const noexcept {
+        return is_inline();
+    }
+
+    /**
+     * Reduces memory usage.
+     *
+     * The elements are moved back into the inline storage, if they
+     * fit into it.
+     */
+    void
+    shrink_to_fit() {
+        if (is_inline() || count == cap) {
+            return;
+        }
+        if (count <= N) {
+            relocate(inline_data(), N);
+        }
+        else {
+            grow(count);
+        }
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Exchange content with `other`.
+     *
+     * Heap buffers are exchanged, inline elements are moved.
+     */
+    void
+    swap(small_vector &other)
+        noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        using std::swap;
+
+        if (!is_inline() && !other.is_inline()) {
+            swap(elems, other.elems);
+            swap(count, other.count);
+            swap(cap, other.cap);
+            swap(alloc, other.alloc);
+            return;
+        }
+
+        small_vector tmp(std::move(other));
+
+        other.alloc = alloc;
+        other.take(*this);
+        alloc = tmp.alloc;
+        take(tmp);
+    }
+
+    /// @}
+
+}; // class small_vector
+
+
+template<class T, std::size_t N, class Allocator>
+constexpr typename small_vector<T, N, Allocator>::size_type
+small_vector<T, N, Allocator>::inline_capacity;
+
+
+/**
+ * Lookups in a `small_vector` search linearly up to its inline
+ * capacity (at most 16 elements).
+ */
+template<class T, std::size_t N, class Allocator>
+struct vectorset_linear_search_limit<small_vector<T, N, Allocator>>
+    : std::integral_constant<std::size_t, (N < 16 ? N : 16)>
+{};
+
+
+/**
+ * `vectorset` with inline storage for `N` elements.
+ *
+ * Small sets need no heap allocation; lookups search linearly while
+ * the set fits into the inline storage.
+ */
+template<
+    class Key,
+    std::size_t N,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+using small_vectorset =
+    vectorset<Key, Compare, Allocator, small_vector<Key, N, Allocator>>;
+
+#endif /* SMALL_VECTOR_H */
@@ -0,0 +1,945 @@
+//
+// Set of strings in one character arena.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// vectorset of strings, which stores all characters in one contiguous
+// buffer and compares 4 byte prefixes before the characters
+// (requires C++17).
+
+#ifndef VECTOR_SET_STRING_H
+#define VECTOR_SET_STRING_H
+
+#include "vectorset.h"
+
+#if __cplusplus >= 201703L // c++17
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Set of strings stored in one character arena.
+ *
+ * The characters of all strings are stored back to back in one
+ * `std::vector<char>` (the arena). The set itself is a vector of
+ * 16 byte entries (offset, length and the first 4 characters as big
+ * endian integer). Comparisons of entries are decided by the prefix
+ * integer in most cases, so sorting and binary search rarely touch
+ * the arena. There is no allocation per string.
+ *
+ * Like `vectorset`, the container has two modes:
+ *
+ * - `vectorset_mode::unordered`: Strings are appended by
+ *   `push_back()` or `insert()` in any order (with duplicates).
+ * - `vectorset_mode::unique_ordered`: The entries are sorted and
+ *   unique. Switching to this mode sorts the entries, removes
+ *   duplicates and rewrites the arena in sorted order, so iteration
+ *   reads the arena sequentially.
+ *
+ * Strings are accessed as `std::string_view`, which are invalidated
+ * by every modification of the container. Erased strings leave
+ * unused characters in the arena until it is compacted (when more
+ * than half of the arena is unused or on `shrink_to_fit()`).
+ *
+ * Requires *C++17* or higher.
+ */
+class string_vectorset {
+public:
+
+    using key_type = std::string;
+    using value_type = std::string_view;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = std::less<std::string_view>;
+    using value_compare = std::less<std::string_view>;
+
+    /// Entry of a string in the arena.
+    struct entry {
+        /// Offset of the first character in the arena.
+        size_type offset;
+
+        /// Number of characters.
+        uint32_t length;
+
+        /// First 4 characters (big endian, padded with zeros).
+        uint32_t prefix;
+    };
+
+    /**
+     * Constant random access iterator of `string_vectorset`.
+     *
+     * Dereferencing returns a `std::string_view` of the string in
+     * the arena (by value).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+
+        reference
+        operator*() const {
+            return owner->view(owner->entries[idx]);
+        }
+
+        reference
+        operator[](difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        const_iterator &
+        operator++() {
+            ++idx;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++idx;
+            return result;
+        }
+
+        const_iterator &
+        operator--() {
+            --idx;
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) {
+            auto result = *this;
+            --idx;
+            return result;
+        }
+
+        const_iterator &
+        operator+=(difference_type offset) {
+            idx += offset;
+            return *this;
+        }
+
+        const_iterator &
+        operator-=(difference_type offset) {
+            idx -= offset;
+            return *this;
+        }
+
+        friend const_iterator
+        operator+(const_iterator iter, difference_type offset) {
+            return (iter += offset);
+        }
+
+        friend const_iterator
+        operator+(difference_type offset, const_iterator iter) {
+            return (iter += offset);
+        }
+
+        friend const_iterator
+        operator-(const_iterator iter, difference_type offset) {
+            return (iter -= offset);
+        }
+
+        friend difference_type
+        operator-(const const_iterator &lhs, const const_iterator &rhs) {
+            return (static_cast<difference_type>(lhs.idx)
+                    - static_cast<difference_type>(rhs.idx));
+        }
+
+        friend bool
+        operator==(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx == rhs.idx);
+        }
+
+        friend bool
+        operator!=(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx != rhs.idx);
+        }
+
+        friend bool
+        operator<(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx < rhs.idx);
+        }
+
+        friend bool
+        operator>(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx > rhs.idx);
+        }
+
+        friend bool
+        operator<=(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx <= rhs.idx);
+        }
+
+        friend bool
+        operator>=(const const_iterator &lhs, const const_iterator &rhs) {
+            return (lhs.idx >= rhs.idx);
+        }
+
+    private:
+        friend class string_vectorset;
+
+        const_iterator(const string_vectorset *owner, size_type idx)
+            : owner(owner), idx(idx)
+        { /* empty */ }
+
+        const string_vectorset *owner = nullptr;
+        size_type idx = 0;
+    };
+
+    using iterator = const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    /// Characters of all strings.
+    std::vector<char> arena;
+
+    /// Entries of the strings (sorted in mode `unique_ordered`).
+    std::vector<entry> entries;
+
+    /// Characters in the arena, which belong to no entry.
+    size_type unusedChars = 0;
+
+    /// Mode of the container.
+    vectorset_mode opMode = vectorset_mode::unordered;
+
+    /// Prefix integer of `str`.
+    static uint32_t
+    make_prefix(std::string_view str) noexcept {
+        uint32_t result = 0;
+
+        for (size_type idx = 0; idx < 4; ++idx) {
+            result <<= 8;
+            if (idx < str.size()) {
+                result |= static_cast<unsigned char>(str[idx]);
+            }
+        }
+
+        return result;
+    }
+
+    /// String of entry `e`.
+    std::string_view
+    view(const entry &e) const noexcept {
+        return std::string_view(arena.data() + e.offset, e.length);
+    }
+
+    /// Compare entry `e` with `key` (prefix `prefix`).
+    int
+    compare(const entry &e, std::string_view key, uint32_t prefix) const {
+        if (e.prefix != prefix) {
+            return (e.prefix < prefix ? -1 : 1);
+        }
+
+        return view(e).compare(key);
+    }
+
+    /// Append characters of `str` to the arena.
+    entry
+    append(std::string_view str) {
+        if (str.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("string_vectorset: string too long");
+        }
+
+        entry result = {
+            arena.size(), static_cast<uint32_t>(str.size()),
+            make_prefix(str)
+        };
+
+        arena.insert(arena.end(), str.begin(), str.end());
+        return result;
+    }
+
+    /// Index of the first entry not less (or greater) than `key`.
+    size_type
+    bound_index(std::string_view key, bool lowerBound) const {
+        auto prefix = make_prefix(key);
+        size_type first = 0;
+        size_type count = entries.size();
+
+        while (count > 0) {
+            auto step = count / 2;
+            auto result = compare(entries[first + step], key, prefix);
+
+            if (result < 0 || (!lowerBound && result == 0)) {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    /// Index of entry equal to `key` (`size()`, if not found).
+    size_type
+    find_index(std::string_view key) const {
+        if (opMode == vectorset_mode::unordered) {
+            auto prefix = make_prefix(key);
+
+            for (size_type idx = 0; idx < entries.size(); ++idx) {
+                if (compare(entries[idx], key, prefix) == 0) {
+                    return idx;
+                }
+            }
+
+            return entries.size();
+        }
+
+        auto idx = bound_index(key, true);
+
+        return ((idx < entries.size()
+                 && compare(entries[idx], key, make_prefix(key)) == 0)
+                ? idx
+                : entries.size());
+    }
+
+    /// Copy the used characters into a new arena (entry order).
+    void
+    compact() {
+        std::vector<char> target;
+
+        target.reserve(arena.size() - unusedChars);
+        for (auto &e : entries) {
+            auto str = view(e);
+
+            e.offset = target.size();
+            target.insert(target.end(), str.begin(), str.end());
+        }
+
+        arena.swap(target);
+        unusedChars = 0;
+    }
+
+    /// Account erased characters, compact if the arena is mostly unused.
+    void
+    release(size_type chars) {
+        unusedChars += chars;
+        if (unusedChars > arena.size() / 2) {
+            compact();
+        }
+    }
+
+    /// Reserve entries and characters for a range (forward iterators).
+    template<class ForwardIt>
+    void
+    reserve_range(
+        ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        size_type count = 0;
+        size_type chars = 0;
+
+        for (; first != last; ++first, ++count) {
+            chars += std::string_view(*first).size();
+        }
+
+        reserve(entries.size() + count, arena.size() + chars);
+    }
+
+    /// Reserve nothing for a range of input iterators.
+    template<class InputIt>
+    void
+    reserve_range(InputIt, InputIt, std::input_iterator_tag) {
+        /* empty */
+    }
+
+    /// Sort entries, remove duplicates and rewrite the arena.
+    void
+    make_unique_ordered() {
+        std::sort(
+            entries.begin(), entries.end(),
+            [this](const entry &lhs, const entry &rhs) {
+                return (lhs.prefix != rhs.prefix
+                        ? lhs.prefix < rhs.prefix
+                        : view(lhs) < view(rhs));
+            });
+
+        auto rmIter =
+            std::unique(
+                entries.begin(), entries.end(),
+                [this](const entry &lhs, const entry &rhs) {
+                    return (lhs.prefix == rhs.prefix
+                            && view(lhs) == view(rhs));
+                });
+
+        for (auto iter = rmIter; iter != entries.end(); ++iter) {
+            unusedChars += iter->length;
+        }
+        entries.erase(rmIter, entries.end());
+
+        compact();
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor (empty, `vectorset_mode::unordered`).
+    string_vectorset() = default;
+
+    /**
+     * Range constructor (`vectorset_mode::unordered`).
+     *
+     * For forward iterators, entries and arena are allocated once.
+     *
+     * @param first Input iterator to the first string.
+     * @param last Input iterator after the last string.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    string_vectorset(InputIt first, InputIt last) {
+        reserve_range(
+            first, last,
+            typename std::iterator_traits<InputIt>::iterator_category());
+        for (; first != last; ++first) {
+            push_back(*first);
+        }
+    }
+
+    /**
+     * Initializer-list constructor (`vectorset_mode::unordered`).
+     *
+     * @param init Initializer-list to copy.
+     */
+    string_vectorset(std::initializer_list<std::string_view> init)
+        : string_vectorset(init.begin(), init.end())
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Mode
+
+    /// @{
+
+    /**
+     * Set mode of container.
+     *
+     * Switching to `vectorset_mode::unique_ordered` sorts the
+     * strings, removes duplicates and compacts the arena.
+     *
+     * @throws std::invalid_argument Mode `vectorset_mode::ordered` is
+     *                               not supported.
+     *
+     * @param op_mode New operation mode.
+     */
+    void
+    set_mode(vectorset_mode op_mode) {
+        if (op_mode == vectorset_mode::ordered) {
+            throw std::invalid_argument(
+                "string_vectorset: vectorset_mode::ordered is not supported");
+        }
+
+        if (opMode == op_mode) {
+            return;
+        }
+
+        if (op_mode == vectorset_mode::unique_ordered) {
+            make_unique_ordered();
+        }
+
+        opMode = op_mode;
+    }
+
+    /// Get current mode of container.
+    vectorset_mode
+    get_mode() const noexcept {
+        return opMode;
+    }
+
+    /// @}
+
+    /// @name Element access
+
+    /// @{
+
+    /// Access string at position `pos`.
+    std::string_view
+    operator[](size_type pos) const {
+        return view(entries[pos]);
+    }
+
+    /// Access string at position `pos` with bounds checking.
+    std::string_view
+    at(size_type pos) const {
+        return view(entries.at(pos));
+    }
+
+    /// Access first string.
+    std::string_view
+    front() const {
+        return view(entries.front());
+    }
+
+    /// Access last string.
+    std::string_view
+    back() const {
+        return view(entries.back());
+    }
+
+    /// Get entries (offset, length and prefix) of the strings.
+    const std::vector<entry> &
+    get_entries() const noexcept {
+        return entries;
+    }
+
+    /// Get character arena.
+    const std::vector<char> &
+    get_arena() const noexcept {
+        return arena;
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    const_iterator
+    begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const noexcept {
+        return begin();
+    }
+
+    /// Iterator to the end.
+    const_iterator
+    end() const noexcept {
+        return const_iterator(this, entries.size());
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    /// Reverse iterator to the beginning.
+    const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    /// Reverse iterator to the end.
+    const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return entries.empty();
+    }
+
+    /// Number of strings in the container.
+    size_type
+    size() const noexcept {
+        return entries.size();
+    }
+
+    /// Maximum possible number of strings.
+    size_type
+    max_size() const noexcept {
+        return entries.max_size();
+    }
+
+    /**
+     * Reserve storage.
+     *
+     * @param new_cap Number of strings.
+     * @param chars Number of characters of all strings.
+     */
+    void
+    reserve(size_type new_cap, size_type chars = 0) {
+        entries.reserve(new_cap);
+        arena.reserve(chars);
+    }
+
+    /// Compact the arena and free unused memory.
+    void
+    shrink_to_fit() {
+        compact();
+        entries.shrink_to_fit();
+        arena.shrink_to_fit();
+    }
+
+    /// Memory used by entries and arena (bytes).
+    size_type
+    memory_bytes() const noexcept {
+        return entries.capacity() * sizeof(entry) + arena.capacity();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /// Clears the contents (the mode is kept).
+    void
+    clear() noexcept {
+        arena.clear();
+        entries.clear();
+        unusedChars = 0;
+    }
+
+    /**
+     * Inserts new string.
+     *
+     * * Insert the string in sorted container
+     *   (`vectorset_mode::unique_ordered`), if the container does not
+     *   already contains the string. The characters are appended to
+     *   the arena.
+     * * If the container is unordered (`vectorset_mode::unordered`),
+     *   the string is always appended (`push_back`).
+     *
+     * @param str String to insert.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element and a bool value set to true if the
+     *         insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(std::string_view str) {
+        if (opMode == vectorset_mode::unordered) {
+            push_back(str);
+            return {const_iterator(this, entries.size() - 1), true};
+        }
+
+        auto idx = bound_index(str, true);
+
+        if (idx < entries.size()
+            && compare(entries[idx], str, make_prefix(str)) == 0)
+        {
+            return {const_iterator(this, idx), false};
+        }
+
+        entries.insert(entries.begin() + idx, append(str));
+        return {const_iterator(this, idx), true};
+    }
+
+    /**
+     * Inserts strings from range [first, last).
+     *
+     * In mode `vectorset_mode::unique_ordered`, the strings are
+     * appended and sorted with the others at once. If an exception
+     * is thrown, the appended strings are removed and the mode is
+     * kept.
+     *
+     * @param first Iterator to first string to insert.
+     * @param last Iterator _after_ last string to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        auto mode = opMode;
+        auto oldEntries = entries.size();
+        auto oldChars = arena.size();
+
+        opMode = vectorset_mode::unordered;
+        try {
+            reserve_range(
+                first, last,
+                typename std::iterator_traits<InputIt>::iterator_category());
+            for (; first != last; ++first) {
+                push_back(*first);
+            }
+        }
+        catch (...) {
+            // remove the appended strings, restore the mode
+            entries.erase(entries.begin() + oldEntries, entries.end());
+            arena.erase(arena.begin() + oldChars, arena.end());
+            opMode = mode;
+            throw;
+        }
+        set_mode(mode);
+    }
+
+    /**
+     * Appends the given string to the end of the container (only
+     * unordered container).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param str The string to append.
+     */
+    void
+    push_back(std::string_view str) {
+        if (opMode == vectorset_mode::unique_ordered) {
+            throw std::logic_error(
+                "push_back is only available in vectorset_mode::unordered");
+        }
+
+        entries.push_back(append(str));
+    }
+
+    /**
+     * Erase string at position.
+     *
+     * @param pos iterator to the string to remove.
+     *
+     * @return Iterator following the removed string.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_ASSERT(pos.owner == this && pos.idx < entries.size());
+
+        auto chars = entries[pos.idx].length;
+
+        entries.erase(entries.begin() + pos.idx);
+        release(chars);
+
+        return const_iterator(this, pos.idx);
+    }
+
+    /**
+     * Erase string by key.
+     *
+     * @param key String to remove.
+     *
+     * @return Number of strings removed (0 or 1).
+     */
+    size_type
+    erase(std::string_view key) {
+        auto idx = find_index(key);
+
+        if (idx == entries.size()) {
+            return 0;
+        }
+
+        erase(const_iterator(this, idx));
+        return 1;
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(string_vectorset& other) noexcept {
+        arena.swap(other.arena);
+        entries.swap(other.entries);
+        std::swap(unusedChars, other.unusedChars);
+        std::swap(opMode, other.opMode);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of strings equal to `key`.
+     *
+     * @param key String to count.
+     *
+     * @return number of strings (0 or 1 in mode
+     *         `vectorset_mode::unique_ordered`).
+     */
+    size_type
+    count(std::string_view key) const {
+        if (opMode == vectorset_mode::unique_ordered) {
+            return (contains(key) ? 1 : 0);
+        }
+
+        return static_cast<size_type>(
+            std::count(begin(), end(), key));
+    }
+
+    /**
+     * Find string equal to `key`.
+     *
+     * @param key String to search for.
+     *
+     * @return iterator to matched string or `end()`, if not found.
+     */
+    const_iterator
+    find(std::string_view key) const {
+        return const_iterator(this, find_index(key));
+    }
+
+    /**
+     * Checks if the container contains `key`.
+     *
+     * @param key String to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(std::string_view key) const {
+        return (find_index(key) != entries.size());
+    }
+
+    /**
+     * Iterator to the first string not less than `key` (only
+     * `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    const_iterator
+    lower_bound(std::string_view key) const {
+        check_ordered("lower_bound");
+        return const_iterator(this, bound_index(key, true));
+    }
+
+    /**
+     * Iterator to the first string greater than `key` (only
+     * `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    const_iterator
+    upper_bound(std::string_view key) const {
+        check_ordered("upper_bound");
+        return const_iterator(this, bound_index(key, false));
+    }
+
+    /**
+     * Range of strings equal to `key` (only
+     * `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    std::pair<const_iterator, const_iterator>
+    equal_range(std::string_view key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /// Get function object that compares the keys.
+    key_compare
+    key_comp() const {
+        return key_compare();
+    }
+
+    /// Get function object that compares the values.
+    value_compare
+    value_comp() const {
+        return value_compare();
+    }
+
+    /// @}
+
+private:
+
+    /// Throw `std::logic_error`, if the container is not ordered.
+    void
+    check_ordered(const char *name) const {
+        if (opMode != vectorset_mode::unique_ordered) {
+            throw std::logic_error(
+                std::string(name)
+                + " is only available in vectorset_mode::unique_ordered");
+        }
+    }
+
+}; // class string_vectorset
+
+
+/**
+ * Equal operator of `string_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs` (same strings in same order).
+ */
+inline bool
+operator==(const string_vectorset& lhs, const string_vectorset& rhs) {
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+/**
+ * Not equal operator of `string_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+inline bool
+operator!=(const string_vectorset& lhs, const string_vectorset& rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * Swap content of two `string_vectorset`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ */
+inline void
+swap(string_vectorset& lhs, string_vectorset& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+#endif // __cplusplus >= 201703L
+
+#endif /* VECTOR_SET_STRING_H */
@@ -77,3 +77,179 @@ TEST_F(Allocators, ClassAlloc) {
     EXPECT_EQ(c, values);
     EXPECT_TRUE(testAllocUsed);
 }
+
+#if __cplusplus >= 201703L // c++17
+
+/**
+ * Memory resource counting the allocations (based on new/delete).
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    /// number of calls of allocate()
+    std::size_t allocations = 0;
+
+    /// bytes currently allocated
+    std::size_t inUse = 0;
+
+private:
+    void *
+    do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        inUse += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void
+    do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+        inUse -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool
+    do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+
+/// Copy the values of a container into a `std::vector<int>`.
+template<class Set>
+static std::vector<int>
+toVector(const Set& set) {
+    return std::vector<int>(set.begin(), set.end());
+}
+
+
+TEST_F(Allocators, PmrConstruct) {
+    CountingResource res;
+    std::vector<int> values = { 8, 0, 2, 5, 2, 6 };
+
+    pmr::vectorset<int> c(values.begin(), values.end(), &res);
+
+    EXPECT_EQ(toVector(c), values);
+    EXPECT_EQ(c.get_allocator().resource(), &res);
+    EXPECT_GT(res.inUse, 0u);
+
+    c.clear();
+    c.shrink_to_fit();
+    EXPECT_EQ(res.inUse, 0u);
+}
+
+
+TEST_F(Allocators, PmrCopy) {
+    CountingResource res;
+    CountingResource other;
+
+    pmr::vectorset<int> c({ 8, 0, 2, 5, 2, 6 }, &res);
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    // like std::pmr::vector: a copy uses the default resource
+    pmr::vectorset<int> copy(c);
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(copy, c);
+    EXPECT_EQ(copy.get_mode(), vectorset_mode::unique_ordered);
+
+    pmr::vectorset<int> copyAlloc(c, &other);
+    EXPECT_EQ(copyAlloc.get_allocator().resource(), &other);
+    EXPECT_EQ(copyAlloc, c);
+    EXPECT_EQ(copyAlloc.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_GT(other.inUse, 0u);
+
+    // copy assignment keeps the resource of the target
+    pmr::vectorset<int> assigned(&other);
+    assigned = c;
+    EXPECT_EQ(assigned.get_allocator().resource(), &other);
+    EXPECT_EQ(assigned, c);
+}
+
+
+TEST_F(Allocators, PmrMove) {
+    CountingResource res;
+    CountingResource other;
+
+    pmr::vectorset<int> c({ 8, 0, 2, 5, 2, 6 }, &res);
+    c.set_mode(vectorset_mode::unique_ordered);
+    auto allocations = res.allocations;
+
+    // the move constructor keeps the resource
+    pmr::vectorset<int> moved(std::move(c));
+    EXPECT_EQ(moved.get_allocator().resource(), &res);
+    EXPECT_EQ(toVector(moved), std::vector<int>({ 0, 2, 5, 6, 8 }));
+    EXPECT_EQ(moved.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(res.allocations, allocations);
+
+    // move to another resource
+    pmr::vectorset<int> movedAlloc(std::move(moved), &other);
+    EXPECT_EQ(movedAlloc.get_allocator().resource(), &other);
+    EXPECT_EQ(toVector(movedAlloc), std::vector<int>({ 0, 2, 5, 6, 8 }));
+    EXPECT_EQ(movedAlloc.get_mode(), vectorset_mode::unique_ordered);
+
+    // move assignment keeps the resource of the target
+    pmr::vectorset<int> assigned(&res);
+    assigned = std::move(movedAlloc);
+    EXPECT_EQ(assigned.get_allocator().resource(), &res);
+    EXPECT_EQ(toVector(assigned), std::vector<int>({ 0, 2, 5, 6, 8 }));
+    EXPECT_EQ(assigned.get_mode(), vectorset_mode::unique_ordered);
+
+    EXPECT_FALSE(
+        std::is_nothrow_move_assignable<pmr::vectorset<int>>::value);
+    EXPECT_TRUE(std::is_nothrow_move_assignable<vectorset<int>>::value);
+}
+
+
+TEST_F(Allocators, PmrSwap) {
+    CountingResource res;
+
+    pmr::vectorset<int> a({ 1, 2, 3 }, &res);
+    pmr::vectorset<int> b({ 4, 5 }, &res);
+    b.set_mode(vectorset_mode::unique_ordered);
+
+    a.swap(b);
+
+    EXPECT_EQ(toVector(a), std::vector<int>({ 4, 5 }));
+    EXPECT_EQ(a.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(toVector(b), std::vector<int>({ 1, 2, 3 }));
+    EXPECT_EQ(b.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(a.get_allocator().resource(), &res);
+}
+
+
+TEST_F(Allocators, PmrScratch) {
+    CountingResource res;
+    CountingResource scratch;
+
+    pmr::vectorset<int> c({ 0, 10, 20, 30, 40 }, &res);
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.reserve(32);
+
+    std::vector<int> more = { 35, 5, 15, 25, 10 };
+    auto allocations = res.allocations;
+
+    c.insert(more.begin(), more.end(), &scratch);
+    EXPECT_EQ(toVector(c), std::vector<int>({ 0, 5, 10, 15, 20, 25, 30, 35, 40 }));
+    EXPECT_EQ(res.allocations, allocations);
+    EXPECT_GT(scratch.allocations, 0u);
+    EXPECT_EQ(scratch.inUse, 0u);
+
+    std::vector<int> keys = { 35, 0, 99, 15 };
+    scratch.allocations = 0;
+
+    EXPECT_EQ(c.erase_many(keys.begin(), keys.end(), &scratch), 3u);
+    EXPECT_EQ(toVector(c), std::vector<int>({ 5, 10, 20, 25, 30, 40 }));
+    EXPECT_EQ(res.allocations, allocations);
+    EXPECT_EQ(scratch.allocations, 1u);
+
+    pmr::vectorset<int> source({ 1, 10, 50 }, &res);
+    allocations = res.allocations;
+    scratch.allocations = 0;
+
+    c.merge(source, &scratch);
+    EXPECT_EQ(toVector(c), std::vector<int>({ 1, 5, 10, 20, 25, 30, 40, 50 }));
+    EXPECT_EQ(toVector(source), std::vector<int>({ 10 }));
+    EXPECT_EQ(res.allocations, allocations);
+    EXPECT_EQ(scratch.allocations, 1u);
+    EXPECT_EQ(scratch.inUse, 0u);
+}
+
+#endif
@@ -0,0 +1,290 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "BufferedVectorset.h"
+
+#include "TestUtils.h"
+#include "buffered_vectorset.h"
+
+#include <set>
+#include <string>
+#include <utility>
+#include <random>
+
+
+TEST_F(BufferedVectorset, InsertBuffer) {
+    buffered_vectorset<int> c = { 8, 0, 2, 5, 2, 6 };
+
+    EXPECT_EQ(c.size(), 5u);
+
+    auto result = c.insert(3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "insert-buffer"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 3);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 2);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 3, 5, 6, 8));
+
+    c.clearDebugTrace();
+    result = c.insert(5);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "found-main-no-insert"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 5);
+
+    c.clearDebugTrace();
+    result = c.insert(3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "found-buffer-no-insert"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 3);
+}
+
+
+TEST_F(BufferedVectorset, EraseTombstone) {
+    buffered_vectorset<int> c = { 8, 0, 2, 5, 2, 6 };
+
+    c.insert(3);
+    c.clearDebugTrace();
+
+    EXPECT_EQ(c.erase(5), 1u);
+    EXPECT_EQ(c.erase(5), 0u);
+    EXPECT_EQ(c.erase(3), 1u);
+    EXPECT_EQ(c.erase(4), 0u);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"erase(const Key&)", "start"},
+                {"erase(const Key&)", "erase-main:1"},
+                {"erase(const Key&)", "start"},
+                {"erase(const Key&)", "already-erased:0"},
+                {"erase(const Key&)", "start"},
+                {"erase(const Key&)", "erase-buffer:1"},
+                {"erase(const Key&)", "start"},
+                {"erase(const Key&)", "not-found:0"}
+            }));
+
+    EXPECT_EQ(c.size(), 4u);
+    EXPECT_FALSE(c.contains(5));
+    EXPECT_EQ(c.find(5), c.end());
+    EXPECT_EQ(*c.lower_bound(5), 6);
+    EXPECT_EQ(*c.upper_bound(2), 6);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 6, 8));
+
+    // revive tombstone
+    c.clearDebugTrace();
+    auto result = c.insert(5);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "revive-main"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 5);
+    EXPECT_EQ(c.size(), 5u);
+}
+
+
+namespace {
+    using Entry = std::pair<int, std::string>;
+
+    /// Compare entries by first element only.
+    struct EntryLess {
+        bool
+        operator()(const Entry &lhv, const Entry &rhv) const {
+            return lhv.first < rhv.first;
+        }
+    };
+}
+
+
+TEST_F(BufferedVectorset, ReviveTombstoneValue) {
+    buffered_vectorset<Entry, EntryLess> c;
+
+    for (int idx = 0; idx < 200; ++idx) {
+        c.insert(Entry(idx, "old"));
+    }
+    c.flush();
+
+    EXPECT_EQ(c.erase(Entry(5, "")), 1u);
+
+    // the inserted value replaces the erased one
+    auto result = c.insert(Entry(5, "new"));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(result.first->second, "new");
+    EXPECT_EQ(c.find(Entry(5, ""))->second, "new");
+    EXPECT_EQ(c.size(), 200u);
+}
+
+
+TEST_F(BufferedVectorset, EraseAtPos) {
+    buffered_vectorset<int> c = { 8, 0, 2, 5, 6 };
+
+    c.insert(3);
+    c.insert(7);
+
+    auto iter = c.erase(c.find(3));
+    EXPECT_EQ(*iter, 5);
+
+    iter = c.erase(iter);
+    EXPECT_EQ(*iter, 6);
+
+    iter = c.erase(c.find(8));
+    EXPECT_EQ(iter, c.end());
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 6, 7));
+}
+
+
+TEST_F(BufferedVectorset, Flush) {
+    buffered_vectorset<int> c;
+
+    for (int val = 0; val < 16; ++val) {
+        c.insert(val * 2);
+    }
+
+    c.clearDebugTrace();
+    c.insert(7);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "buffer-full"},
+                {"flush()", "start"},
+                {"flush()", "merge:16"},
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "insert-buffer"}
+            }));
+
+    EXPECT_EQ(c.size(), 17u);
+
+    c.erase(0);
+    c.clearDebugTrace();
+    c.flush();
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"flush()", "start"},
+                {"compact_erased()", "start:1"},
+                {"flush()", "merge:1"}
+            }));
+
+    EXPECT_EQ(c.size(), 16u);
+    EXPECT_EQ(*c.begin(), 2);
+}
+
+
+TEST_F(BufferedVectorset, RandomOperations) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    buffered_vectorset<int> c;
+    std::set<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        auto val = dist(gen);
+
+        switch (step % 3) {
+        case 0:
+        case 1: {
+            auto result = c.insert(val);
+            auto expectedResult = expected.insert(val);
+
+            ASSERT_EQ(result.second, expectedResult.second);
+            ASSERT_EQ(*result.first, val);
+            break;
+        }
+        case 2:
+            if (step % 2 == 0) {
+                ASSERT_EQ(c.erase(val), expected.erase(val));
+            }
+            else {
+                auto iter = c.find(val);
+                auto expectedIter = expected.find(val);
+
+                ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+                if (iter != c.end()) {
+                    auto next = c.erase(iter);
+                    auto expectedNext = expected.erase(expectedIter);
+
+                    ASSERT_EQ(next == c.end(), expectedNext == expected.end());
+                    if (next != c.end()) {
+                        ASSERT_EQ(*next, *expectedNext);
+                    }
+                }
+            }
+            break;
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(c.contains(val), expected.count(val) != 0);
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+
+    c.flush();
+
+    EXPECT_EQ(c.size(), expected.size());
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
@@ -0,0 +1,242 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#include "CompactVector.h"
+
+#include "TestUtils.h"
+#include "compact_vector.h"
+
+#include <set>
+#include <random>
+
+
+TEST_F(CompactVector, Layout) {
+#if _VECTOR_SET_DO_TRACE == 1
+    // the debug trace is an additional member
+    constexpr std::size_t traceSize = sizeof(_Vectorset_Trace);
+#else
+    constexpr std::size_t traceSize = 0;
+#endif
+
+    if (sizeof(void*) == 8) {
+        EXPECT_EQ(sizeof(compact_vector<int>), 16u);
+        EXPECT_EQ(sizeof(compact_vectorset<int>), 16u + traceSize);
+        EXPECT_EQ(
+            sizeof(compact_vectorset<std::string>), 16u + traceSize);
+    }
+
+    EXPECT_EQ(
+        sizeof(compact_vectorset<int>),
+        sizeof(compact_vector<int>) + traceSize);
+    EXPECT_TRUE(vectorset_embeds_mode<compact_vector<int>>::value);
+    EXPECT_FALSE(vectorset_embeds_mode<std::vector<int>>::value);
+
+    compact_vector<int> c;
+
+    EXPECT_EQ(c.capacity(), 0u);
+    EXPECT_EQ(c.data(), nullptr);
+    EXPECT_EQ(c.max_size(), (std::size_t(1) << 30) - 1);
+}
+
+
+TEST_F(CompactVector, InsertErase) {
+    compact_vector<int> c = { 0, 1, 2 };
+
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c.capacity(), 3u);
+
+    auto iter = c.insert(std::next(c.begin(), 1), 10);
+    EXPECT_EQ(*iter, 10);
+    EXPECT_EQ(c.capacity(), 6u);
+
+    c.insert(c.begin(), 11);
+    c.insert(c.end(), 12);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(11, 0, 10, 1, 2, 12));
+    EXPECT_EQ(
+        std::vector<int>(c.rbegin(), c.rend()),
+        vs_test::make_vector<int>(12, 2, 1, 10, 0, 11));
+    EXPECT_EQ(c[2], 10);
+    EXPECT_EQ(c.at(5), 12);
+    EXPECT_THROW(c.at(6), std::out_of_range);
+    EXPECT_EQ(c.front(), 11);
+    EXPECT_EQ(c.back(), 12);
+
+    iter = c.erase(std::next(c.begin(), 2));
+    EXPECT_EQ(*iter, 1);
+
+    iter = c.erase(c.begin(), std::next(c.begin(), 2));
+    EXPECT_EQ(*iter, 1);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 2, 12));
+
+    c.shrink_to_fit();
+    EXPECT_EQ(c.capacity(), 3u);
+
+    c.insert(std::next(c.begin(), 1), { 20, 21, 22 });
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 21, 22, 2, 12));
+
+    // insert element of the container itself while growing
+    c.shrink_to_fit();
+    c.emplace_back(c[1]);
+    EXPECT_EQ(c.back(), 20);
+
+    c.resize(2);
+    c.resize(4, 7);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 7, 7));
+
+    c.clear();
+    c.shrink_to_fit();
+    EXPECT_EQ(c.capacity(), 0u);
+    EXPECT_EQ(c.data(), nullptr);
+}
+
+
+TEST_F(CompactVector, OwnerBits) {
+    using cvector = compact_vector<std::string>;
+
+    cvector c1 = { "a", "b", "c" };
+
+    c1.set_owner_bits(2);
+    c1.reserve(100);
+    EXPECT_EQ(c1.get_owner_bits(), 2u);
+    EXPECT_EQ(c1.capacity(), 100u);
+
+    cvector c2(c1);
+    EXPECT_TRUE(c1 == c2);
+    EXPECT_EQ(c2.get_owner_bits(), 0u);
+
+    c2.push_back("d");
+    EXPECT_TRUE(c1 != c2);
+    EXPECT_TRUE(c1 < c2);
+    EXPECT_TRUE(c2 >= c1);
+
+    c2.set_owner_bits(3);
+    c1.swap(c2);
+    EXPECT_EQ(c1.size(), 4u);
+    EXPECT_EQ(c2.capacity(), 100u);
+    EXPECT_EQ(c1.get_owner_bits(), 2u);
+    EXPECT_EQ(c2.get_owner_bits(), 3u);
+
+    cvector c3(std::move(c1));
+    EXPECT_EQ(c3.size(), 4u);
+    EXPECT_EQ(c3.get_owner_bits(), 0u);
+    EXPECT_TRUE(c1.empty());
+    EXPECT_EQ(c1.get_owner_bits(), 2u);
+
+    c1 = std::move(c2);
+    EXPECT_EQ(c1.size(), 3u);
+    EXPECT_EQ(c1.capacity(), 100u);
+    EXPECT_EQ(c1.get_owner_bits(), 2u);
+}
+
+
+TEST_F(CompactVector, Modes) {
+    compact_vectorset<int> c1 = { 5, 3, 1, 0, 2, 5 };
+
+    EXPECT_EQ(c1.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c1.size(), 6u);
+
+    c1.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_EQ(c1.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(
+        std::vector<int>(c1.begin(), c1.end()),
+        vs_test::make_vector<int>(0, 1, 2, 3, 5));
+
+    // mode survives reallocation
+    for (int val = 10; val < 100; ++val) {
+        c1.insert(val);
+    }
+    c1.shrink_to_fit();
+    EXPECT_EQ(c1.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_FALSE(c1.insert(50).second);
+
+    compact_vectorset<int> c2 = { 7, 7 };
+
+    c1.swap(c2);
+    EXPECT_EQ(c1.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c2.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c1.size(), 2u);
+
+    compact_vectorset<int> c3(c2);
+    EXPECT_EQ(c3.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(c3 == c2);
+
+    compact_vectorset<int> c4(std::move(c3));
+    EXPECT_EQ(c4.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c3.get_mode(), vectorset_mode::unordered);
+
+    c1 = c4;
+    EXPECT_EQ(c1.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c1.size(), c4.size());
+
+    c4.set_mode(vectorset_mode::unordered);
+    c4.push_back(0);
+    EXPECT_EQ(c4.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c4.back(), 0);
+}
+
+
+TEST_F(CompactVector, OrderedVectorset) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    compact_vectorset<int> c;
+    std::set<int> expected;
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    for (int step = 0; step < 20000; ++step) {
+        auto val = dist(gen);
+
+        if (step % 3 != 2) {
+            auto result = c.insert(val);
+            auto expectedResult = expected.insert(val);
+
+            ASSERT_EQ(result.second, expectedResult.second);
+            ASSERT_EQ(*result.first, val);
+        }
+        else {
+            ASSERT_EQ(c.erase(val), expected.erase(val));
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(
+            std::distance(c.begin(), c.lower_bound(val)),
+            std::distance(expected.begin(), expected.lower_bound(val)));
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+}
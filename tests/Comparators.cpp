@@ -181,9 +181,10 @@ const _Vectorset_Trace Comparators::workTrace = {
     {"impl_erase_unique_ordered(const Key&)", "found-erase:1"},
 
     {"insert(InputIt,InputIt)", "start"},
-    {"insert(InputIt,InputIt)", "call:make_unique_ordered()"},
-    {"make_unique_ordered()", "start"},
-    {"make_unique_ordered()", "rmIter:7(7)"},
+    {"insert(InputIt,InputIt)",
+     "call:impl_insert_range_unique_ordered(InputIt,InputIt)"},
+    {"impl_insert_range_unique_ordered(InputIt,InputIt)", "start"},
+    {"impl_insert_range_unique_ordered(InputIt,InputIt)", "new:2"},
 
     {"impl_erase_unique_ordered(const Key&)", "start"},
     {"impl_erase_unique_ordered(const Key&)", "iter:1(7)"},
@@ -199,9 +200,7 @@ const _Vectorset_Trace Comparators::workTrace = {
     {"impl_insert_emplace_unique_ordered", "iter:2(6)"},
     {"impl_insert_emplace_unique_ordered", "move-into-position"},
     {"move_into_position", "start:5(6) to 2(6)"},
-    {"move_into_position", "swap:4(6) and 5(6)"},
-    {"move_into_position", "swap:3(6) and 4(6)"},
-    {"move_into_position", "swap:2(6) and 3(6)"},
+    {"move_into_position", "shift:3"},
     {"impl_emplace_unique_ordered(Args&&...)", "insert:true"},
     {"impl_emplace_unique_ordered(Args&&...)", "iter:2(6)"},
 
@@ -220,9 +219,7 @@ const _Vectorset_Trace Comparators::workTrace = {
     {"impl_insert_emplace_unique_ordered", "iter:2(6)"},
     {"impl_insert_emplace_unique_ordered", "move-into-position"},
     {"move_into_position", "start:5(6) to 2(6)"},
-    {"move_into_position", "swap:4(6) and 5(6)"},
-    {"move_into_position", "swap:3(6) and 4(6)"},
-    {"move_into_position", "swap:2(6) and 3(6)"},
+    {"move_into_position", "shift:3"},
     {"impl_emplace_unique_ordered(const_iterator,Args&&...)", "emplaced:true"},
     {"impl_emplace_unique_ordered(const_iterator,Args&&...)", "result:2(6)"},
 
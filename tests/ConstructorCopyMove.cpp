@@ -36,7 +36,6 @@ TEST_F(ConstructorCopyMove, Copy) {
         vs_test::checkTrace(
             c.getDebugTrace(),
             {
-                {"vectorset()", "construct"},
                 {"vectorset(const vectorset& other)", "construct"}
             }));
 
@@ -61,7 +60,6 @@ TEST_F(ConstructorCopyMove, CopyOrdered) {
         vs_test::checkTrace(
             c.getDebugTrace(),
             {
-                {"vectorset()", "construct"},
                 {"vectorset(const vectorset& other)", "construct"}
             }));
 
@@ -85,7 +83,6 @@ TEST_F(ConstructorCopyMove, Move) {
         vs_test::checkTrace(
             c.getDebugTrace(),
             {
-                {"vectorset()", "construct"},
                 {"vectorset(vectorset&& other)", "construct"}
             }));
 
@@ -110,7 +107,6 @@ TEST_F(ConstructorCopyMove, MoveOrdered) {
         vs_test::checkTrace(
             c.getDebugTrace(),
             {
-                {"vectorset()", "construct"},
                 {"vectorset(vectorset&& other)", "construct"}
             }));
 
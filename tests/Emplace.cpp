@@ -93,9 +93,7 @@ vs_test::EmplaceParam::caseOrdered = {
             {"impl_insert_emplace_unique_ordered", "move-into-position"},
 
             {"move_into_position", "start:5(6) to 2(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
+            {"move_into_position", "shift:3"},
 
             {"impl_emplace_unique_ordered(Args&&...)", "insert:true"},
             {"impl_emplace_unique_ordered(Args&&...)", "iter:2(6)"}
@@ -117,11 +115,7 @@ vs_test::EmplaceParam::caseOrdered = {
             {"impl_insert_emplace_unique_ordered", "move-into-position"},
 
             {"move_into_position", "start:5(6) to 0(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
-            {"move_into_position", "swap:1(6) and 2(6)"},
-            {"move_into_position", "swap:0(6) and 1(6)"},
+            {"move_into_position", "shift:5"},
 
             {"impl_emplace_unique_ordered(Args&&...)", "insert:true"},
             {"impl_emplace_unique_ordered(Args&&...)", "iter:0(6)"}
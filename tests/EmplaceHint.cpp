@@ -189,9 +189,7 @@ vs_test::EmplaceHintParam::caseOrderedPosBegin = {
             {"impl_insert_emplace_unique_ordered", "move-into-position"},
 
             {"move_into_position", "start:5(6) to 2(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
+            {"move_into_position", "shift:3"},
 
             {"impl_emplace_unique_ordered(const_iterator,Args&&...)",
              "emplaced:true"},
@@ -264,10 +262,7 @@ vs_test::EmplaceHintParam::caseOrderedPos2 = {
             {"impl_insert_emplace_unique_ordered", "move-into-position"},
 
             {"move_into_position", "start:5(6) to 1(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
-            {"move_into_position", "swap:1(6) and 2(6)"},
+            {"move_into_position", "shift:4"},
 
             {"impl_emplace_unique_ordered(const_iterator,Args&&...)",
              "emplaced:true"},
@@ -340,9 +335,7 @@ vs_test::EmplaceHintParam::caseOrderedPosEnd = {
             {"impl_insert_emplace_unique_ordered", "move-into-position"},
 
             {"move_into_position", "start:5(6) to 2(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
+            {"move_into_position", "shift:3"},
 
             {"impl_emplace_unique_ordered(const_iterator,Args&&...)",
              "emplaced:true"},
@@ -410,9 +403,7 @@ vs_test::EmplaceHintParam::caseOrderedPosMatchMiddle = {
              "hin-on-spot:2(6)"},
 
             {"move_into_position", "start:5(6) to 2(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
+            {"move_into_position", "shift:3"},
         }
     }, {
         "duplicate", 2, 1, true,
@@ -465,11 +456,7 @@ vs_test::EmplaceHintParam::caseOrderedPosMatchBegin = {
              "hin-on-spot:0(6)"},
 
             {"move_into_position", "start:5(6) to 0(6)"},
-            {"move_into_position", "swap:4(6) and 5(6)"},
-            {"move_into_position", "swap:3(6) and 4(6)"},
-            {"move_into_position", "swap:2(6) and 3(6)"},
-            {"move_into_position", "swap:1(6) and 2(6)"},
-            {"move_into_position", "swap:0(6) and 1(6)"},
+            {"move_into_position", "shift:5"},
         }
     }, {
         "duplicate", 0, 0, true,
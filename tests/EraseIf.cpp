@@ -0,0 +1,137 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "EraseIf.h"
+
+
+TEST_F(EraseIf, UnorderedRetain) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unordered);
+
+    auto erase_cnt =
+        c.retain(
+            [](const vs_test::TestValue &value) {
+                return value.val > 2;
+            });
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"set_mode(vectorset_mode)", "start"},
+                {"set_mode(vectorset_mode)", "mode-equal"},
+                {"retain(Pred)", "start"},
+                {"retain(Pred)", "rmSize:3"}
+            }));
+
+    EXPECT_EQ(erase_cnt, 3u);
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(8, 5, 6));
+}
+
+TEST_F(EraseIf, OrderedRetain) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    auto erase_cnt =
+        c.retain(
+            [](const vs_test::TestValue &value) {
+                return value.val % 4 == 0;
+            });
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"retain(Pred)", "start"},
+                {"retain(Pred)", "rmSize:3"}
+            }));
+
+    EXPECT_EQ(erase_cnt, 3u);
+    EXPECT_EQ(c.size(), 2u);
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 8));
+}
+
+
+TEST_F(EraseIf, UnorderedEraseIf) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unordered);
+    c.clearDebugTrace();
+
+    auto erase_cnt =
+        erase_if(
+            c,
+            [](const vs_test::TestValue &value) {
+                return value.val == 2;
+            });
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"retain(Pred)", "start"},
+                {"retain(Pred)", "rmSize:2"}
+            }));
+
+    EXPECT_EQ(erase_cnt, 2u);
+    EXPECT_EQ(c.size(), 4u);
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(8, 0, 5, 6));
+}
+
+TEST_F(EraseIf, OrderedEraseIfNone) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    auto erase_cnt =
+        erase_if(
+            c,
+            [](const vs_test::TestValue &value) {
+                return value.val > 10;
+            });
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"retain(Pred)", "start"},
+                {"retain(Pred)", "rmSize:0"}
+            }));
+
+    EXPECT_EQ(erase_cnt, 0u);
+    EXPECT_EQ(c.size(), 5u);
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 8));
+
+    // still ordered: lookup works without re-sort
+    EXPECT_TRUE(c.contains(6));
+}
@@ -0,0 +1,154 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "EraseMany.h"
+
+#include "TestUtils.h"
+
+
+TEST_P(EraseMany, Basic) {
+    const auto &param = GetParam();
+    auto &c = container;
+    auto mode =
+        (param.ordered
+         ? vectorset_mode::unique_ordered
+         : vectorset_mode::unordered);
+
+    c.set_mode(mode);
+
+    auto erase_cnt = c.erase_many(param.keys.begin(), param.keys.end());
+
+    EXPECT_TRUE(vs_test::checkTrace(c.getDebugTrace(), param.trace));
+    EXPECT_EQ(erase_cnt, param.expectedErased);
+    EXPECT_EQ(c.size(), param.expectedSize);
+    EXPECT_EQ(c.get_mode(), mode);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, param.expectedResult);
+}
+
+
+// Test parameters:
+std::vector<vs_test::EraseManyParam>
+vs_test::EraseManyParam::caseUnordered = {
+    {
+        "unsorted", { 6, 2, 9, 2 }, false,
+        /* = */ 3, 3, { 8, 0, 5 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"set_mode(vectorset_mode)", "mode-equal"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "sort-keys"},
+            {"erase_many(InputIt,InputIt)", "keys:3"},
+            {"impl_erase_many_unordered(const vector_type&)", "start"},
+            {"impl_erase_many_unordered(const vector_type&)", "rmSize:3"}
+        }
+    }, {
+        "none", { 1, 3 }, false,
+        /* = */ 0, 6, { 8, 0, 2, 5, 2, 6 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"set_mode(vectorset_mode)", "mode-equal"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "keys:2"},
+            {"impl_erase_many_unordered(const vector_type&)", "start"},
+            {"impl_erase_many_unordered(const vector_type&)", "rmSize:0"}
+        }
+    }, {
+        "empty", { }, false,
+        /* = */ 0, 6, { 8, 0, 2, 5, 2, 6 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"set_mode(vectorset_mode)", "mode-equal"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "keys:0"}
+        }
+    }
+};
+
+
+std::vector<vs_test::EraseManyParam>
+vs_test::EraseManyParam::caseOrdered = {
+    {
+        "unsorted", { 8, 3, 0, 5, 8 }, true,
+        /* = */ 3, 2, { 2, 6 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"make_unique_ordered()", "start"},
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "sort-keys"},
+            {"erase_many(InputIt,InputIt)", "keys:4"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "start"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "rmSize:3"}
+        }
+    }, {
+        "sorted", { 2, 6 }, true,
+        /* = */ 2, 3, { 0, 5, 8 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"make_unique_ordered()", "start"},
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "keys:2"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "start"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "rmSize:2"}
+        }
+    }, {
+        "none", { -1, 4, 9 }, true,
+        /* = */ 0, 5, { 0, 2, 5, 6, 8 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"make_unique_ordered()", "start"},
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "keys:3"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "start"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "rmSize:0"}
+        }
+    }, {
+        "all", { 0, 2, 5, 6, 8 }, true,
+        /* = */ 5, 0, { },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"make_unique_ordered()", "start"},
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"erase_many(InputIt,InputIt)", "start"},
+            {"erase_many(InputIt,InputIt)", "keys:5"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "start"},
+            {"impl_erase_many_unique_ordered(const vector_type&)", "rmSize:5"}
+        }
+    }
+};
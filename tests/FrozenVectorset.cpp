@@ -0,0 +1,207 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#include "FrozenVectorset.h"
+
+#include "TestUtils.h"
+#include "frozen_vectorset.h"
+
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <random>
+
+
+namespace {
+
+    /// Check all lookups of `frozen` against `expected`.
+    template<class UInt>
+    void
+    checkFrozen(
+        const frozen_vectorset<UInt> &frozen,
+        const std::set<UInt> &expected,
+        const std::vector<UInt> &probes)
+    {
+        ASSERT_EQ(frozen.size(), expected.size());
+        ASSERT_TRUE(
+            std::equal(frozen.begin(), frozen.end(), expected.begin()));
+
+        std::size_t idx = 0;
+        for (auto value : expected) {
+            ASSERT_EQ(frozen[idx], value);
+            ++idx;
+        }
+
+        for (auto probe : probes) {
+            auto iter = frozen.lower_bound(probe);
+            auto expectedIter = expected.lower_bound(probe);
+
+            ASSERT_EQ(iter == frozen.end(), expectedIter == expected.end());
+            if (iter != frozen.end()) {
+                ASSERT_EQ(*iter, *expectedIter);
+                ASSERT_EQ(
+                    iter.index(),
+                    static_cast<std::size_t>(
+                        std::distance(expected.begin(), expectedIter)));
+            }
+
+            auto upper = frozen.upper_bound(probe);
+            auto expectedUpper = expected.upper_bound(probe);
+
+            ASSERT_EQ(
+                upper == frozen.end(), expectedUpper == expected.end());
+            if (upper != frozen.end()) {
+                ASSERT_EQ(*upper, *expectedUpper);
+            }
+
+            ASSERT_EQ(frozen.contains(probe), expected.count(probe) != 0);
+            ASSERT_EQ(frozen.count(probe), expected.count(probe));
+        }
+    }
+
+} // namespace
+
+
+TEST_F(FrozenVectorset, Freeze) {
+    auto set = vs_test::make_vectorset<uint32_t>(17, 3, 5, 1000, 8, 9, 3);
+
+    EXPECT_THROW(freeze(set), std::logic_error);
+
+    set.set_mode(vectorset_mode::unique_ordered);
+
+    auto frozen = freeze(set);
+
+    EXPECT_EQ(frozen.size(), 6u);
+    EXPECT_FALSE(frozen.empty());
+    EXPECT_EQ(
+        std::vector<uint32_t>(frozen.begin(), frozen.end()),
+        vs_test::make_vector<uint32_t>(3, 5, 8, 9, 17, 1000));
+    EXPECT_EQ(frozen.front(), 3u);
+    EXPECT_EQ(frozen.back(), 1000u);
+    EXPECT_EQ(frozen[4], 17u);
+    EXPECT_THROW(frozen.at(6), std::out_of_range);
+
+    EXPECT_TRUE(frozen.contains(9));
+    EXPECT_FALSE(frozen.contains(10));
+    EXPECT_EQ(*frozen.find(17), 17u);
+    EXPECT_EQ(frozen.find(18), frozen.end());
+    EXPECT_EQ(*frozen.lower_bound(10), 17u);
+    EXPECT_EQ(*frozen.upper_bound(9), 17u);
+    EXPECT_EQ(frozen.lower_bound(1001), frozen.end());
+    EXPECT_EQ(frozen.upper_bound(1000), frozen.end());
+
+    auto range = frozen.equal_range(8);
+    EXPECT_EQ(std::distance(range.first, range.second), 1);
+
+    EXPECT_TRUE(frozen.to_vectorset() == set);
+
+    frozen_vectorset<uint32_t> empty;
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+    EXPECT_FALSE(empty.contains(0));
+    EXPECT_EQ(empty.lower_bound(0), empty.end());
+
+    std::vector<uint32_t> unsorted = { 3, 2 };
+    EXPECT_THROW(
+        frozen_vectorset<uint32_t>(unsorted.begin(), unsorted.end()),
+        std::logic_error);
+}
+
+
+TEST_F(FrozenVectorset, Dense) {
+    // no low bits
+    std::set<uint32_t> expected;
+    std::vector<uint32_t> probes;
+
+    for (uint32_t val = 0; val < 3000; ++val) {
+        if (val % 3 != 1) {
+            expected.insert(val);
+        }
+        probes.push_back(val);
+    }
+
+    frozen_vectorset<uint32_t> frozen(expected.begin(), expected.end());
+
+    EXPECT_EQ(frozen.low_bits(), 0u);
+    checkFrozen(frozen, expected, probes);
+}
+
+
+TEST_F(FrozenVectorset, Random32) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<uint32_t> dist;
+
+    std::set<uint32_t> expected;
+    std::vector<uint32_t> probes = { 0, ~uint32_t(0) };
+
+    while (expected.size() < 20000) {
+        expected.insert(dist(gen));
+    }
+    for (auto value : expected) {
+        probes.push_back(value);
+        probes.push_back(value + 1);
+        probes.push_back(value - 1);
+    }
+
+    frozen_vectorset<uint32_t> frozen(expected.begin(), expected.end());
+
+    checkFrozen(frozen, expected, probes);
+
+    // 2 + log2(U / n) bits per element plus samples
+    auto bits = 8.0 * frozen.memory_bytes() / frozen.size();
+    auto bound =
+        2.0 + std::log2(4294967296.0 / frozen.size()) + 1.0;
+
+    EXPECT_LT(bits, bound);
+    EXPECT_LT(frozen.memory_bytes(), expected.size() * sizeof(uint32_t));
+}
+
+
+TEST_F(FrozenVectorset, Random64) {
+    std::mt19937_64 gen(4711);
+
+    std::set<uint64_t> expected = { ~uint64_t(0) };
+    std::vector<uint64_t> probes = { 0, ~uint64_t(0), ~uint64_t(0) - 1 };
+
+    while (expected.size() < 20000) {
+        expected.insert(gen() >> (gen() % 64));
+    }
+    for (auto value : expected) {
+        probes.push_back(value);
+        probes.push_back(value + 1);
+        probes.push_back(value - 1);
+    }
+
+    vectorset<uint64_t> set(expected.begin(), expected.end());
+
+    set.set_mode(vectorset_mode::unique_ordered);
+
+    auto frozen = freeze(set);
+
+    checkFrozen(frozen, expected, probes);
+    EXPECT_LT(frozen.memory_bytes(), expected.size() * sizeof(uint64_t));
+}
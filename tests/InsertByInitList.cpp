@@ -51,6 +51,35 @@ TEST_P(InsertByInitList, Basic) {
     EXPECT_EQ(c, param.expectedResult);
 }
 
+TEST_P(InsertByInitList, Assign) {
+    const auto &param = GetParam();
+    auto &c = container;
+
+    auto mode =
+        (param.ordered
+         ? vectorset_mode::unique_ordered
+         : vectorset_mode::unordered);
+
+    c.set_mode(mode);
+
+    auto &result =
+        (c = {
+            vs_test::TestValue(7),
+            vs_test::TestValue(3),
+            vs_test::TestValue(7),
+        });
+
+    EXPECT_EQ(&result, &c);
+    EXPECT_EQ(c.get_mode(), mode);
+
+    if (param.ordered) {
+        EXPECT_EQ(c, vs_test::make_vector<int>(3, 7));
+    }
+    else {
+        EXPECT_EQ(c, vs_test::make_vector<int>(7, 3, 7));
+    }
+}
+
 std::vector<vs_test::InsertByInitListParam>
 vs_test::InsertByInitListParam::caseUnordered = {
     {
@@ -79,10 +108,10 @@ vs_test::InsertByInitListParam::caseOrdered = {
             {"insert(std::initializer_list<value_type>)",
              "start"},
             {"insert(std::initializer_list<value_type>)",
-             "call:make_unique_ordered()"},
+             "call:impl_insert_range_unique_ordered(InputIt,InputIt)"},
 
-            {"make_unique_ordered()", "start"},
-            {"make_unique_ordered()", "rmIter:6(9)"}
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "start"},
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "new:1"}
         }
     }
 };
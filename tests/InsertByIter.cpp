@@ -83,10 +83,45 @@ vs_test::InsertByIterParam::caseOrdered = {
             {"set_mode(vectorset_mode)", "mode-ordered"},
 
             {"insert(InputIt,InputIt)", "start"},
-            {"insert(InputIt,InputIt)", "call:make_unique_ordered()"},
+            {"insert(InputIt,InputIt)",
+             "call:impl_insert_range_unique_ordered(InputIt,InputIt)"},
 
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "start"},
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "new:1"}
+        }
+    },
+    {
+        "merge", { 9, 7, 1, 3, 3, -2, 4, 8 }, true,
+        /* = */ 11, false, { -2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
             {"make_unique_ordered()", "start"},
-            {"make_unique_ordered()", "rmIter:6(9)"}
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"insert(InputIt,InputIt)", "start"},
+            {"insert(InputIt,InputIt)",
+             "call:impl_insert_range_unique_ordered(InputIt,InputIt)"},
+
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "start"},
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "new:6"}
+        }
+    },
+    {
+        "allPresent", { 8, 0, 5 }, true,
+        /* = */ 5, true, { 0, 2, 5, 6, 8 },
+        {
+            {"set_mode(vectorset_mode)", "start"},
+            {"make_unique_ordered()", "start"},
+            {"make_unique_ordered()", "rmIter:5(6)"},
+            {"set_mode(vectorset_mode)", "mode-ordered"},
+
+            {"insert(InputIt,InputIt)", "start"},
+            {"insert(InputIt,InputIt)",
+             "call:impl_insert_range_unique_ordered(InputIt,InputIt)"},
+
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "start"},
+            {"impl_insert_range_unique_ordered(InputIt,InputIt)", "new:0"}
         }
     }
 };
@@ -0,0 +1,216 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "LogarithmicVectorset.h"
+
+#include "TestUtils.h"
+#include "logarithmic_vectorset.h"
+
+#include <set>
+#include <random>
+
+
+TEST_F(LogarithmicVectorset, InsertRun) {
+    logarithmic_vectorset<int> c = { 8, 0, 2, 5, 2, 6 };
+
+    EXPECT_EQ(c.size(), 5u);
+    EXPECT_EQ(c.run_count(), 1u);
+
+    auto result = c.insert(3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "insert-run"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 3);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 2);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 3, 5, 6, 8));
+
+    c.clearDebugTrace();
+    result = c.insert(5);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "found-no-insert"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 5);
+}
+
+
+TEST_F(LogarithmicVectorset, MergeRuns) {
+    logarithmic_vectorset<int> c;
+
+    for (int val = 0; val < 16; ++val) {
+        c.insert(val * 2);
+    }
+
+    c.clearDebugTrace();
+    auto result = c.insert(7);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "merge:1"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 7);
+    EXPECT_EQ(*std::next(result.first), 8);
+    EXPECT_EQ(c.run_count(), 1u);
+
+    // fill run 0 again and merge both runs into run 2
+    for (int val = 0; val < 16; ++val) {
+        c.insert(val * 2 + 41);
+    }
+
+    EXPECT_EQ(c.run_count(), 2u);
+
+    c.clearDebugTrace();
+    result = c.insert(1);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "merge:2"}
+            }));
+
+    EXPECT_EQ(*result.first, 1);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 1);
+    EXPECT_EQ(c.run_count(), 1u);
+    EXPECT_EQ(c.size(), 34u);
+}
+
+
+TEST_F(LogarithmicVectorset, Compact) {
+    logarithmic_vectorset<int> c;
+
+    for (int val = 0; val < 100; ++val) {
+        c.insert((val * 37) % 100);
+    }
+
+    EXPECT_EQ(c.run_count(), 3u);
+
+    c.clearDebugTrace();
+    c.compact();
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"compact()", "start:3"}
+            }));
+
+    EXPECT_EQ(c.run_count(), 1u);
+    EXPECT_EQ(c.size(), 100u);
+
+    int expected = 0;
+    for (auto val : c) {
+        EXPECT_EQ(val, expected++);
+    }
+
+    EXPECT_EQ(*c.lower_bound(50), 50);
+    EXPECT_EQ(*c.upper_bound(50), 51);
+    EXPECT_EQ(c.upper_bound(99), c.end());
+}
+
+
+TEST_F(LogarithmicVectorset, RandomOperations) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    logarithmic_vectorset<int> c;
+    std::set<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        auto val = dist(gen);
+
+        switch (step % 3) {
+        case 0:
+        case 1: {
+            auto result = c.insert(val);
+            auto expectedResult = expected.insert(val);
+
+            ASSERT_EQ(result.second, expectedResult.second);
+            ASSERT_EQ(*result.first, val);
+
+            auto next = std::next(result.first);
+            auto expectedNext = std::next(expectedResult.first);
+
+            ASSERT_EQ(next == c.end(), expectedNext == expected.end());
+            if (next != c.end()) {
+                ASSERT_EQ(*next, *expectedNext);
+            }
+            break;
+        }
+        case 2:
+            if (step % 2 == 0) {
+                ASSERT_EQ(c.erase(val), expected.erase(val));
+            }
+            else {
+                auto iter = c.lower_bound(val);
+                auto expectedIter = expected.lower_bound(val);
+
+                ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+                if (iter != c.end()) {
+                    auto next = c.erase(iter);
+                    auto expectedNext = expected.erase(expectedIter);
+
+                    ASSERT_EQ(next == c.end(), expectedNext == expected.end());
+                    if (next != c.end()) {
+                        ASSERT_EQ(*next, *expectedNext);
+                    }
+                }
+            }
+            break;
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(c.contains(val), expected.count(val) != 0);
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+
+    c.compact();
+
+    EXPECT_EQ(c.size(), expected.size());
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
@@ -0,0 +1,120 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "Merge.h"
+
+
+TEST_F(Merge, Ordered) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    auto source = vs_test::make_vectorset<vs_test::TestValue>(9, 2, 8, 1);
+    source.set_mode(vectorset_mode::unique_ordered);
+
+    c.clearDebugTrace();
+    c.merge(source);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"merge(vectorset&)", "start"},
+                {"merge(vectorset&)", "new:2"},
+                {"merge(vectorset&)", "remain:2"}
+            }));
+
+    EXPECT_EQ(c.size(), 7u);
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 1, 2, 5, 6, 8, 9));
+
+    // duplicates remain in source
+    EXPECT_EQ(source.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(hasNoCopiedElem(source));
+    EXPECT_EQ(source, vs_test::make_vector<int>(2, 8));
+}
+
+TEST_F(Merge, OrderedUnorderedSource) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    auto source = vs_test::make_vectorset<vs_test::TestValue>(9, 2, 3, 3, 1);
+    source.set_mode(vectorset_mode::unordered);
+
+    c.clearDebugTrace();
+    c.merge(source);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"merge(vectorset&)", "start"},
+                {"merge(vectorset&)", "sort-source"},
+                {"merge(vectorset&)", "new:3"},
+                {"merge(vectorset&)", "remain:2"}
+            }));
+
+    EXPECT_EQ(c.size(), 8u);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 1, 2, 3, 5, 6, 8, 9));
+
+    EXPECT_EQ(source.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(source, vs_test::make_vector<int>(2, 3));
+}
+
+TEST_F(Merge, Unordered) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unordered);
+    c.clearDebugTrace();
+
+    c.merge(vs_test::make_vectorset<vs_test::TestValue>(1, 2));
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"merge(vectorset&)", "start"},
+                {"merge(vectorset&)", "append:2"}
+            }));
+
+    EXPECT_EQ(c.size(), 8u);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(8, 0, 2, 5, 2, 6, 1, 2));
+}
+
+
+TEST_F(Merge, Extract) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    auto result = c.extract(std::next(c.begin()), std::next(c.begin(), 3));
+
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 6, 8));
+
+    EXPECT_EQ(result.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_TRUE(hasNoCopiedElem(result));
+    EXPECT_EQ(result, vs_test::make_vector<int>(2, 5));
+}
@@ -0,0 +1,285 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "OrderedMode.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+
+
+namespace {
+    using Entry = std::pair<int, std::string>;
+
+    /// Compare entries by first element only.
+    struct EntryLess {
+        bool
+        operator()(const Entry &lhv, const Entry &rhv) const {
+            return lhv.first < rhv.first;
+        }
+    };
+
+    /// Second elements of all entries.
+    std::vector<std::string>
+    seconds(const vectorset<Entry, EntryLess> &c) {
+        std::vector<std::string> result;
+
+        for (const auto &entry : c) {
+            result.push_back(entry.second);
+        }
+
+        return result;
+    }
+}
+
+
+TEST_F(OrderedMode, SetMode) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::ordered);
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::ordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 2, 5, 6, 8));
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 8));
+
+    c.set_mode(vectorset_mode::ordered);
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::ordered);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 8));
+
+    c.set_mode(vectorset_mode::unordered);
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 8));
+}
+
+TEST_F(OrderedMode, Stable) {
+    vectorset<Entry, EntryLess> c = {
+        {3, "a"}, {1, "b"}, {3, "c"}, {2, "d"}, {1, "e"}};
+
+    c.set_mode(vectorset_mode::ordered);
+
+    EXPECT_EQ(
+        seconds(c), vs_test::make_vector<std::string>("b", "e", "d", "a", "c"));
+
+    // equal elements keep their insertion order
+    c.insert(Entry(3, "f"));
+    c.emplace(1, "g");
+    c.insert(c.begin(), Entry(2, "h"));
+    c.insert({Entry(2, "i"), Entry(0, "j"), Entry(2, "k")});
+
+    EXPECT_EQ(
+        seconds(c),
+        vs_test::make_vector<std::string>(
+            "j", "b", "e", "g", "d", "h", "i", "k", "a", "c", "f"));
+
+    // merge places new elements behind equal elements
+    vectorset<Entry, EntryLess> source = {{3, "l"}, {0, "m"}, {3, "n"}};
+    c.merge(source);
+
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(
+        seconds(c),
+        vs_test::make_vector<std::string>(
+            "j", "m", "b", "e", "g", "d", "h", "i", "k", "a", "c", "f", "l",
+            "n"));
+}
+
+TEST_F(OrderedMode, Insert) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::ordered);
+
+    auto result = c.insert(vs_test::TestValue(5));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 4);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 2, 5, 5, 6, 8));
+
+    // wrong hint
+    auto iter = c.insert(c.begin(), vs_test::TestValue(6));
+
+    EXPECT_EQ(std::distance(c.begin(), iter), 6);
+
+    // correct hint
+    iter = c.insert(c.end(), vs_test::TestValue(9));
+
+    EXPECT_EQ(std::distance(c.begin(), iter), 8);
+
+    iter = c.emplace_hint(c.begin(), 0);
+
+    EXPECT_EQ(std::distance(c.begin(), iter), 1);
+
+    EXPECT_TRUE(hasNoCopiedElem(c));
+
+    c.insert({7, 2, 7});
+
+    EXPECT_EQ(
+        c, vs_test::make_vector<int>(0, 0, 2, 2, 2, 5, 5, 6, 6, 7, 7, 8, 9));
+
+    EXPECT_THROW(c.push_back(vs_test::TestValue(10)), std::logic_error);
+    EXPECT_THROW(c.resize(20), std::logic_error);
+}
+
+TEST_F(OrderedMode, EmplaceHint) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::ordered);
+    c.clearDebugTrace();
+
+    // correct hint: append at end
+    auto iter = c.emplace_hint(c.end(), 8);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_emplace_ordered(const_iterator,Args&&...)",
+                 "start:6(6)"},
+                {"impl_emplace_ordered(const_iterator,Args&&...)",
+                 "hint-on-spot:6(7)"},
+                {"move_into_position", "start:6(7) to 6(7)"}
+            }));
+
+    EXPECT_EQ(std::distance(c.begin(), iter), 6);
+
+    // wrong hint: in front of equal value
+    c.clearDebugTrace();
+    iter = c.emplace_hint(std::next(c.begin(), 1), 2);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_emplace_ordered(const_iterator,Args&&...)",
+                 "start:1(7)"},
+                {"impl_emplace_ordered(const_iterator,Args&&...)",
+                 "upper_bound:3(8)"},
+                {"move_into_position", "start:7(8) to 3(8)"},
+                {"move_into_position", "shift:4"}
+            }));
+
+    EXPECT_EQ(std::distance(c.begin(), iter), 3);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 2, 2, 5, 6, 8, 8));
+}
+
+TEST_F(OrderedMode, Lookup) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::ordered);
+    c.insert({2, 6, 2});
+
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 2, 2, 2, 5, 6, 6, 8));
+
+    EXPECT_EQ(c.count(2), 4u);
+    EXPECT_EQ(c.count(6), 2u);
+    EXPECT_EQ(c.count(8), 1u);
+    EXPECT_EQ(c.count(3), 0u);
+    EXPECT_EQ(c.count(vs_test::MiscInt(2)), 4u);
+
+    EXPECT_EQ(std::distance(c.begin(), c.find(2)), 1);
+    EXPECT_EQ(c.find(3), c.end());
+    EXPECT_TRUE(c.contains(6));
+    EXPECT_FALSE(c.contains(7));
+
+    auto range = c.equal_range(2);
+
+    EXPECT_EQ(std::distance(c.begin(), range.first), 1);
+    EXPECT_EQ(std::distance(c.begin(), range.second), 5);
+
+    range = c.equal_range(3);
+
+    EXPECT_EQ(range.first, range.second);
+    EXPECT_EQ(std::distance(c.begin(), range.first), 5);
+
+    EXPECT_EQ(std::distance(c.begin(), c.lower_bound(6)), 6);
+    EXPECT_EQ(std::distance(c.begin(), c.upper_bound(6)), 8);
+}
+
+TEST_F(OrderedMode, Erase) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::ordered);
+    c.insert({2, 6, 2, 9});
+
+    EXPECT_EQ(c.erase(2), 4u);
+    EXPECT_EQ(c.erase(3), 0u);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 5, 6, 6, 8, 9));
+
+    auto keys = vs_test::make_vector<int>(6, 9, 1);
+
+    EXPECT_EQ(c.erase_many(keys.begin(), keys.end()), 3u);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 5, 8));
+    EXPECT_EQ(c.get_mode(), vectorset_mode::ordered);
+}
+
+TEST_F(OrderedMode, Random) {
+    std::mt19937 gen(50);
+    std::uniform_int_distribution<int> dist(0, 200);
+
+    vectorset<int> c;
+    std::multiset<int> ref;
+
+    c.set_mode(vectorset_mode::ordered);
+
+    for (int i = 0; i < 2000; ++i) {
+        int value = dist(gen);
+
+        switch (i % 5) {
+        case 0:
+        case 1:
+            c.insert(value);
+            ref.insert(value);
+            break;
+
+        case 2: {
+            std::vector<int> range = {value, dist(gen), value};
+            c.insert(range.begin(), range.end());
+            ref.insert(range.begin(), range.end());
+            break;
+        }
+
+        case 3:
+            EXPECT_EQ(c.count(value), ref.count(value));
+            break;
+
+        default:
+            if (i % 15 == 4) {
+                EXPECT_EQ(c.erase(value), ref.erase(value));
+            }
+            else {
+                c.emplace(value);
+                ref.insert(value);
+            }
+        }
+    }
+
+    EXPECT_EQ(c.size(), ref.size());
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), ref.begin()));
+}
@@ -0,0 +1,121 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "ParallelSetAlgebra.h"
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+
+namespace {
+    /**
+     * Create unique ordered vectorset of random values.
+     */
+    vectorset<int>
+    randomSet(std::mt19937 &gen, size_t count, int maxVal) {
+        std::uniform_int_distribution<int> dist(0, maxVal);
+        std::vector<int> values;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            values.push_back(dist(gen));
+        }
+
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        return vectorset<int>(vectorset_sorted_unique, std::move(values));
+    }
+
+    std::vector<int>
+    toVector(const vectorset<int> &c) {
+        return std::vector<int>(c.begin(), c.end());
+    }
+} // namespace
+
+
+TEST_F(ParallelSetAlgebra, Operations) {
+    std::mt19937 gen(4711);
+    std::vector<std::pair<size_t, size_t>> sizes = {
+        {0, 0}, {100, 50}, {200000, 150000}, {300000, 1000}, {10, 250000}
+    };
+
+    for (const auto &size : sizes) {
+        auto lhs = randomSet(gen, size.first, 1000000);
+        auto rhs = randomSet(gen, size.second, 1000000);
+
+        for (unsigned threads : { 1u, 3u, 4u }) {
+            EXPECT_EQ(
+                toVector(parallel_set_union(lhs, rhs, threads)),
+                toVector(set_union(lhs, rhs)));
+            EXPECT_EQ(
+                toVector(parallel_set_intersection(lhs, rhs, threads)),
+                toVector(set_intersection(lhs, rhs)));
+            EXPECT_EQ(
+                toVector(parallel_set_difference(lhs, rhs, threads)),
+                toVector(set_difference(lhs, rhs)));
+            EXPECT_EQ(
+                toVector(parallel_set_difference(rhs, lhs, threads)),
+                toVector(set_difference(rhs, lhs)));
+            EXPECT_EQ(
+                toVector(
+                    parallel_set_symmetric_difference(lhs, rhs, threads)),
+                toVector(set_symmetric_difference(lhs, rhs)));
+        }
+    }
+
+    vectorset<int> unordered = { 1, 2 };
+
+    EXPECT_THROW(
+        parallel_set_union(unordered, unordered, 2), std::logic_error);
+}
+
+
+TEST_F(ParallelSetAlgebra, Merge) {
+    std::mt19937 gen(4711);
+
+    for (unsigned threads : { 1u, 4u }) {
+        auto target = randomSet(gen, 200000, 1000000);
+        auto source = randomSet(gen, 150000, 1000000);
+
+        auto expectedTarget = set_union(target, source);
+        auto expectedSource = set_intersection(source, target);
+
+        parallel_merge(target, source, threads);
+
+        EXPECT_EQ(target.get_mode(), vectorset_mode::unique_ordered);
+        EXPECT_EQ(source.get_mode(), vectorset_mode::unique_ordered);
+        EXPECT_EQ(toVector(target), toVector(expectedTarget));
+        EXPECT_EQ(toVector(source), toVector(expectedSource));
+    }
+
+    vectorset<int> unordered = { 1, 2 };
+    auto ordered = randomSet(gen, 10, 100);
+
+    EXPECT_THROW(parallel_merge(ordered, unordered, 2), std::logic_error);
+}
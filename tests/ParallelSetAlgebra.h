@@ -0,0 +1,47 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#ifndef VECTOR_SET_TEST_PARALLEL_SET_ALGEBRA_H
+#define VECTOR_SET_TEST_PARALLEL_SET_ALGEBRA_H 1
+
+#define _VECTOR_SET_DO_TRACE 1
+#include "vectorset_parallel.h"
+
+#include "gtest/gtest.h"
+
+// parallel set algebra:
+// parallel_set_union(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_intersection(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_difference(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_symmetric_difference(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_merge(vectorset& target, vectorset& source, threads)
+////////////////////////////////////////////////////////////////////////
+
+
+class ParallelSetAlgebra : public testing::Test {
+};
+
+
+#endif /* VECTOR_SET_TEST_PARALLEL_SET_ALGEBRA_H */
@@ -0,0 +1,202 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "PmaVectorset.h"
+
+#include "TestUtils.h"
+#include "pma_vectorset.h"
+
+#include <set>
+#include <random>
+
+
+TEST_F(PmaVectorset, InsertSegment) {
+    pma_vectorset<int> c = { 8, 0, 2, 5, 2, 6 };
+
+    EXPECT_EQ(c.size(), 5u);
+    EXPECT_EQ(c.capacity(), 32u);
+
+    c.clearDebugTrace();
+    auto result = c.insert(3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "insert-segment"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 3);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 2);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 3, 5, 6, 8));
+    EXPECT_EQ(
+        std::vector<int>(c.rbegin(), c.rend()),
+        vs_test::make_vector<int>(8, 6, 5, 3, 2, 0));
+
+    c.clearDebugTrace();
+    result = c.insert(5);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "found-no-insert"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 5);
+}
+
+
+TEST_F(PmaVectorset, InsertRebalance) {
+    pma_vectorset<int> c = { 0, 100, 200, 300, 400 };
+
+    // fill second segment
+    for (int val = 101; val < 108; ++val) {
+        c.insert(val);
+    }
+
+    c.clearDebugTrace();
+    auto result = c.insert(108);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_insert(ValType&&)", "start"},
+                {"impl_insert(ValType&&)", "segment-full"},
+                {"insert_rebalance(...)", "level:1"},
+                {"distribute(...)", "segments:2"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 108);
+    EXPECT_EQ(*std::next(result.first), 200);
+    EXPECT_EQ(*std::prev(result.first), 107);
+    EXPECT_EQ(c.size(), 13u);
+    EXPECT_EQ(c.capacity(), 32u);
+}
+
+
+TEST_F(PmaVectorset, GrowShrink) {
+    pma_vectorset<int> c;
+
+    for (int val = 0; val < 1000; ++val) {
+        c.insert(val);
+    }
+
+    EXPECT_EQ(c.size(), 1000u);
+    EXPECT_GE(c.capacity() * 3, c.size() * 4);
+
+    for (int val = 0; val < 995; ++val) {
+        EXPECT_EQ(c.erase(val), 1u);
+    }
+
+    EXPECT_EQ(c.capacity(), 32u);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(995, 996, 997, 998, 999));
+}
+
+
+TEST_F(PmaVectorset, Bounds) {
+    pma_vectorset<int> c = { 8, 0, 2, 5, 6 };
+
+    EXPECT_EQ(*c.lower_bound(-1), 0);
+    EXPECT_EQ(*c.lower_bound(3), 5);
+    EXPECT_EQ(*c.lower_bound(5), 5);
+    EXPECT_EQ(*c.upper_bound(5), 6);
+    EXPECT_EQ(*c.upper_bound(7), 8);
+    EXPECT_EQ(c.upper_bound(8), c.end());
+    EXPECT_EQ(c.find(4), c.end());
+    EXPECT_EQ(c.count(6), 1u);
+
+    auto iter = c.erase(c.find(6));
+    EXPECT_EQ(*iter, 8);
+
+    iter = c.erase(iter);
+    EXPECT_EQ(iter, c.end());
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 5));
+}
+
+
+TEST_F(PmaVectorset, RandomOperations) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    pma_vectorset<int> c;
+    std::set<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        auto val = dist(gen);
+
+        switch (step % 3) {
+        case 0:
+        case 1: {
+            auto result = c.insert(val);
+            auto expectedResult = expected.insert(val);
+
+            ASSERT_EQ(result.second, expectedResult.second);
+            ASSERT_EQ(*result.first, val);
+            break;
+        }
+        case 2:
+            if (step % 2 == 0) {
+                ASSERT_EQ(c.erase(val), expected.erase(val));
+            }
+            else {
+                auto iter = c.lower_bound(val);
+                auto expectedIter = expected.lower_bound(val);
+
+                ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+                if (iter != c.end()) {
+                    auto next = c.erase(iter);
+                    auto expectedNext = expected.erase(expectedIter);
+
+                    ASSERT_EQ(next == c.end(), expectedNext == expected.end());
+                    if (next != c.end()) {
+                        ASSERT_EQ(*next, *expectedNext);
+                    }
+                }
+            }
+            break;
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(c.contains(val), expected.count(val) != 0);
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+    EXPECT_TRUE(std::equal(c.rbegin(), c.rend(), expected.rbegin()));
+}
@@ -0,0 +1,124 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "Relocate.h"
+
+#include "TestUtils.h"
+
+#include <string>
+
+
+TEST_F(Relocate, TriviallyCopyableEmplace) {
+    vectorset<int> c = { 8, 0, 2, 5, 2, 6 };
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    auto result = c.emplace(3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_emplace_unique_ordered(Args&&...)", "start"},
+                {"impl_insert_emplace_unique_ordered", "start"},
+                {"impl_insert_emplace_unique_ordered", "last:5(6)"},
+                {"impl_insert_emplace_unique_ordered", "iter:2(6)"},
+                {"impl_insert_emplace_unique_ordered", "move-into-position"},
+                {"move_into_position", "start:5(6) to 2(6)"},
+                {"move_into_position", "relocate:3"},
+                {"impl_emplace_unique_ordered(Args&&...)", "insert:true"},
+                {"impl_emplace_unique_ordered(Args&&...)", "iter:2(6)"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 3);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(0, 2, 3, 5, 6, 8));
+}
+
+
+TEST_F(Relocate, NotRelocatableEmplace) {
+    vectorset<std::string> c = { "b", "d", "f" };
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    c.emplace("a");
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"impl_emplace_unique_ordered(Args&&...)", "start"},
+                {"impl_insert_emplace_unique_ordered", "start"},
+                {"impl_insert_emplace_unique_ordered", "last:3(4)"},
+                {"impl_insert_emplace_unique_ordered", "iter:0(4)"},
+                {"impl_insert_emplace_unique_ordered", "move-into-position"},
+                {"move_into_position", "start:3(4) to 0(4)"},
+                {"move_into_position", "shift:3"},
+                {"impl_emplace_unique_ordered(Args&&...)", "insert:true"},
+                {"impl_emplace_unique_ordered(Args&&...)", "iter:0(4)"}
+            }));
+
+    EXPECT_EQ(
+        std::vector<std::string>(c.begin(), c.end()),
+        std::vector<std::string>({ "a", "b", "d", "f" }));
+}
+
+
+TEST_F(Relocate, UserDeclaredInsertErase) {
+    vectorset<vs_test::RelocRecord> c;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    for (int val : { 8, 0, 6, 2, 5 }) {
+        c.insert(vs_test::RelocRecord(val));
+    }
+
+    std::vector<const int*> addresses;
+    for (const auto &record : c) {
+        addresses.push_back(record.ptr.get());
+    }
+
+    auto result = c.insert(vs_test::RelocRecord(3));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first->ptr, 3);
+    ASSERT_EQ(c.size(), 6u);
+
+    // erase "5" and "6"
+    EXPECT_EQ(c.erase(c.begin()[3]), 1u);
+    EXPECT_EQ(c.erase(c.begin()[3]), 1u);
+
+    std::vector<int> vals;
+    for (const auto &record : c) {
+        vals.push_back(*record.ptr);
+    }
+
+    EXPECT_EQ(vals, vs_test::make_vector<int>(0, 2, 3, 8));
+
+    // the owned objects are relocated, not copied or destroyed.
+    EXPECT_EQ(c.begin()[0].ptr.get(), addresses[0]);
+    EXPECT_EQ(c.begin()[1].ptr.get(), addresses[1]);
+    EXPECT_EQ(c.begin()[3].ptr.get(), addresses[4]);
+}
@@ -0,0 +1,66 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef VECTOR_SET_TEST_RELOCATE_H
+#define VECTOR_SET_TEST_RELOCATE_H 1
+
+#define _VECTOR_SET_DO_TRACE 1
+#include "vectorset.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+// shift elements by relocation:
+// vectorset_is_trivially_relocatable<T>
+////////////////////////////////////////////////////////////////////////
+
+namespace vs_test {
+    /**
+     * Move only record, which is relocatable in practice.
+     */
+    struct RelocRecord {
+        std::unique_ptr<int> ptr;
+
+        explicit RelocRecord(int val) : ptr(new int(val)) {
+        }
+
+        bool
+        operator<(const RelocRecord &other) const noexcept {
+            return (*ptr < *other.ptr);
+        }
+    };
+} // namespace vs_test
+
+template<>
+struct vectorset_is_trivially_relocatable<vs_test::RelocRecord>
+    : std::true_type
+{};
+
+
+class Relocate : public testing::Test {
+};
+
+
+#endif /* VECTOR_SET_TEST_RELOCATE_H */
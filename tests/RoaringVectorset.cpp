@@ -0,0 +1,293 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+
+#include "RoaringVectorset.h"
+
+#include "TestUtils.h"
+#include "roaring_vectorset.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <set>
+#include <random>
+
+
+namespace {
+
+    /// Check all lookups of `c` against `expected`.
+    void
+    checkRoaring(
+        const roaring_vectorset &c,
+        const std::set<uint32_t> &expected,
+        const std::vector<uint32_t> &probes)
+    {
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+
+        for (auto probe : probes) {
+            auto iter = c.lower_bound(probe);
+            auto expectedIter = expected.lower_bound(probe);
+
+            ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+            if (iter != c.end()) {
+                ASSERT_EQ(*iter, *expectedIter);
+            }
+
+            auto upper = c.upper_bound(probe);
+            auto expectedUpper = expected.upper_bound(probe);
+
+            ASSERT_EQ(upper == c.end(), expectedUpper == expected.end());
+            if (upper != c.end()) {
+                ASSERT_EQ(*upper, *expectedUpper);
+            }
+
+            ASSERT_EQ(c.contains(probe), expected.count(probe) != 0);
+        }
+    }
+
+    /// Mix of dense ranges, runs and sparse keys.
+    std::set<uint32_t>
+    makeMixed(unsigned seed) {
+        std::mt19937 gen(seed);
+        std::uniform_int_distribution<uint32_t> dist;
+        std::set<uint32_t> result;
+
+        // dense range (bitmap chunk)
+        for (uint32_t val = 0x10000; val < 0x20000; ++val) {
+            if (dist(gen) % 4 != 0) {
+                result.insert(val);
+            }
+        }
+
+        // long runs
+        for (uint32_t start = 0x30000; start < 0x40000; start += 5000) {
+            auto length = dist(gen) % 3000;
+
+            for (uint32_t val = start; val < start + length; ++val) {
+                result.insert(val);
+            }
+        }
+
+        // sparse keys
+        while (result.size() < 120000) {
+            result.insert(dist(gen) % (1 << 24));
+        }
+
+        return result;
+    }
+
+} // namespace
+
+
+TEST_F(RoaringVectorset, ChunkTypes) {
+    roaring_vectorset c = { 0x50000, 7, 3, 0x10005, 7 };
+
+    EXPECT_EQ(c.size(), 4u);
+    EXPECT_EQ(c.chunk_count(), 3u);
+    EXPECT_EQ(c.chunk_type(0), roaring_chunk::array);
+    EXPECT_EQ(
+        std::vector<uint32_t>(c.begin(), c.end()),
+        vs_test::make_vector<uint32_t>(3, 7, 0x10005, 0x50000));
+
+    // array grows to bitmap
+    for (uint32_t val = 0; val < 8188; val += 2) {
+        c.insert(val);
+    }
+    EXPECT_EQ(c.chunk_type(0), roaring_chunk::array);
+
+    auto result = c.insert(8193);
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 8193u);
+    EXPECT_EQ(c.chunk_type(0), roaring_chunk::bitmap);
+    EXPECT_EQ(c.size(), 4099u);
+    EXPECT_FALSE(c.insert(8193).second);
+
+    // bitmap shrinks to array
+    EXPECT_EQ(c.erase(8193), 1u);
+    EXPECT_EQ(c.chunk_type(0), roaring_chunk::array);
+    EXPECT_EQ(c.erase(8193), 0u);
+
+    // consecutive keys are stored as runs
+    std::vector<uint32_t> range(60000);
+    std::iota(range.begin(), range.end(), 0x20000);
+
+    roaring_vectorset runs(range.begin(), range.end());
+
+    EXPECT_EQ(runs.chunk_count(), 1u);
+    EXPECT_EQ(runs.chunk_type(0), roaring_chunk::runs);
+    EXPECT_LT(runs.memory_bytes(), 100u);
+
+    // split runs until a bitmap is smaller
+    for (uint32_t val = 0x20001; val < 0x20000 + 60000; val += 2) {
+        ASSERT_EQ(runs.erase(val), 1u);
+    }
+    EXPECT_EQ(runs.chunk_type(0), roaring_chunk::bitmap);
+    EXPECT_EQ(runs.size(), 30000u);
+    EXPECT_TRUE(runs.contains(0x20002));
+    EXPECT_FALSE(runs.contains(0x20003));
+
+    // erase last key of chunk
+    c.erase(0x50000);
+    EXPECT_EQ(c.chunk_count(), 2u);
+    EXPECT_EQ(c.find(0x50000), c.end());
+}
+
+
+TEST_F(RoaringVectorset, Lookup) {
+    auto expected = makeMixed(4711);
+    std::vector<uint32_t> probes = { 0, ~uint32_t(0), 0xffff, 0x10000 };
+
+    for (uint32_t val = 0x30000; val < 0x40000; val += 7) {
+        probes.push_back(val);
+    }
+    for (auto value : expected) {
+        if (value % 5 == 0) {
+            probes.push_back(value);
+            probes.push_back(value + 1);
+            probes.push_back(value - 1);
+        }
+    }
+
+    roaring_vectorset c(expected.begin(), expected.end());
+
+    checkRoaring(c, expected, probes);
+    EXPECT_TRUE(
+        c.to_vectorset()
+        == vectorset<uint32_t>(
+            vectorset_sorted_unique,
+            std::vector<uint32_t>(expected.begin(), expected.end())));
+    EXPECT_LT(c.memory_bytes(), expected.size() * sizeof(uint32_t) / 2);
+
+    auto range = c.equal_range(*expected.begin());
+    EXPECT_EQ(std::distance(range.first, range.second), 1);
+    EXPECT_EQ(c.count(*expected.rbegin()), 1u);
+}
+
+
+TEST_F(RoaringVectorset, RandomOperations) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<uint32_t> dist(0, 0x2ffff);
+
+    // start with a run chunk
+    std::vector<uint32_t> range(40000);
+    std::iota(range.begin(), range.end(), 0x20000);
+
+    roaring_vectorset c(range.begin(), range.end());
+    std::set<uint32_t> expected(range.begin(), range.end());
+
+    EXPECT_EQ(c.chunk_type(0), roaring_chunk::runs);
+
+    for (int step = 0; step < 200000; ++step) {
+        // narrow ranges create runs
+        auto val = (step % 4 == 0 ? dist(gen) : dist(gen) % 3000 + 0x21000);
+
+        if (step % 3 == 2) {
+            if (step % 2 == 0) {
+                ASSERT_EQ(c.erase(val), expected.erase(val));
+            }
+            else {
+                auto iter = c.lower_bound(val);
+                auto expectedIter = expected.lower_bound(val);
+
+                ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+                if (iter != c.end()) {
+                    auto next = c.erase(iter);
+                    auto expectedNext = expected.erase(expectedIter);
+
+                    ASSERT_EQ(next == c.end(), expectedNext == expected.end());
+                    if (next != c.end()) {
+                        ASSERT_EQ(*next, *expectedNext);
+                    }
+                }
+            }
+        }
+        else {
+            auto result = c.insert(val);
+
+            ASSERT_EQ(result.second, expected.insert(val).second);
+            ASSERT_EQ(*result.first, val);
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(c.contains(val), expected.count(val) != 0);
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+
+TEST_F(RoaringVectorset, SetAlgebra) {
+    auto lhsKeys = makeMixed(1);
+    auto rhsKeys = makeMixed(2);
+
+    roaring_vectorset lhs(lhsKeys.begin(), lhsKeys.end());
+    roaring_vectorset rhs(rhsKeys.begin(), rhsKeys.end());
+
+    auto check =
+        [](const roaring_vectorset &result,
+           const std::vector<uint32_t> &expected)
+        {
+            return (result.size() == expected.size()
+                    && std::equal(
+                        result.begin(), result.end(), expected.begin()));
+        };
+
+    std::vector<uint32_t> expected;
+
+    std::set_union(
+        lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(), rhsKeys.end(),
+        std::back_inserter(expected));
+    EXPECT_TRUE(check(set_union(lhs, rhs), expected));
+
+    auto merged = lhs;
+    merged.insert(rhsKeys.begin(), rhsKeys.end());
+    EXPECT_TRUE(check(merged, expected));
+
+    expected.clear();
+    std::set_intersection(
+        lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(), rhsKeys.end(),
+        std::back_inserter(expected));
+    EXPECT_TRUE(check(set_intersection(lhs, rhs), expected));
+
+    expected.clear();
+    std::set_difference(
+        lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(), rhsKeys.end(),
+        std::back_inserter(expected));
+    EXPECT_TRUE(check(set_difference(lhs, rhs), expected));
+
+    expected.clear();
+    std::set_symmetric_difference(
+        lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(), rhsKeys.end(),
+        std::back_inserter(expected));
+    EXPECT_TRUE(check(set_symmetric_difference(lhs, rhs), expected));
+
+    EXPECT_TRUE(set_difference(lhs, lhs).empty());
+    EXPECT_TRUE(set_intersection(lhs, roaring_vectorset()).empty());
+    EXPECT_TRUE(set_union(lhs, roaring_vectorset()) == lhs);
+}
@@ -0,0 +1,385 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "SetAlgebra.h"
+
+#include "TestUtils.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+
+namespace {
+    /**
+     * Create unique ordered vectorset of random values.
+     */
+    template<class T>
+    vectorset<T>
+    randomSet(std::mt19937 &gen, size_t count, T maxVal) {
+        std::uniform_int_distribution<T> dist(0, maxVal);
+        vectorset<T> result;
+
+        result.set_mode(vectorset_mode::unique_ordered);
+        for (size_t idx = 0; idx < count; ++idx) {
+            result.insert(dist(gen));
+        }
+
+        return result;
+    }
+
+    template<class T>
+    std::vector<T>
+    toVector(const vectorset<T> &c) {
+        return std::vector<T>(c.begin(), c.end());
+    }
+} // namespace
+
+
+TEST_F(SetAlgebra, Basic) {
+    vectorset<int> lhs = { 8, 0, 2, 5, 6 };
+    vectorset<int> rhs = { 9, 5, 2, 1 };
+
+    lhs.set_mode(vectorset_mode::unique_ordered);
+    rhs.set_mode(vectorset_mode::unique_ordered);
+
+    auto result = set_union(lhs, rhs);
+
+    EXPECT_EQ(result.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(toVector(result), vs_test::make_vector<int>(0, 1, 2, 5, 6, 8, 9));
+
+    EXPECT_EQ(
+        toVector(set_intersection(lhs, rhs)),
+        vs_test::make_vector<int>(2, 5));
+    EXPECT_EQ(
+        toVector(set_difference(lhs, rhs)),
+        vs_test::make_vector<int>(0, 6, 8));
+    EXPECT_EQ(
+        toVector(set_symmetric_difference(lhs, rhs)),
+        vs_test::make_vector<int>(0, 1, 6, 8, 9));
+
+    // not ordered
+    rhs.set_mode(vectorset_mode::unordered);
+    EXPECT_THROW(set_union(lhs, rhs), std::logic_error);
+    EXPECT_THROW(lhs.intersect_with(rhs), std::logic_error);
+    EXPECT_THROW(lhs.subtract(rhs), std::logic_error);
+}
+
+
+TEST_F(SetAlgebra, InPlace) {
+    vectorset<int> lhs = { 8, 0, 2, 5, 6 };
+    vectorset<int> rhs = { 9, 5, 2, 1 };
+
+    lhs.set_mode(vectorset_mode::unique_ordered);
+    rhs.set_mode(vectorset_mode::unique_ordered);
+
+    auto other = lhs;
+
+    lhs.clearDebugTrace();
+    EXPECT_EQ(lhs.intersect_with(rhs), 3u);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            lhs.getDebugTrace(),
+            {
+                {"intersect_with(const vectorset&)", "start"},
+                {"intersect_with(const vectorset&)", "gallop:false"},
+                {"intersect_with(const vectorset&)", "rmSize:3"}
+            }));
+
+    EXPECT_EQ(toVector(lhs), vs_test::make_vector<int>(2, 5));
+
+    EXPECT_EQ(other.subtract(rhs), 2u);
+    EXPECT_EQ(toVector(other), vs_test::make_vector<int>(0, 6, 8));
+
+    EXPECT_EQ(other.subtract(other), 3u);
+    EXPECT_TRUE(other.empty());
+}
+
+
+TEST_F(SetAlgebra, RandomSizes) {
+    std::mt19937 gen(4711);
+    const std::vector<std::pair<size_t, size_t>> sizes = {
+        { 0, 100 }, { 100, 0 }, { 100, 120 }, { 1000, 10 }, { 3, 5000 },
+        { 2000, 2000 }, { 5000, 40 }
+    };
+
+    for (const auto &size : sizes) {
+        auto lhs = randomSet(gen, size.first, 10000);
+        auto rhs = randomSet(gen, size.second, 10000);
+        std::vector<int> expected;
+
+        expected.clear();
+        std::set_union(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(expected));
+        EXPECT_EQ(toVector(set_union(lhs, rhs)), expected);
+
+        expected.clear();
+        std::set_intersection(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(expected));
+        EXPECT_EQ(toVector(set_intersection(lhs, rhs)), expected);
+
+        auto inPlace = lhs;
+        inPlace.intersect_with(rhs);
+        EXPECT_EQ(toVector(inPlace), expected);
+
+        expected.clear();
+        std::set_difference(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(expected));
+        EXPECT_EQ(toVector(set_difference(lhs, rhs)), expected);
+
+        inPlace = lhs;
+        inPlace.subtract(rhs);
+        EXPECT_EQ(toVector(inPlace), expected);
+
+        expected.clear();
+        std::set_symmetric_difference(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(expected));
+        EXPECT_EQ(toVector(set_symmetric_difference(lhs, rhs)), expected);
+    }
+}
+
+
+namespace {
+    /**
+     * Check SIMD intersection against std::set_intersection.
+     */
+    template<class T>
+    void
+    checkSimdIntersection(std::mt19937 &gen, size_t lhsSize, size_t rhsSize) {
+        auto lhs = randomSet<T>(gen, lhsSize, 3 * (lhsSize + rhsSize));
+        auto rhs = randomSet<T>(gen, rhsSize, 3 * (lhsSize + rhsSize));
+        std::vector<T> expected;
+
+        std::set_intersection(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(expected));
+
+        std::vector<T> result(
+            std::min(lhs.size(), rhs.size()) + vectorset_algo::simd_padding);
+        auto count =
+            vectorset_algo::simd_intersection(
+                lhs.get_vector().data(), lhs.size(),
+                rhs.get_vector().data(), rhs.size(),
+                result.data());
+        result.resize(count);
+
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(toVector(set_intersection(lhs, rhs)), expected);
+        EXPECT_EQ(toVector(set_intersection(rhs, lhs)), expected);
+    }
+} // namespace
+
+
+TEST_F(SetAlgebra, SimdIntersection) {
+    std::mt19937 gen(4711);
+    std::vector<std::pair<size_t, size_t>> sizes = {
+        {0, 0}, {1, 1}, {3, 5}, {4, 4}, {7, 9}, {16, 17},
+        {100, 100}, {1000, 333}, {5000, 5000}, {4000, 50}
+    };
+
+    for (const auto &size : sizes) {
+        checkSimdIntersection<uint32_t>(gen, size.first, size.second);
+        checkSimdIntersection<uint64_t>(gen, size.first, size.second);
+    }
+
+    // values using the highest bits
+    auto lhs = vs_test::make_vectorset<uint32_t>(1, 0xffffffffu, 0x80000000u, 7, 9);
+    auto rhs = vs_test::make_vectorset<uint32_t>(0xffffffffu, 9, 0x80000000u, 2, 3);
+
+    lhs.set_mode(vectorset_mode::unique_ordered);
+    rhs.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(
+        toVector(set_intersection(lhs, rhs)),
+        vs_test::make_vector<uint32_t>(9, 0x80000000u, 0xffffffffu));
+}
+
+
+TEST_F(SetAlgebra, MultiWay) {
+    std::mt19937 gen(4711);
+    std::vector<size_t> counts = { 0, 1, 2, 3, 5, 20 };
+
+    for (auto count : counts) {
+        std::vector<vectorset<int>> sets;
+        std::vector<const vectorset<int>*> setPtrs;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            sets.push_back(randomSet(gen, 50 + idx * 200, 400));
+        }
+        for (const auto &set : sets) {
+            setPtrs.push_back(&set);
+        }
+
+        std::vector<int> expectedUnion;
+        std::vector<int> expectedIntersection;
+
+        if (!sets.empty()) {
+            expectedUnion = toVector(sets.front());
+            expectedIntersection = expectedUnion;
+        }
+
+        for (size_t idx = 1; idx < count; ++idx) {
+            std::vector<int> tmp;
+
+            std::set_union(
+                expectedUnion.begin(), expectedUnion.end(),
+                sets[idx].begin(), sets[idx].end(),
+                std::back_inserter(tmp));
+            expectedUnion.swap(tmp);
+
+            tmp.clear();
+            std::set_intersection(
+                expectedIntersection.begin(), expectedIntersection.end(),
+                sets[idx].begin(), sets[idx].end(),
+                std::back_inserter(tmp));
+            expectedIntersection.swap(tmp);
+        }
+
+        auto unionResult = set_union(setPtrs);
+        auto intersectionResult = set_intersection(setPtrs);
+
+        EXPECT_EQ(unionResult.get_mode(), vectorset_mode::unique_ordered);
+        EXPECT_EQ(toVector(unionResult), expectedUnion);
+        EXPECT_EQ(
+            intersectionResult.get_mode(), vectorset_mode::unique_ordered);
+        EXPECT_EQ(toVector(intersectionResult), expectedIntersection);
+    }
+
+    // early termination with an empty set
+    auto lhs = randomSet(gen, 100, 400);
+    auto rhs = randomSet(gen, 100, 400);
+    vectorset<int> empty;
+
+    empty.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_TRUE(set_intersection(
+                    std::vector<const vectorset<int>*>{
+                        &lhs, &rhs, &empty}).empty());
+
+    vectorset<int> unordered = { 1, 2 };
+
+    EXPECT_THROW(
+        set_union(std::vector<const vectorset<int>*>{&lhs, &rhs, &unordered}),
+        std::logic_error);
+    EXPECT_THROW(
+        set_intersection(
+            std::vector<const vectorset<int>*>{&lhs, &unordered, &rhs}),
+        std::logic_error);
+}
+
+
+namespace {
+    /**
+     * Check cardinality operations against the std algorithms.
+     */
+    template<class T>
+    void
+    checkCardinality(
+        const vectorset<T> &lhs, const vectorset<T> &rhs)
+    {
+        std::vector<T> common;
+
+        std::set_intersection(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(common));
+
+        EXPECT_EQ(intersection_size(lhs, rhs), common.size());
+        EXPECT_EQ(intersection_size(rhs, lhs), common.size());
+        EXPECT_EQ(is_disjoint(lhs, rhs), common.empty());
+        EXPECT_EQ(is_disjoint(rhs, lhs), common.empty());
+        EXPECT_EQ(
+            includes(lhs, rhs),
+            std::includes(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+        EXPECT_EQ(
+            includes(rhs, lhs),
+            std::includes(rhs.begin(), rhs.end(), lhs.begin(), lhs.end()));
+
+        if (!lhs.empty() || !rhs.empty()) {
+            EXPECT_DOUBLE_EQ(
+                jaccard(lhs, rhs),
+                static_cast<double>(common.size())
+                / static_cast<double>(
+                    lhs.size() + rhs.size() - common.size()));
+        }
+    }
+} // namespace
+
+
+TEST_F(SetAlgebra, Cardinality) {
+    std::mt19937 gen(4711);
+    std::vector<std::pair<size_t, size_t>> sizes = {
+        {0, 0}, {0, 7}, {1, 1}, {3, 5}, {16, 17},
+        {1000, 333}, {5000, 5000}, {4000, 50}
+    };
+
+    for (const auto &size : sizes) {
+        auto maxVal = 3 * (size.first + size.second);
+
+        checkCardinality(
+            randomSet<int>(gen, size.first, static_cast<int>(maxVal)),
+            randomSet<int>(gen, size.second, static_cast<int>(maxVal)));
+        checkCardinality(
+            randomSet<uint32_t>(gen, size.first, maxVal),
+            randomSet<uint32_t>(gen, size.second, maxVal));
+        checkCardinality(
+            randomSet<uint64_t>(gen, size.first, maxVal),
+            randomSet<uint64_t>(gen, size.second, maxVal));
+    }
+
+    // subsets and disjoint sets
+    auto large = randomSet<uint32_t>(gen, 5000, 100000);
+    vectorset<uint32_t> subset;
+    vectorset<uint32_t> disjoint;
+
+    subset.set_mode(vectorset_mode::unique_ordered);
+    disjoint.set_mode(vectorset_mode::unique_ordered);
+    for (auto val : large) {
+        if (val % 3 == 0) {
+            subset.insert(val);
+        }
+        disjoint.insert(val + 200000);
+    }
+
+    EXPECT_TRUE(includes(large, subset));
+    EXPECT_TRUE(includes(large, large));
+    EXPECT_FALSE(includes(subset, large));
+    EXPECT_TRUE(is_disjoint(large, disjoint));
+    EXPECT_DOUBLE_EQ(jaccard(large, large), 1.0);
+    EXPECT_DOUBLE_EQ(jaccard(large, disjoint), 0.0);
+
+    vectorset<int> empty;
+    vectorset<int> unordered = { 1, 2 };
+
+    empty.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_DOUBLE_EQ(jaccard(empty, empty), 1.0);
+    EXPECT_THROW(intersection_size(empty, unordered), std::logic_error);
+    EXPECT_THROW(jaccard(unordered, empty), std::logic_error);
+    EXPECT_THROW(is_disjoint(empty, unordered), std::logic_error);
+    EXPECT_THROW(includes(unordered, empty), std::logic_error);
+}
@@ -0,0 +1,250 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#include "SetViews.h"
+
+#include "TestUtils.h"
+#include "vectorset_algo.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+
+
+namespace {
+    /**
+     * Create unique ordered vectorset of random values.
+     */
+    vectorset<int>
+    randomSet(std::mt19937 &gen, size_t count, int maxVal) {
+        std::uniform_int_distribution<int> dist(0, maxVal);
+        vectorset<int> result;
+
+        result.set_mode(vectorset_mode::unique_ordered);
+        for (size_t idx = 0; idx < count; ++idx) {
+            result.insert(dist(gen));
+        }
+
+        return result;
+    }
+
+    /**
+     * Get value of iterator (-1 at the end).
+     */
+    template<class View>
+    int
+    valueAt(const View &view, typename View::const_iterator iter) {
+        return (iter == view.end() ? -1 : *iter);
+    }
+
+    template<class Range>
+    std::vector<int>
+    toVector(const Range &range) {
+        return std::vector<int>(range.begin(), range.end());
+    }
+} // namespace
+
+
+TEST_F(SetViews, TwoSets) {
+    auto lhs = vs_test::make_vectorset<int>(1, 2, 3, 4, 8);
+    auto rhs = vs_test::make_vectorset<int>(3, 4, 5, 9);
+
+    lhs.set_mode(vectorset_mode::unique_ordered);
+    rhs.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(
+        toVector(make_union_view(lhs, rhs)),
+        vs_test::make_vector<int>(1, 2, 3, 4, 5, 8, 9));
+    EXPECT_EQ(
+        toVector(make_intersection_view(lhs, rhs)),
+        vs_test::make_vector<int>(3, 4));
+    EXPECT_EQ(
+        toVector(make_difference_view(lhs, rhs)),
+        vs_test::make_vector<int>(1, 2, 8));
+    EXPECT_EQ(
+        toVector(make_difference_view(rhs, lhs)),
+        vs_test::make_vector<int>(5, 9));
+
+    vectorset<int> empty;
+
+    empty.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_TRUE(make_intersection_view(lhs, empty).empty());
+    EXPECT_EQ(toVector(make_union_view(lhs, empty)), toVector(lhs));
+    EXPECT_EQ(toVector(make_difference_view(lhs, empty)), toVector(lhs));
+    EXPECT_TRUE(make_difference_view(empty, lhs).empty());
+
+    vectorset<int> unordered = { 1, 2 };
+
+    EXPECT_THROW(make_union_view(lhs, unordered), std::logic_error);
+}
+
+
+TEST_F(SetViews, ManySets) {
+    std::mt19937 gen(4711);
+
+    for (size_t count = 0; count < 6; ++count) {
+        std::vector<vectorset<int>> sets;
+        std::vector<const vectorset<int>*> setPtrs;
+
+        for (size_t idx = 0; idx < count; ++idx) {
+            sets.push_back(randomSet(gen, 100 + idx * 300, 1000));
+        }
+        for (const auto &set : sets) {
+            setPtrs.push_back(&set);
+        }
+
+        std::vector<int> expectedDifference;
+
+        if (!sets.empty()) {
+            vectorset<int> others;
+
+            others.set_mode(vectorset_mode::unique_ordered);
+            for (size_t idx = 1; idx < count; ++idx) {
+                others = set_union(others, sets[idx]);
+            }
+            expectedDifference = toVector(set_difference(sets[0], others));
+        }
+
+        EXPECT_EQ(
+            toVector(make_union_view(setPtrs)), toVector(set_union(setPtrs)));
+        EXPECT_EQ(
+            toVector(make_intersection_view(setPtrs)),
+            toVector(set_intersection(setPtrs)));
+        EXPECT_EQ(toVector(make_difference_view(setPtrs)), expectedDifference);
+    }
+}
+
+
+TEST_F(SetViews, Seek) {
+    std::mt19937 gen(4711);
+    auto lhs = randomSet(gen, 3000, 10000);
+    auto rhs = randomSet(gen, 2000, 10000);
+
+    auto unionView = make_union_view(lhs, rhs);
+    auto intersectionView = make_intersection_view(lhs, rhs);
+    auto differenceView = make_difference_view(lhs, rhs);
+
+    auto expectedUnion = toVector(set_union(lhs, rhs));
+    auto expectedIntersection = toVector(set_intersection(lhs, rhs));
+    auto expectedDifference = toVector(set_difference(lhs, rhs));
+
+    auto check =
+        [](const std::vector<int> &expected, int key) {
+            auto pos = std::lower_bound(expected.begin(), expected.end(), key);
+            return (pos == expected.end() ? -1 : *pos);
+        };
+
+    for (int key = -1; key <= 10001; key += 97) {
+        EXPECT_EQ(
+            valueAt(unionView, unionView.lower_bound(key)),
+            check(expectedUnion, key));
+        EXPECT_EQ(
+            valueAt(intersectionView, intersectionView.lower_bound(key)),
+            check(expectedIntersection, key));
+        EXPECT_EQ(
+            valueAt(differenceView, differenceView.lower_bound(key)),
+            check(expectedDifference, key));
+    }
+
+    // seek forward only
+    auto iter = unionView.begin();
+
+    iter.seek(5000);
+    ASSERT_NE(iter, unionView.end());
+    EXPECT_EQ(*iter, check(expectedUnion, 5000));
+
+    iter.seek(10);
+    EXPECT_EQ(*iter, check(expectedUnion, 5000));
+
+    iter.seek(20000);
+    EXPECT_EQ(iter, unionView.end());
+}
+
+
+TEST_F(SetViews, EarlyTermination) {
+    std::mt19937 gen(4711);
+    auto lhs = randomSet(gen, 3000, 10000);
+    auto rhs = randomSet(gen, 2000, 10000);
+    auto view = make_intersection_view(lhs, rhs);
+    auto expected = toVector(set_intersection(lhs, rhs));
+
+    std::vector<int> top;
+
+    for (auto iter = view.begin(); iter != view.end() && top.size() < 5;
+         ++iter)
+    {
+        top.push_back(*iter);
+    }
+
+    ASSERT_GE(expected.size(), 5u);
+    EXPECT_EQ(top, std::vector<int>(expected.begin(), expected.begin() + 5));
+
+#if __cplusplus >= 202002L // c++20
+    static_assert(std::ranges::forward_range<decltype(view)>);
+    static_assert(std::ranges::view<decltype(view)>);
+
+    std::vector<int> taken;
+
+    for (auto val : view | std::views::take(5)) {
+        taken.push_back(val);
+    }
+
+    EXPECT_EQ(taken, top);
+#endif
+}
+
+
+TEST_F(SetViews, TemporaryView) {
+    std::mt19937 gen(4711);
+    auto lhs = randomSet(gen, 3000, 10000);
+    auto rhs = randomSet(gen, 2000, 10000);
+    auto expectedUnion = toVector(set_union(lhs, rhs));
+    auto expectedIntersection = toVector(set_intersection(lhs, rhs));
+
+    // iterators outlive the temporary view
+    auto iter = make_intersection_view(lhs, rhs).begin();
+    std::vector<int> values;
+
+    for (; iter != decltype(iter)(); ++iter) {
+        values.push_back(*iter);
+    }
+    EXPECT_EQ(values, expectedIntersection);
+
+    auto pos = make_union_view(lhs, rhs).lower_bound(5000);
+    auto expectedPos =
+        std::lower_bound(expectedUnion.begin(), expectedUnion.end(), 5000);
+
+    ASSERT_NE(expectedPos, expectedUnion.end());
+    EXPECT_EQ(*pos, *expectedPos);
+
+    ++pos;
+    ++expectedPos;
+    EXPECT_EQ(*pos, *expectedPos);
+
+    pos.seek(7000);
+    EXPECT_EQ(*pos, *std::lower_bound(
+                  expectedUnion.begin(), expectedUnion.end(), 7000));
+}
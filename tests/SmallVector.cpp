@@ -0,0 +1,337 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#include "SmallVector.h"
+
+#include "TestUtils.h"
+#include "small_vector.h"
+
+#include <set>
+#include <random>
+
+
+TEST_F(SmallVector, InsertErase) {
+    small_vector<int, 4> c = { 0, 1, 2 };
+
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c.capacity(), 4u);
+    EXPECT_TRUE(c.is_small());
+
+    auto iter = c.insert(std::next(c.begin(), 1), 10);
+    EXPECT_EQ(*iter, 10);
+    EXPECT_TRUE(c.is_small());
+
+    // spill to heap
+    iter = c.insert(c.begin(), 11);
+    EXPECT_EQ(*iter, 11);
+    EXPECT_FALSE(c.is_small());
+    EXPECT_EQ(c.capacity(), 8u);
+
+    c.insert(c.end(), 12);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(11, 0, 10, 1, 2, 12));
+    EXPECT_EQ(
+        std::vector<int>(c.rbegin(), c.rend()),
+        vs_test::make_vector<int>(12, 2, 1, 10, 0, 11));
+    EXPECT_EQ(c[2], 10);
+    EXPECT_EQ(c.at(5), 12);
+    EXPECT_THROW(c.at(6), std::out_of_range);
+    EXPECT_EQ(c.front(), 11);
+    EXPECT_EQ(c.back(), 12);
+    EXPECT_EQ(c.data(), &c[0]);
+
+    iter = c.erase(std::next(c.begin(), 2));
+    EXPECT_EQ(*iter, 1);
+
+    iter = c.erase(c.begin(), std::next(c.begin(), 2));
+    EXPECT_EQ(*iter, 1);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 2, 12));
+
+    // back to inline storage
+    c.shrink_to_fit();
+    EXPECT_TRUE(c.is_small());
+    EXPECT_EQ(c.capacity(), 4u);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 2, 12));
+
+    c.insert(std::next(c.begin(), 1), { 20, 21, 22 });
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 21, 22, 2, 12));
+
+    // insert element of the container itself while growing
+    c.resize(8);
+    c.emplace_back(c[1]);
+    EXPECT_EQ(c.size(), 9u);
+    EXPECT_EQ(c.back(), 20);
+
+    c.resize(2);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20));
+
+    c.resize(4, 7);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 7, 7));
+}
+
+
+TEST_F(SmallVector, CopyMoveCompare) {
+    using svector = small_vector<std::string, 4>;
+
+    svector c1 = { "a", "b", "c" };
+    svector c2(c1);
+
+    EXPECT_TRUE(c1 == c2);
+
+    c2.push_back("d");
+    c2.push_back("e");
+    EXPECT_FALSE(c2.is_small());
+    EXPECT_TRUE(c1 != c2);
+    EXPECT_TRUE(c1 < c2);
+    EXPECT_TRUE(c2 >= c1);
+
+    // heap buffer is taken over
+    auto heapData = c2.data();
+    svector c3(std::move(c2));
+    EXPECT_EQ(c3.size(), 5u);
+    EXPECT_EQ(c3.data(), heapData);
+    EXPECT_TRUE(c2.empty());
+    EXPECT_TRUE(c2.is_small());
+
+    // inline elements are moved
+    svector c4(std::move(c1));
+    EXPECT_EQ(c4.size(), 3u);
+    EXPECT_TRUE(c4.is_small());
+    EXPECT_TRUE(c1.empty());
+
+    c2 = c3;
+    EXPECT_TRUE(c2 == c3);
+
+    c1 = std::move(c3);
+    EXPECT_TRUE(c1 == c2);
+    EXPECT_TRUE(c3.empty());
+
+    // swap inline with heap storage
+    c1.swap(c4);
+    EXPECT_EQ(c1.size(), 3u);
+    EXPECT_TRUE(c1.is_small());
+    EXPECT_EQ(c4.back(), "e");
+    EXPECT_FALSE(c4.is_small());
+
+    c1.swap(c3);
+    EXPECT_TRUE(c1.empty());
+    EXPECT_EQ(c3.back(), "c");
+}
+
+
+namespace {
+    /// Value with a throwing move and copy (the n-th copy throws).
+    struct ThrowingCopy {
+        static int copiesLeft;
+        static std::set<const ThrowingCopy*> alive;
+
+        int val;
+
+        ThrowingCopy(int val) : val(val) {
+            alive.insert(this);
+        }
+
+        ThrowingCopy(const ThrowingCopy &other) : val(other.val) {
+            if (copiesLeft-- == 0) {
+                throw std::runtime_error("copy");
+            }
+            alive.insert(this);
+        }
+
+        // not noexcept: relocation copies
+        ThrowingCopy(ThrowingCopy &&other) : ThrowingCopy(other) {}
+
+        ThrowingCopy &operator=(const ThrowingCopy &other) = default;
+
+        ~ThrowingCopy() {
+            // destroyed exactly once
+            EXPECT_EQ(alive.erase(this), 1u);
+        }
+
+        bool
+        isAlive() const {
+            return (alive.count(this) == 1);
+        }
+    };
+
+    int ThrowingCopy::copiesLeft = 0;
+    std::set<const ThrowingCopy*> ThrowingCopy::alive;
+}
+
+
+TEST_F(SmallVector, RelocateThrows) {
+    {
+        small_vector<ThrowingCopy, 4> c;
+
+        for (int idx = 0; idx < 4; ++idx) {
+            c.emplace_back(idx);
+        }
+
+        // the third copy into the heap buffer throws
+        ThrowingCopy::copiesLeft = 2;
+        EXPECT_THROW(c.reserve(8), std::runtime_error);
+
+        EXPECT_TRUE(c.is_small());
+        EXPECT_EQ(c.size(), 4u);
+        EXPECT_EQ(ThrowingCopy::alive.size(), 4u);
+        for (int idx = 0; idx < 4; ++idx) {
+            EXPECT_TRUE(c[idx].isAlive());
+            EXPECT_EQ(c[idx].val, idx);
+        }
+
+        // heap buffer back to inline storage
+        ThrowingCopy::copiesLeft = 100;
+        c.reserve(8);
+        c.pop_back();
+        EXPECT_FALSE(c.is_small());
+
+        ThrowingCopy::copiesLeft = 1;
+        EXPECT_THROW(c.shrink_to_fit(), std::runtime_error);
+
+        EXPECT_FALSE(c.is_small());
+        EXPECT_EQ(c.size(), 3u);
+        EXPECT_EQ(ThrowingCopy::alive.size(), 3u);
+        for (int idx = 0; idx < 3; ++idx) {
+            EXPECT_TRUE(c[idx].isAlive());
+        }
+    }
+
+    EXPECT_TRUE(ThrowingCopy::alive.empty());
+}
+
+
+TEST_F(SmallVector, RandomPositions) {
+    std::mt19937 gen(4711);
+
+    small_vector<int, 8> c;
+    std::vector<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        auto pos = std::uniform_int_distribution<std::size_t>(
+            0, expected.size())(gen);
+
+        if (step % 3 != 2) {
+            c.insert(std::next(c.begin(), pos), step);
+            expected.insert(std::next(expected.begin(), pos), step);
+        }
+        else if (pos < expected.size()) {
+            c.erase(std::next(c.begin(), pos));
+            expected.erase(std::next(expected.begin(), pos));
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+
+TEST_F(SmallVector, OrderedVectorset) {
+    std::mt19937 gen(4711);
+
+    for (int range : { 12, 2000 }) {
+        std::uniform_int_distribution<int> dist(0, range);
+
+        small_vectorset<int, 8> c;
+        std::set<int> expected;
+
+        c.set_mode(vectorset_mode::unique_ordered);
+
+        for (int step = 0; step < 20000; ++step) {
+            auto val = dist(gen);
+
+            if (step % 3 != 2) {
+                auto result = c.insert(val);
+                auto expectedResult = expected.insert(val);
+
+                ASSERT_EQ(result.second, expectedResult.second);
+                ASSERT_EQ(*result.first, val);
+            }
+            else {
+                ASSERT_EQ(c.erase(val), expected.erase(val));
+            }
+
+            ASSERT_EQ(c.size(), expected.size());
+            ASSERT_EQ(c.contains(val), expected.count(val) != 0);
+            ASSERT_EQ(
+                std::distance(c.begin(), c.lower_bound(val)),
+                std::distance(expected.begin(), expected.lower_bound(val)));
+            ASSERT_EQ(
+                std::distance(c.begin(), c.upper_bound(val)),
+                std::distance(expected.begin(), expected.upper_bound(val)));
+        }
+
+        EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+
+        // switch to unordered and back
+        c.set_mode(vectorset_mode::unordered);
+        c.push_back(*expected.begin());
+        c.push_back(-1);
+        c.set_mode(vectorset_mode::unique_ordered);
+
+        expected.insert(-1);
+        EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+    }
+}
+
+
+TEST_F(SmallVector, LinearSearch) {
+    EXPECT_EQ(
+        (vectorset_linear_search_limit<small_vector<int, 4>>::value), 4u);
+    EXPECT_EQ(
+        (vectorset_linear_search_limit<small_vector<int, 64>>::value), 16u);
+    EXPECT_EQ(
+        (vectorset_linear_search_limit<std::vector<int>>::value), 0u);
+
+    small_vectorset<std::string, 4> c = { "d", "b", "a", "c" };
+
+    c.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_TRUE(c.get_vector().is_small());
+
+    EXPECT_EQ(*c.find("c"), "c");
+    EXPECT_EQ(c.find("e"), c.end());
+    EXPECT_EQ(*c.lower_bound("bb"), "c");
+    EXPECT_EQ(c.count("a"), 1u);
+
+    c.insert("e");
+    EXPECT_FALSE(c.get_vector().is_small());
+    EXPECT_EQ(
+        std::vector<std::string>(c.begin(), c.end()),
+        vs_test::make_vector<std::string>("a", "b", "c", "d", "e"));
+}
@@ -0,0 +1,205 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+
+#include "StringVectorset.h"
+
+#if __cplusplus >= 201703L // c++17
+
+#include "TestUtils.h"
+#include "string_vectorset.h"
+
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+
+
+using namespace std::literals;
+
+
+TEST_F(StringVectorset, Modes) {
+    string_vectorset c = { "delta", "alpha", "delta", "al", "", "alp" };
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(c[0], "delta");
+    EXPECT_EQ(c.count("delta"), 2u);
+    EXPECT_TRUE(c.contains("al"));
+    EXPECT_FALSE(c.contains("a"));
+    EXPECT_THROW(c.lower_bound("a"), std::logic_error);
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(
+        std::vector<std::string_view>(c.begin(), c.end()),
+        vs_test::make_vector<std::string_view>(
+            "", "al", "alp", "alpha", "delta"));
+
+    // arena is rewritten in sorted order without duplicates
+    EXPECT_EQ(
+        std::string(c.get_arena().begin(), c.get_arena().end()),
+        "alalpalphadelta");
+    EXPECT_EQ(c.get_entries()[3].offset, 5u);
+    EXPECT_EQ(c.count("delta"), 1u);
+    EXPECT_THROW(c.push_back("x"), std::logic_error);
+    EXPECT_THROW(
+        c.set_mode(vectorset_mode::ordered), std::invalid_argument);
+
+    c.set_mode(vectorset_mode::unordered);
+    c.push_back("beta");
+    EXPECT_EQ(c.back(), "beta");
+}
+
+
+namespace {
+    /// String throwing on conversion, if it is empty.
+    struct ThrowingString {
+        std::string str;
+
+        operator std::string_view() const {
+            if (str.empty()) {
+                throw std::runtime_error("empty");
+            }
+            return str;
+        }
+    };
+}
+
+
+TEST_F(StringVectorset, InsertRangeException) {
+    string_vectorset c = { "delta", "alpha" };
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    std::vector<ThrowingString> more = { {"beta"}, {"gamma"}, {""} };
+
+    EXPECT_THROW(c.insert(more.begin(), more.end()), std::runtime_error);
+
+    // mode and content are unchanged
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(
+        std::vector<std::string_view>(c.begin(), c.end()),
+        vs_test::make_vector<std::string_view>("alpha", "delta"));
+    EXPECT_EQ(c.get_arena().size(), 10u);
+    EXPECT_TRUE(c.contains("delta"));
+}
+
+
+TEST_F(StringVectorset, Lookup) {
+    string_vectorset c = { "abcdx", "abcd", "abcde", "abc", "abd", "b" };
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(*c.find("abcd"), "abcd");
+    EXPECT_EQ(c.find("abcdf"), c.end());
+    EXPECT_EQ(*c.lower_bound("abcdf"), "abcdx");
+    EXPECT_EQ(*c.upper_bound("abcdx"), "abd");
+    EXPECT_EQ(*c.lower_bound(""), "abc");
+    EXPECT_EQ(c.lower_bound("c"), c.end());
+    EXPECT_EQ(c.upper_bound("b"), c.end());
+
+    auto range = c.equal_range("abcde");
+    EXPECT_EQ(std::distance(range.first, range.second), 1);
+    EXPECT_EQ(range.first - c.begin(), 2);
+
+    // characters >= 0x80 compare unsigned (like std::string)
+    std::string high = "ab\xff";
+    std::string nul("ab\0x", 4);
+
+    EXPECT_TRUE(c.insert(high).second);
+    EXPECT_TRUE(c.insert(nul).second);
+    EXPECT_FALSE(c.insert("abd").second);
+    EXPECT_EQ(*c.insert("aa").first, "aa");
+    EXPECT_EQ(
+        std::vector<std::string_view>(c.rbegin(), c.rend()),
+        vs_test::make_vector<std::string_view>(
+            "b", high, "abd", "abcdx", "abcde", "abcd", "abc", nul, "aa"));
+
+    EXPECT_EQ(c.erase("abcd"), 1u);
+    EXPECT_EQ(c.erase("abcd"), 0u);
+    EXPECT_EQ(*c.erase(c.find("abc")), "abcde");
+    EXPECT_EQ(c.size(), 7u);
+}
+
+
+TEST_F(StringVectorset, RandomOperations) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> lenDist(0, 12);
+    std::uniform_int_distribution<int> charDist('a', 'd');
+
+    auto randomString = [&]() {
+        std::string result(lenDist(gen), ' ');
+
+        for (auto &ch : result) {
+            ch = static_cast<char>(charDist(gen));
+        }
+        return result;
+    };
+
+    string_vectorset c;
+    std::set<std::string> expected;
+
+    for (int idx = 0; idx < 2000; ++idx) {
+        auto str = randomString();
+
+        c.push_back(str);
+        expected.insert(str);
+    }
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    for (int step = 0; step < 20000; ++step) {
+        auto str = randomString();
+
+        if (step % 3 == 2) {
+            ASSERT_EQ(c.erase(str), expected.erase(str));
+        }
+        else {
+            auto result = c.insert(str);
+
+            ASSERT_EQ(result.second, expected.insert(str).second);
+            ASSERT_EQ(*result.first, str);
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+
+        auto iter = c.lower_bound(str);
+        auto expectedIter = expected.lower_bound(str);
+
+        ASSERT_EQ(iter == c.end(), expectedIter == expected.end());
+        if (iter != c.end()) {
+            ASSERT_EQ(*iter, *expectedIter);
+        }
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+    EXPECT_LE(c.get_arena().size(), 2 * 13 * expected.size());
+
+    c.shrink_to_fit();
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+#endif // __cplusplus >= 201703L
@@ -0,0 +1,187 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#include "TieredVector.h"
+
+#include "TestUtils.h"
+#include "tiered_vector.h"
+
+#include <set>
+#include <random>
+
+
+TEST_F(TieredVector, InsertErase) {
+    tiered_vector<int, std::allocator<int>, 4> c = { 0, 1, 2, 3, 4, 5 };
+
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(c.capacity(), 8u);
+
+    // insert into first chunk, rotate into second
+    auto iter = c.insert(std::next(c.begin(), 2), 10);
+    EXPECT_EQ(*iter, 10);
+    EXPECT_EQ(std::distance(c.begin(), iter), 2);
+
+    c.insert(c.begin(), 11);
+    c.insert(c.end(), 12);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(11, 0, 1, 10, 2, 3, 4, 5, 12));
+    EXPECT_EQ(
+        std::vector<int>(c.rbegin(), c.rend()),
+        vs_test::make_vector<int>(12, 5, 4, 3, 2, 10, 1, 0, 11));
+    EXPECT_EQ(c.capacity(), 12u);
+    EXPECT_EQ(c[3], 10);
+    EXPECT_EQ(c.at(8), 12);
+    EXPECT_THROW(c.at(9), std::out_of_range);
+    EXPECT_EQ(c.front(), 11);
+    EXPECT_EQ(c.back(), 12);
+
+    iter = c.erase(std::next(c.begin(), 3));
+    EXPECT_EQ(*iter, 2);
+
+    iter = c.erase(c.begin(), std::next(c.begin(), 2));
+    EXPECT_EQ(*iter, 1);
+
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 2, 3, 4, 5, 12));
+    EXPECT_EQ(c.capacity(), 8u);
+
+    c.insert(std::next(c.begin(), 1), { 20, 21, 22 });
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 21, 22, 2, 3, 4, 5, 12));
+
+    c.resize(2);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20));
+
+    c.resize(4, 7);
+    EXPECT_EQ(
+        std::vector<int>(c.begin(), c.end()),
+        vs_test::make_vector<int>(1, 20, 7, 7));
+}
+
+
+TEST_F(TieredVector, CopyMoveCompare) {
+    using tvector = tiered_vector<std::string, std::allocator<std::string>, 4>;
+
+    tvector c1 = { "a", "b", "c", "d", "e" };
+    tvector c2(c1);
+
+    EXPECT_TRUE(c1 == c2);
+
+    c2.push_back("f");
+    EXPECT_TRUE(c1 != c2);
+    EXPECT_TRUE(c1 < c2);
+    EXPECT_TRUE(c2 >= c1);
+
+    tvector c3(std::move(c2));
+    EXPECT_EQ(c3.size(), 6u);
+    EXPECT_TRUE(c2.empty());
+
+    c2 = c3;
+    EXPECT_TRUE(c2 == c3);
+
+    c1 = std::move(c3);
+    EXPECT_TRUE(c1 == c2);
+
+    c1.swap(c3);
+    EXPECT_TRUE(c1.empty());
+    EXPECT_EQ(c3.back(), "f");
+}
+
+
+TEST_F(TieredVector, RandomPositions) {
+    std::mt19937 gen(4711);
+
+    tiered_vector<int, std::allocator<int>, 8> c;
+    std::vector<int> expected;
+
+    for (int step = 0; step < 20000; ++step) {
+        auto pos = std::uniform_int_distribution<std::size_t>(
+            0, expected.size())(gen);
+
+        if (step % 3 != 2) {
+            c.insert(std::next(c.begin(), pos), step);
+            expected.insert(std::next(expected.begin(), pos), step);
+        }
+        else if (pos < expected.size()) {
+            c.erase(std::next(c.begin(), pos));
+            expected.erase(std::next(expected.begin(), pos));
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
+
+
+TEST_F(TieredVector, OrderedVectorset) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<int> dist(0, 2000);
+
+    tiered_vectorset<int, std::less<int>, std::allocator<int>, 16> c;
+    std::set<int> expected;
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    for (int step = 0; step < 20000; ++step) {
+        auto val = dist(gen);
+
+        if (step % 3 != 2) {
+            auto result = c.insert(val);
+            auto expectedResult = expected.insert(val);
+
+            ASSERT_EQ(result.second, expectedResult.second);
+            ASSERT_EQ(*result.first, val);
+        }
+        else {
+            ASSERT_EQ(c.erase(val), expected.erase(val));
+        }
+
+        ASSERT_EQ(c.size(), expected.size());
+        ASSERT_EQ(
+            std::distance(c.begin(), c.lower_bound(val)),
+            std::distance(expected.begin(), expected.lower_bound(val)));
+    }
+
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+    EXPECT_EQ(c[0], *expected.begin());
+    EXPECT_EQ(c.back(), *expected.rbegin());
+
+    // switch to unordered and back
+    c.set_mode(vectorset_mode::unordered);
+    c.push_back(*expected.begin());
+    c.push_back(-1);
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    expected.insert(-1);
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), expected.begin()));
+}
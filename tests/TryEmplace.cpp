@@ -0,0 +1,158 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "TryEmplace.h"
+
+
+TEST_F(TryEmplace, OrderedNew) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    auto result = c.try_emplace(vs_test::TestValue(3), 3);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"try_emplace(const Key&,Args&&...)", "start"},
+                {"impl_emplace_position(const K&,Less)", "start"},
+                {"impl_emplace_position(const K&,Less)", "lower_bound:2(5)"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 3);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 3, 5, 6, 8));
+}
+
+TEST_F(TryEmplace, OrderedExists) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+    c.clearDebugTrace();
+
+    auto result = c.try_emplace(vs_test::MiscInt(5), 5);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"try_emplace(const K&,Args&&...)", "start"},
+                {"impl_emplace_position(const K&,Less)", "start"},
+                {"impl_emplace_position(const K&,Less)", "lower_bound:2(5)"},
+                {"impl_emplace_position(const K&,Less)", "found-no-emplace"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first, std::next(c.begin(), 2));
+    EXPECT_EQ(c.size(), 5u);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 8));
+}
+
+TEST_F(TryEmplace, OrderedKeyOnly) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    // without constructor arguments, the element is copied from key
+    auto result = c.try_emplace(vs_test::TestValue(4));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 4);
+    EXPECT_EQ(std::distance(c.begin(), result.first), 2);
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 4, 5, 6, 8));
+    EXPECT_NE(c.find(4), c.end());
+
+    result = c.try_emplace(vs_test::TestValue(4));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(c.size(), 6u);
+}
+
+TEST_F(TryEmplace, OrderedLazy) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    int calls = 0;
+    auto factory =
+        [&calls]() {
+            ++calls;
+            return vs_test::TestValue(7);
+        };
+
+    // duplicate: factory is not called
+    auto result = c.lazy_emplace(vs_test::TestValue(2), factory);
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(*result.first, 2);
+    EXPECT_EQ(calls, 0);
+
+    c.clearDebugTrace();
+    result = c.lazy_emplace(vs_test::MiscInt(7), factory);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"lazy_emplace(const K&,Factory)", "start"},
+                {"impl_emplace_position(const K&,Less)", "start"},
+                {"impl_emplace_position(const K&,Less)", "lower_bound:4(5)"}
+            }));
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(*result.first, 7);
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(0, 2, 5, 6, 7, 8));
+}
+
+
+TEST_F(TryEmplace, Unordered) {
+    auto &c = container;
+    c.set_mode(vectorset_mode::unordered);
+    c.clearDebugTrace();
+
+    auto result = c.try_emplace(vs_test::MiscInt(2), 2);
+
+    EXPECT_TRUE(
+        vs_test::checkTrace(
+            c.getDebugTrace(),
+            {
+                {"try_emplace(const K&,Args&&...)", "start"},
+                {"impl_emplace_position(const K&,Less)", "start"},
+                {"impl_emplace_position(const K&,Less)", "find:2(6)"},
+                {"impl_emplace_position(const K&,Less)", "found-no-emplace"}
+            }));
+
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first, std::next(c.begin(), 2));
+
+    result = c.try_emplace(vs_test::MiscInt(3), 3);
+
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(result.first, std::prev(c.end()));
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_TRUE(hasNoCopiedElem(c));
+    EXPECT_EQ(c, vs_test::make_vector<int>(8, 0, 2, 5, 2, 6, 3));
+}
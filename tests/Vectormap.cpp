@@ -0,0 +1,308 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "Vectormap.h"
+
+#include "TestUtils.h"
+#include "vectormap.h"
+
+#include <map>
+#include <random>
+#include <string>
+
+
+TEST_F(Vectormap, Modes) {
+    vectormap<int, std::string> c = {
+        {8, "eight"}, {0, "zero"}, {2, "two"}, {5, "five"},
+        {2, "second two"}, {6, "six"}};
+
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unordered);
+    EXPECT_EQ(c.size(), 6u);
+    EXPECT_EQ(c.count(2), 2u);
+    EXPECT_EQ(c.at(2), "two");
+    EXPECT_EQ(c.find(7), c.end());
+    EXPECT_THROW(c.lower_bound(2), std::logic_error);
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    // both vectors are sorted by key, the first duplicate is kept
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(0, 2, 5, 6, 8));
+    EXPECT_EQ(
+        c.get_values(),
+        vs_test::make_vector<std::string>(
+            "zero", "two", "five", "six", "eight"));
+    EXPECT_EQ(c.count(2), 1u);
+    EXPECT_THROW(c.push_back(1, "one"), std::logic_error);
+    EXPECT_THROW(
+        c.set_mode(vectorset_mode::ordered), std::invalid_argument);
+
+    c.set_mode(vectorset_mode::unordered);
+    c.push_back(1, "one");
+    EXPECT_EQ(c.get_keys().back(), 1);
+    EXPECT_EQ(c.get_values().back(), "one");
+}
+
+
+TEST_F(Vectormap, Insert) {
+    vectormap<int, std::string> c;
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    auto result = c.insert({5, "five"});
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(result.first.key(), 5);
+
+    result = c.insert(std::make_pair(5, std::string("other")));
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first->second, "five");
+
+    EXPECT_TRUE(c.try_emplace(1, 3, 'x').second);
+    EXPECT_EQ(c.at(1), "xxx");
+    EXPECT_FALSE(c.try_emplace(1, "one").second);
+
+    EXPECT_FALSE(c.insert_or_assign(1, "one").second);
+    EXPECT_TRUE(c.insert_or_assign(9, "nine").second);
+
+    c[3] = "three";
+    c[5] += "!";
+    EXPECT_EQ(c[7], "");
+
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(1, 3, 5, 7, 9));
+    EXPECT_EQ(
+        c.get_values(),
+        vs_test::make_vector<std::string>(
+            "one", "three", "five!", "", "nine"));
+
+    // range insert drops keys already contained
+    std::vector<std::pair<int, std::string>> more = {
+        {4, "four"}, {3, "other"}, {0, "zero"}};
+    c.insert(more.begin(), more.end());
+
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(0, 1, 3, 4, 5, 7, 9));
+    EXPECT_EQ(c.at(3), "three");
+    EXPECT_EQ(c.at(4), "four");
+    EXPECT_THROW(c.at(2), std::out_of_range);
+}
+
+
+TEST_F(Vectormap, InsertUnordered) {
+    vectormap<int, std::string> c = {{3, "three"}, {1, "one"}};
+
+    // key is searched linearly, no duplicate is appended
+    auto result = c.try_emplace(3, "other");
+    EXPECT_FALSE(result.second);
+    EXPECT_EQ(result.first.value(), "three");
+
+    c[1] = "ONE";
+    EXPECT_EQ(c.at(1), "ONE");
+
+    EXPECT_TRUE(c.try_emplace(2, "two").second);
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(3, 1, 2));
+
+    // insert and push_back always append
+    result = c.insert({1, "other"});
+    EXPECT_TRUE(result.second);
+    EXPECT_EQ(result.first.key(), 1);
+    EXPECT_EQ(result.first.value(), "other");
+
+    c.push_back(3, "second three");
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(3, 1, 2, 1, 3));
+    EXPECT_EQ(c.at(1), "ONE");
+    EXPECT_EQ(c.at(3), "three");
+}
+
+
+namespace {
+    /// Mapped value throwing on copy of a marked value.
+    struct ThrowOnCopy {
+        int val;
+
+        ThrowOnCopy(int val = 0) : val(val) {}
+
+        ThrowOnCopy(const ThrowOnCopy &other) : val(other.val) {
+            if (val < 0) {
+                throw std::runtime_error("copy");
+            }
+        }
+
+        ThrowOnCopy(ThrowOnCopy &&other) noexcept = default;
+        ThrowOnCopy &operator=(const ThrowOnCopy &other) = default;
+        ThrowOnCopy &operator=(ThrowOnCopy &&other) noexcept = default;
+    };
+}
+
+
+TEST_F(Vectormap, InsertRangeException) {
+    vectormap<int, ThrowOnCopy> c = {{5, 50}, {1, 10}};
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    std::vector<std::pair<int, ThrowOnCopy>> more;
+    more.emplace_back(3, 30);
+    more.emplace_back(0, -1);
+
+    EXPECT_THROW(c.insert(more.begin(), more.end()), std::runtime_error);
+
+    // mode and content are unchanged
+    EXPECT_EQ(c.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(1, 5));
+    EXPECT_EQ(c.get_values().size(), 2u);
+    EXPECT_EQ(c.at(5).val, 50);
+}
+
+
+TEST_F(Vectormap, Erase) {
+    vectormap<int, int> c = {{3, 30}, {1, 10}, {3, 31}, {2, 20}};
+
+    // unordered: all elements with key are removed, order is kept
+    EXPECT_EQ(c.erase(3), 2u);
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(1, 2));
+    EXPECT_EQ(c.get_values(), vs_test::make_vector<int>(10, 20));
+
+    c.insert({{5, 50}, {4, 40}});
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    EXPECT_EQ(c.erase(3), 0u);
+    EXPECT_EQ(c.erase(4), 1u);
+
+    auto iter = c.erase(c.find(2));
+    EXPECT_EQ(iter.key(), 5);
+    EXPECT_EQ(c.get_keys(), vs_test::make_vector<int>(1, 5));
+    EXPECT_EQ(c.get_values(), vs_test::make_vector<int>(10, 50));
+}
+
+
+TEST_F(Vectormap, Iterators) {
+    vectormap<int, int> c = {{3, 30}, {1, 10}, {2, 20}};
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    int sum = 0;
+    for (auto elem : c) {
+        sum += elem.first;
+        elem.second += 1;
+    }
+
+    EXPECT_EQ(sum, 6);
+    EXPECT_EQ(c.get_values(), vs_test::make_vector<int>(11, 21, 31));
+
+    const auto &cc = c;
+    vectormap<int, int>::const_iterator citer = c.begin();
+
+    EXPECT_EQ(citer, cc.begin());
+    EXPECT_EQ(cc.end() - cc.begin(), 3);
+    EXPECT_EQ(citer[2].second, 31);
+    EXPECT_EQ((cc.rbegin())->first, 3);
+
+    auto range = cc.equal_range(2);
+    EXPECT_EQ(range.second - range.first, 1);
+    EXPECT_EQ(range.first.value(), 21);
+    EXPECT_EQ(cc.lower_bound(4), cc.end());
+    EXPECT_EQ(cc.upper_bound(0), cc.begin());
+}
+
+
+TEST_F(Vectormap, Compare) {
+    vectormap<int, int> a = {{1, 10}, {2, 20}};
+    vectormap<int, int> b(
+        vs_test::make_vector<int>(2, 1), vs_test::make_vector<int>(20, 10));
+
+    EXPECT_NE(a, b);
+
+    b.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_EQ(a, b);
+
+    swap(a, b);
+    EXPECT_EQ(a.get_mode(), vectorset_mode::unique_ordered);
+    EXPECT_EQ(b.get_mode(), vectorset_mode::unordered);
+
+    // the comparator is swapped with the content
+    struct DirLess {
+        bool greater;
+
+        bool
+        operator()(int lhv, int rhv) const {
+            return greater ? lhv > rhv : lhv < rhv;
+        }
+    };
+
+    vectormap<int, int, DirLess> up(DirLess{false});
+    vectormap<int, int, DirLess> down(DirLess{true});
+    up.insert({{1, 10}, {2, 20}});
+    down.insert({{1, 10}, {2, 20}});
+    up.set_mode(vectorset_mode::unique_ordered);
+    down.set_mode(vectorset_mode::unique_ordered);
+
+    up.swap(down);
+    EXPECT_EQ(up.get_keys(), vs_test::make_vector<int>(2, 1));
+    EXPECT_EQ(up.count(1), 1u);
+    EXPECT_EQ(down.count(1), 1u);
+    EXPECT_TRUE(up.key_comp().greater);
+
+    EXPECT_THROW(
+        (vectormap<int, int>(
+            vs_test::make_vector<int>(1, 2), vs_test::make_vector<int>(1))),
+        std::invalid_argument);
+
+    vectormap<int, int, std::greater<int>> g = {{1, 10}, {3, 30}, {2, 20}};
+    g.set_mode(vectorset_mode::unique_ordered);
+    EXPECT_EQ(g.get_keys(), vs_test::make_vector<int>(3, 2, 1));
+    EXPECT_EQ(g.at(2), 20);
+}
+
+
+TEST_F(Vectormap, Random) {
+    std::mt19937 rnd(42);
+    std::uniform_int_distribution<int> dist(0, 999);
+    std::map<int, int> expected;
+    vectormap<int, int> c;
+
+    for (int idx = 0; idx < 2000; ++idx) {
+        auto key = dist(rnd);
+
+        expected.insert({key, idx});
+        c.push_back(key, idx);
+    }
+
+    c.set_mode(vectorset_mode::unique_ordered);
+
+    for (int idx = 0; idx < 2000; ++idx) {
+        auto key = dist(rnd);
+
+        if (idx % 3 == 0) {
+            EXPECT_EQ(c.erase(key), expected.erase(key));
+        }
+        else {
+            EXPECT_EQ(c.insert({key, -idx}).second,
+                      expected.insert({key, -idx}).second);
+        }
+    }
+
+    ASSERT_EQ(c.size(), expected.size());
+
+    auto iter = c.begin();
+    for (auto &elem : expected) {
+        EXPECT_EQ(iter.key(), elem.first);
+        EXPECT_EQ(iter.value(), elem.second);
+        ++iter;
+    }
+}
@@ -0,0 +1,188 @@
+//
+// Copyright 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+
+#include "VectorsetArray.h"
+
+#include "TestUtils.h"
+#include "vectorset_array.h"
+
+#include <cstdint>
+#include <set>
+#include <random>
+#include <string>
+
+
+TEST_F(VectorsetArray, PushBack) {
+    vectorset_array<int> c;
+
+    EXPECT_TRUE(c.empty());
+    EXPECT_EQ(c.size(), 0u);
+
+    c.push_back({ 5, 3, 1, 0, 2, 5 });
+    c.push_back({});
+    c.push_back({ 7, 7, 7 });
+
+    EXPECT_EQ(c.size(), 3u);
+    EXPECT_EQ(c.total_size(), 6u);
+    EXPECT_EQ(
+        std::vector<std::size_t>(
+            c.get_offsets().begin(), c.get_offsets().end()),
+        vs_test::make_vector<std::size_t>(0, 5, 5, 6));
+    EXPECT_EQ(
+        std::vector<int>(c[0].begin(), c[0].end()),
+        vs_test::make_vector<int>(0, 1, 2, 3, 5));
+    EXPECT_TRUE(c[1].empty());
+    EXPECT_EQ(c[2].size(), 1u);
+    EXPECT_EQ(c[2].front(), 7);
+    EXPECT_THROW(c.at(3), std::out_of_range);
+
+    std::vector<std::size_t> sizes;
+    for (auto set : c) {
+        sizes.push_back(set.size());
+    }
+    EXPECT_EQ(sizes, vs_test::make_vector<std::size_t>(5, 0, 1));
+    EXPECT_EQ(c.end() - c.begin(), 3);
+    EXPECT_EQ((*(c.begin() + 2)).back(), 7);
+
+    c.clear();
+    EXPECT_TRUE(c.empty());
+    EXPECT_EQ(c.total_size(), 0u);
+}
+
+
+TEST_F(VectorsetArray, Lookup) {
+    vectorset_array<std::string> c;
+
+    c.push_back({ "d", "b", "f" });
+    c.push_back({ "a" });
+
+    auto set = c[0];
+
+    EXPECT_EQ(*set.find("b"), "b");
+    EXPECT_EQ(set.find("c"), set.end());
+    EXPECT_EQ(set.count("d"), 1u);
+    EXPECT_EQ(set.count("a"), 0u);
+    EXPECT_TRUE(set.contains("f"));
+    EXPECT_FALSE(c[1].contains("f"));
+    EXPECT_EQ(*set.lower_bound("c"), "d");
+    EXPECT_EQ(*set.upper_bound("d"), "f");
+    EXPECT_EQ(set.upper_bound("f"), set.end());
+
+    auto range = set.equal_range("d");
+    EXPECT_EQ(std::distance(range.first, range.second), 1);
+    range = set.equal_range("e");
+    EXPECT_EQ(range.first, range.second);
+
+    EXPECT_EQ(set[1], "d");
+    EXPECT_EQ(set.at(2), "f");
+    EXPECT_THROW(set.at(3), std::out_of_range);
+    EXPECT_EQ(
+        std::vector<std::string>(set.rbegin(), set.rend()),
+        vs_test::make_vector<std::string>("f", "d", "b"));
+}
+
+
+TEST_F(VectorsetArray, Builder) {
+    vectorset_array<int, std::greater<int>>::builder builder;
+
+    builder.insert(2, 4);
+    builder.insert(0, 1);
+    builder.insert(2, 9);
+    builder.insert(0, 1);
+    builder.insert(4, 3);
+    builder.insert(2, 4);
+    builder.insert(0, 8);
+
+    EXPECT_EQ(builder.size(), 5u);
+    EXPECT_EQ(builder.total_size(), 7u);
+
+    auto c = builder.build();
+
+    EXPECT_EQ(builder.size(), 0u);
+    EXPECT_EQ(builder.total_size(), 0u);
+
+    EXPECT_EQ(c.size(), 5u);
+    EXPECT_EQ(c.total_size(), 5u);
+    EXPECT_EQ(
+        std::vector<int>(c[0].begin(), c[0].end()),
+        vs_test::make_vector<int>(8, 1));
+    EXPECT_TRUE(c[1].empty());
+    EXPECT_EQ(
+        std::vector<int>(c[2].begin(), c[2].end()),
+        vs_test::make_vector<int>(9, 4));
+    EXPECT_TRUE(c[3].empty());
+    EXPECT_EQ(c[4].front(), 3);
+    EXPECT_EQ(*c[2].lower_bound(5), 4);
+
+    // trailing empty sets and dropped sets
+    vectorset_array<int>::builder builder2(3);
+
+    builder2.insert(0, 1);
+    builder2.insert(5, 1);
+    builder2.insert(1, 2);
+    builder2.resize(4);
+
+    auto c2 = builder2.build();
+
+    EXPECT_EQ(c2.size(), 4u);
+    EXPECT_EQ(c2.total_size(), 2u);
+    EXPECT_EQ(c2[1].front(), 2);
+    EXPECT_TRUE(c2[3].empty());
+}
+
+
+TEST_F(VectorsetArray, ParallelBuild) {
+    std::mt19937 gen(4711);
+    std::uniform_int_distribution<std::size_t> setDist(0, 9999);
+    std::uniform_int_distribution<uint32_t> keyDist(0, 99);
+
+    std::vector<std::set<uint32_t>> expected(10000);
+    vectorset_array<uint32_t>::builder builder;
+
+    builder.reserve(400000);
+    for (int step = 0; step < 400000; ++step) {
+        auto set = setDist(gen);
+        auto key = keyDist(gen);
+
+        builder.insert(set, key);
+        expected[set].insert(key);
+    }
+
+    auto c = builder.build(4);
+
+    ASSERT_EQ(c.size(), expected.size());
+
+    std::size_t total = 0;
+    for (std::size_t idx = 0; idx < c.size(); ++idx) {
+        ASSERT_EQ(c[idx].size(), expected[idx].size());
+        ASSERT_TRUE(
+            std::equal(
+                c[idx].begin(), c[idx].end(), expected[idx].begin()));
+        total += expected[idx].size();
+    }
+    EXPECT_EQ(c.total_size(), total);
+    EXPECT_EQ(c.get_offsets().back(), total);
+}
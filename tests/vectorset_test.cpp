@@ -35,6 +35,7 @@
 // Test cases
 #include "Constructor.h"
 #include "ModeSwitch.h"
+#include "OrderedMode.h"
 #include "ConstructorCopyMove.h"
 #include "Insert.h"
 #include "InsertPos.h"
@@ -42,10 +43,18 @@
 #include "InsertByInitList.h"
 #include "Emplace.h"
 #include "EmplaceHint.h"
+#include "TryEmplace.h"
 #include "EraseAtPos.h"
 #include "EraseRange.h"
 #include "EraseByKey.h"
+#include "EraseMany.h"
+#include "EraseIf.h"
+#include "Relocate.h"
 #include "MiscManipulationSwap.h"
+#include "Merge.h"
+#include "SetAlgebra.h"
+#include "ParallelSetAlgebra.h"
+#include "SetViews.h"
 #include "Count.h"
 #include "Find.h"
 #include "Contains.h"
@@ -55,6 +64,17 @@
 #include "CompBoolOp.h"
 #include "CompThreeWayOp.h"
 #include "Debug.h"
+#include "BufferedVectorset.h"
+#include "PmaVectorset.h"
+#include "TieredVector.h"
+#include "SmallVector.h"
+#include "CompactVector.h"
+#include "VectorsetArray.h"
+#include "FrozenVectorset.h"
+#include "RoaringVectorset.h"
+#include "StringVectorset.h"
+#include "Vectormap.h"
+#include "LogarithmicVectorset.h"
 
 // Basic constructors:
 // vectorset()
@@ -72,6 +92,13 @@
 // see ModeSwitch.cpp
 
 
+// Ordered mode with duplicates:
+// vectorset_mode::ordered
+////////////////////////////////////////////////////////////////////////
+
+// see OrderedMode.cpp
+
+
 // Copy & Move constructor:
 // vectorset(const vectorset& other)
 // vectorset(vectorset&& other)
@@ -264,6 +291,16 @@ INSTANTIATE_TEST_SUITE_P(
     vs_test::paramSetName<vs_test::EmplaceHintParam>);
 
 
+// construct only if absent:
+// try_emplace(const Key& key, Args&&... args)
+// try_emplace(const K& x, Args&&... args)
+// lazy_emplace(const Key& key, Factory factory)
+// lazy_emplace(const K& x, Factory factory)
+////////////////////////////////////////////////////////////////////////
+
+// see TryEmplace.cpp
+
+
 // erase at position method:
 // erase(const_iterator pos)
 ////////////////////////////////////////////////////////////////////////
@@ -315,6 +352,38 @@ INSTANTIATE_TEST_SUITE_P(
     vs_test::paramSetName<vs_test::EraseByKeyParam>);
 
 
+// erase many keys method:
+// erase_many(InputIt first, InputIt last)
+////////////////////////////////////////////////////////////////////////
+
+// unordered
+INSTANTIATE_TEST_SUITE_P(
+    unordered, EraseMany,
+    testing::ValuesIn(vs_test::EraseManyParam::caseUnordered),
+    vs_test::paramSetName<vs_test::EraseManyParam>);
+
+// ordered
+INSTANTIATE_TEST_SUITE_P(
+    ordered, EraseMany,
+    testing::ValuesIn(vs_test::EraseManyParam::caseOrdered),
+    vs_test::paramSetName<vs_test::EraseManyParam>);
+
+
+// erase by predicate:
+// retain(Pred pred)
+// erase_if(vectorset& c, Pred pred)
+////////////////////////////////////////////////////////////////////////
+
+// see EraseIf.cpp
+
+
+// shift elements by relocation:
+// vectorset_is_trivially_relocatable<T>
+////////////////////////////////////////////////////////////////////////
+
+// see Relocate.cpp
+
+
 // vector manipulation:
 // push_back(const Key& value)
 // push_back(Key&& value)
@@ -336,6 +405,50 @@ INSTANTIATE_TEST_SUITE_P(
     vs_test::paramSetName<vs_test::MiscManipulationSwapParam>);
 
 
+// merge and extract:
+// merge(vectorset& source)
+// merge(vectorset&& source)
+// extract(const_iterator first, const_iterator last)
+////////////////////////////////////////////////////////////////////////
+
+// see Merge.cpp
+
+
+// set algebra:
+// set_union(const vectorset& lhs, const vectorset& rhs)
+// set_intersection(const vectorset& lhs, const vectorset& rhs)
+// set_difference(const vectorset& lhs, const vectorset& rhs)
+// set_symmetric_difference(const vectorset& lhs, const vectorset& rhs)
+// intersect_with(const vectorset& other)
+// subtract(const vectorset& other)
+////////////////////////////////////////////////////////////////////////
+
+// see SetAlgebra.cpp
+
+
+// parallel set algebra:
+// parallel_set_union(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_intersection(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_difference(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_set_symmetric_difference(const vectorset& lhs, const vectorset& rhs, threads)
+// parallel_merge(vectorset& target, vectorset& source, threads)
+////////////////////////////////////////////////////////////////////////
+
+// see ParallelSetAlgebra.cpp
+
+
+// lazy set operation views:
+// make_union_view(const vectorset& lhs, const vectorset& rhs)
+// make_intersection_view(const vectorset& lhs, const vectorset& rhs)
+// make_difference_view(const vectorset& lhs, const vectorset& rhs)
+// make_*_view(std::vector<const vectorset*> sets)
+// vectorset_view::lower_bound(const Key& key)
+// vectorset_view::const_iterator::seek(const Key& key)
+////////////////////////////////////////////////////////////////////////
+
+// see SetViews.cpp
+
+
 // Count methods:
 // count(const Key& key) const
 // template<class K> count(const K& x) const
@@ -475,6 +588,72 @@ INSTANTIATE_TEST_SUITE_P(
 #endif // c++20
 
 
+// Buffered vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see BufferedVectorset.cpp
+
+
+// Packed memory array vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see PmaVectorset.cpp
+
+
+// Tiered vector
+////////////////////////////////////////////////////////////////////////
+
+// see TieredVector.cpp
+
+
+// Small vector
+////////////////////////////////////////////////////////////////////////
+
+// see SmallVector.cpp
+
+
+// Compact vector
+////////////////////////////////////////////////////////////////////////
+
+// see CompactVector.cpp
+
+
+// Packed array of vectorsets
+////////////////////////////////////////////////////////////////////////
+
+// see VectorsetArray.cpp
+
+
+// Frozen (Elias-Fano) vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see FrozenVectorset.cpp
+
+
+// Roaring vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see RoaringVectorset.cpp
+
+
+// String vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see StringVectorset.cpp
+
+
+// Vectormap
+////////////////////////////////////////////////////////////////////////
+
+// see Vectormap.cpp
+
+
+// Logarithmic vectorset
+////////////////////////////////////////////////////////////////////////
+
+// see LogarithmicVectorset.cpp
+
+
 // Main Test Program
 ////////////////////////////////////////////////////////////////////////
 
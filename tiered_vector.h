@@ -0,0 +1,1115 @@
+//
+// Tiered (chunked) vector container.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef TIERED_VECTOR_H
+#define TIERED_VECTOR_H
+
+#include "vectorset.h"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+
+/**
+ * A sequence container based on a tiered vector.
+ *
+ * The elements are stored in chunks of `ChunkSize` elements. Each
+ * chunk is a circular buffer; all chunks except the last one are
+ * full. An insert or erase shifts the elements of one chunk (at most
+ * `ChunkSize / 2` moves) and rotates one element across each of the
+ * following chunk boundaries (O(n / ChunkSize) moves). Iterators are
+ * random access iterators.
+ *
+ * The container provides the interface of `std::vector` used by
+ * `vectorset`, except `data()` (the storage is not contiguous). It
+ * can be used as the storage of a `vectorset` (see `tiered_vectorset`).
+ *
+ * @tparam T Type of the elements.
+ * @tparam Allocator Allocator to use for all memory allocations.
+ * @tparam ChunkSize Number of elements per chunk (a power of two).
+ */
+template<
+    class T,
+    class Allocator = std::allocator<T>,
+    std::size_t ChunkSize = 1024
+    >
+class tiered_vector {
+    static_assert(
+        ChunkSize >= 2 && (ChunkSize & (ChunkSize - 1)) == 0,
+        "ChunkSize of tiered_vector must be a power of two");
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename alloc_traits::pointer;
+    using const_pointer = typename alloc_traits::const_pointer;
+
+    /**
+     * Random access iterator of `tiered_vector`.
+     *
+     * An iterator stores the container and the index of the element.
+     */
+    template<bool IsConst>
+    class basic_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = typename tiered_vector::difference_type;
+        using pointer =
+            typename std::conditional<IsConst, const T*, T*>::type;
+        using reference =
+            typename std::conditional<IsConst, const T&, T&>::type;
+
+        basic_iterator() : owner(nullptr), idx(0) {
+            /* empty */
+        }
+
+        /// Conversion of iterator to const_iterator.
+        template<
+            bool OtherConst,
+            class = typename std::enable_if<IsConst && !OtherConst>::type>
+        basic_iterator(const basic_iterator<OtherConst> &other)
+            : owner(other.owner), idx(other.idx)
+        { /* empty */ }
+
+        reference
+        operator*() const {
+            return owner->element(idx);
+        }
+
+        pointer
+        operator->() const {
+            return std::addressof(owner->element(idx));
+        }
+
+        reference
+        operator[](difference_type offset) const {
+            return owner->element(idx + offset);
+        }
+
+        basic_iterator &
+        operator++() {
+            ++idx;
+            return *this;
+        }
+
+        basic_iterator
+        operator++(int) {
+            auto result = *this;
+            ++idx;
+            return result;
+        }
+
+        basic_iterator &
+        operator--() {
+            --idx;
+            return *this;
+        }
+
+        basic_iterator
+        operator--(int) {
+            auto result = *this;
+            --idx;
+            return result;
+        }
+
+        basic_iterator &
+        operator+=(difference_type offset) {
+            idx += offset;
+            return *this;
+        }
+
+        basic_iterator &
+        operator-=(difference_type offset) {
+            idx -= offset;
+            return *this;
+        }
+
+        friend basic_iterator
+        operator+(basic_iterator iter, difference_type offset) {
+            return (iter += offset);
+        }
+
+        friend basic_iterator
+        operator+(difference_type offset, basic_iterator iter) {
+            return (iter += offset);
+        }
+
+        friend basic_iterator
+        operator-(basic_iterator iter, difference_type offset) {
+            return (iter -= offset);
+        }
+
+        friend difference_type
+        operator-(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx - rhs.idx);
+        }
+
+        friend bool
+        operator==(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx == rhs.idx);
+        }
+
+        friend bool
+        operator!=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx != rhs.idx);
+        }
+
+        friend bool
+        operator<(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx < rhs.idx);
+        }
+
+        friend bool
+        operator>(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx > rhs.idx);
+        }
+
+        friend bool
+        operator<=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx <= rhs.idx);
+        }
+
+        friend bool
+        operator>=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx >= rhs.idx);
+        }
+
+    private:
+        friend class tiered_vector;
+        template<bool> friend class basic_iterator;
+
+        using owner_type =
+            typename std::conditional<
+                IsConst, const tiered_vector, tiered_vector>::type;
+
+        basic_iterator(owner_type *owner, difference_type idx)
+            : owner(owner), idx(idx)
+        { /* empty */ }
+
+        owner_type *owner;
+        difference_type idx;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    /// Circular buffer of elements.
+    struct chunk {
+        /// storage of `cap` elements.
+        pointer data;
+
+        /// position of first element in `data`.
+        size_type head;
+
+        /// number of elements.
+        size_type count;
+
+        /// number of slots (power of two).
+        size_type cap;
+    };
+
+    using chunk_vector =
+        std::vector<
+            chunk, typename alloc_traits::template rebind_alloc<chunk>>;
+
+    /// Number of slots of the first chunk.
+    static constexpr size_type initial_chunk_size =
+        (ChunkSize < 16 ? ChunkSize : 16);
+
+    /// chunks of the vector (all except the last one are full).
+    chunk_vector chunks;
+
+    /// allocator of elements.
+    Allocator alloc;
+
+
+    /// Element of chunk at position `pos` (relative to head).
+    static T &
+    slot(const chunk &ch, size_type pos) {
+        return ch.data[(ch.head + pos) & (ch.cap - 1)];
+    }
+
+    /// Element at index.
+    T &
+    element(size_type idx) {
+        return slot(chunks[idx / ChunkSize], idx % ChunkSize);
+    }
+
+    /// Element at index (const).
+    const T &
+    element(size_type idx) const {
+        return slot(chunks[idx / ChunkSize], idx % ChunkSize);
+    }
+
+    /// Append an empty chunk.
+    void
+    add_chunk(size_type cap) {
+        chunks.push_back(chunk{alloc_traits::allocate(alloc, cap), 0, 0, cap});
+    }
+
+    /// Destroy all elements of chunk and free its storage.
+    void
+    free_chunk(chunk &ch) {
+        while (ch.count > 0) {
+            chunk_pop_back(ch);
+        }
+        alloc_traits::deallocate(alloc, ch.data, ch.cap);
+    }
+
+    /// Construct element at end of chunk.
+    template<class... Args>
+    void
+    chunk_push_back(chunk &ch, Args&&... args) {
+        alloc_traits::construct(
+            alloc, std::addressof(slot(ch, ch.count)),
+            std::forward<Args>(args)...);
+        ++ch.count;
+    }
+
+    /// Construct element at beginning of chunk.
+    void
+    chunk_push_front(chunk &ch, T &&value) {
+        auto head = (ch.head + ch.cap - 1) & (ch.cap - 1);
+
+        alloc_traits::construct(
+            alloc, std::addressof(ch.data[head]), std::move(value));
+        ch.head = head;
+        ++ch.count;
+    }
+
+    /// Destroy last element of chunk.
+    void
+    chunk_pop_back(chunk &ch) {
+        alloc_traits::destroy(alloc, std::addressof(slot(ch, ch.count - 1)));
+        --ch.count;
+    }
+
+    /// Destroy first element of chunk.
+    void
+    chunk_pop_front(chunk &ch) {
+        alloc_traits::destroy(alloc, std::addressof(slot(ch, 0)));
+        ch.head = (ch.head + 1) & (ch.cap - 1);
+        --ch.count;
+    }
+
+    /**
+     * Insert element into chunk (not full).
+     *
+     * The shorter side of the chunk is shifted.
+     */
+    void
+    chunk_insert(chunk &ch, size_type pos, T &&value) {
+        if (pos == ch.count) {
+            chunk_push_back(ch, std::move(value));
+        }
+        else if (pos == 0) {
+            chunk_push_front(ch, std::move(value));
+        }
+        else if (pos < ch.count - pos) {
+            chunk_push_front(ch, std::move(slot(ch, 0)));
+            for (size_type idx = 1; idx < pos; ++idx) {
+                slot(ch, idx) = std::move(slot(ch, idx + 1));
+            }
+            slot(ch, pos) = std::move(value);
+        }
+        else {
+            chunk_push_back(ch, std::move(slot(ch, ch.count - 1)));
+            for (auto idx = ch.count - 2; idx > pos; --idx) {
+                slot(ch, idx) = std::move(slot(ch, idx - 1));
+            }
+            slot(ch, pos) = std::move(value);
+        }
+    }
+
+    /**
+     * Erase element of chunk.
+     *
+     * The shorter side of the chunk is shifted.
+     */
+    void
+    chunk_erase(chunk &ch, size_type pos) {
+        if (pos < ch.count / 2) {
+            for (auto idx = pos; idx > 0; --idx) {
+                slot(ch, idx) = std::move(slot(ch, idx - 1));
+            }
+            chunk_pop_front(ch);
+        }
+        else {
+            for (auto idx = pos; idx + 1 < ch.count; ++idx) {
+                slot(ch, idx) = std::move(slot(ch, idx + 1));
+            }
+            chunk_pop_back(ch);
+        }
+    }
+
+    /**
+     * Make room for one more element in the last chunk.
+     *
+     * A single (first) chunk grows up to `ChunkSize`, after that new
+     * chunks are appended.
+     */
+    void
+    reserve_back() {
+        if (chunks.empty()) {
+            add_chunk(initial_chunk_size);
+            return;
+        }
+
+        auto &last = chunks.back();
+
+        if (last.count < last.cap) {
+            return;
+        }
+
+        if (last.cap == ChunkSize) {
+            add_chunk(ChunkSize);
+            return;
+        }
+
+        chunk grown{
+            alloc_traits::allocate(alloc, last.cap * 2), 0, 0, last.cap * 2};
+
+        for (size_type pos = 0; pos < last.count; ++pos) {
+            chunk_push_back(grown, std::move(slot(last, pos)));
+        }
+
+        free_chunk(last);
+        last = grown;
+    }
+
+    /// Remove last chunk, if it is empty (keep first chunk).
+    void
+    release_back() {
+        if (chunks.size() > 1 && chunks.back().count == 0) {
+            free_chunk(chunks.back());
+            chunks.pop_back();
+        }
+    }
+
+    /// Insert value at index.
+    iterator
+    insert_at(size_type idx, T &&value) {
+        reserve_back();
+
+        auto chunkIdx = idx / ChunkSize;
+
+        // rotate one element across each following chunk boundary
+        for (auto cur = chunks.size() - 1; cur > chunkIdx; --cur) {
+            auto &prev = chunks[cur - 1];
+
+            chunk_push_front(chunks[cur], std::move(slot(prev, prev.count - 1)));
+            chunk_pop_back(prev);
+        }
+
+        chunk_insert(chunks[chunkIdx], idx % ChunkSize, std::move(value));
+
+        return iterator(this, idx);
+    }
+
+    /// Erase value at index.
+    iterator
+    erase_at(size_type idx) {
+        auto chunkIdx = idx / ChunkSize;
+
+        chunk_erase(chunks[chunkIdx], idx % ChunkSize);
+
+        // rotate one element across each following chunk boundary
+        for (auto cur = chunkIdx + 1; cur < chunks.size(); ++cur) {
+            auto &next = chunks[cur];
+
+            chunk_push_back(chunks[cur - 1], std::move(slot(next, 0)));
+            chunk_pop_front(next);
+        }
+
+        release_back();
+
+        return iterator(this, idx);
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor.
+    tiered_vector() : tiered_vector(Allocator()) {
+        /* empty */
+    }
+
+    /**
+     * Constructor (allocator).
+     *
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    tiered_vector(const Allocator& alloc)
+        : chunks(typename chunk_vector::allocator_type(alloc)), alloc(alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Range constructor.
+     *
+     * @param first Input interator to first value to insert.
+     * @param last Input interator after last value to insert.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    tiered_vector(
+        InputIt first, InputIt last, const Allocator& alloc = Allocator())
+        : tiered_vector(alloc)
+    {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    /**
+     * Initializer-list constructor.
+     *
+     * @param init Initializer-list to copy.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    tiered_vector(
+        std::initializer_list<T> init, const Allocator& alloc = Allocator())
+        : tiered_vector(init.begin(), init.end(), alloc)
+    {
+        /* empty */
+    }
+
+    /**
+     * Copy constructor.
+     *
+     * @param other Another container to copy.
+     */
+    tiered_vector(const tiered_vector &other)
+        : tiered_vector(
+            other.begin(), other.end(),
+            alloc_traits::select_on_container_copy_construction(other.alloc))
+    {
+        /* empty */
+    }
+
+    /**
+     * Move constructor.
+     *
+     * @param other Another container to move.
+     */
+    tiered_vector(tiered_vector &&other) noexcept
+        : chunks(std::move(other.chunks)), alloc(other.alloc)
+    {
+        other.chunks.clear();
+    }
+
+    /// Destructor.
+    ~tiered_vector() {
+        clear();
+    }
+
+    /**
+     * Copy assignment.
+     *
+     * @param other Another container to copy.
+     *
+     * @return `*this`
+     */
+    tiered_vector &
+    operator=(const tiered_vector &other) {
+        if (this != &other) {
+            clear();
+            if (alloc_traits::propagate_on_container_copy_assignment::value) {
+                alloc = other.alloc;
+            }
+            for (const auto &value : other) {
+                emplace_back(value);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * Move assignment.
+     *
+     * @param other Another container to move.
+     *
+     * @return `*this`
+     */
+    tiered_vector &
+    operator=(tiered_vector &&other) {
+        if (this != &other) {
+            clear();
+            if (alloc_traits::propagate_on_container_move_assignment::value
+                || alloc == other.alloc)
+            {
+                alloc = other.alloc;
+                chunks.swap(other.chunks);
+            }
+            else {
+                for (auto &value : other) {
+                    emplace_back(std::move(value));
+                }
+                other.clear();
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * Initializer-list assignment.
+     *
+     * @param ilist Initializer-list to copy.
+     *
+     * @return `*this`
+     */
+    tiered_vector &
+    operator=(std::initializer_list<T> ilist) {
+        clear();
+        for (const auto &value : ilist) {
+            emplace_back(value);
+        }
+
+        return *this;
+    }
+
+    /// @}
+
+    /// Get allocator associated with the container.
+    allocator_type
+    get_allocator() const noexcept {
+        return alloc;
+    }
+
+    /// @name Element access
+
+    /// @{
+
+    /// Access element with bounds checking.
+    reference
+    at(size_type pos) {
+        if (pos >= size()) {
+            throw std::out_of_range("tiered_vector::at");
+        }
+        return element(pos);
+    }
+
+    /// Access element with bounds checking (const).
+    const_reference
+    at(size_type pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("tiered_vector::at");
+        }
+        return element(pos);
+    }
+
+    /// Access element.
+    reference
+    operator[](size_type pos) {
+        return element(pos);
+    }
+
+    /// Access element (const).
+    const_reference
+    operator[](size_type pos) const {
+        return element(pos);
+    }
+
+    /// Access first element.
+    reference
+    front() {
+        return element(0);
+    }
+
+    /// Access first element (const).
+    const_reference
+    front() const {
+        return element(0);
+    }
+
+    /// Access last element.
+    reference
+    back() {
+        return element(size() - 1);
+    }
+
+    /// Access last element (const).
+    const_reference
+    back() const {
+        return element(size() - 1);
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    iterator
+    begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    const_iterator
+    begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator
+    cbegin() const noexcept {
+        return begin();
+    }
+
+    iterator
+    end() noexcept {
+        return iterator(this, size());
+    }
+
+    const_iterator
+    end() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    reverse_iterator
+    rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator
+    crbegin() const noexcept {
+        return rbegin();
+    }
+
+    reverse_iterator
+    rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator
+    crend() const noexcept {
+        return rend();
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    bool
+    empty() const noexcept {
+        return (size() == 0);
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return (chunks.empty()
+                ? 0
+                : (chunks.size() - 1) * ChunkSize + chunks.back().count);
+    }
+
+    /// Maximum possible number of elements .
+    size_type
+    max_size() const noexcept {
+        return alloc_traits::max_size(alloc);
+    }
+
+    /// Reserves space in the chunk table for `new_cap` elements.
+    void
+    reserve(size_type new_cap) {
+        chunks.reserve((new_cap + ChunkSize - 1) / ChunkSize);
+    }
+
+    /// Number of elements that can be held in allocated chunks.
+    size_type
+    capacity() const noexcept {
+        return (chunks.empty()
+                ? 0
+                : (chunks.size() - 1) * ChunkSize + chunks.back().cap);
+    }
+
+    /// Reduces memory usage of the chunk table.
+    void
+    shrink_to_fit() {
+        chunks.shrink_to_fit();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /// Clears the contents.
+    void
+    clear() noexcept {
+        for (auto &ch : chunks) {
+            free_chunk(ch);
+        }
+        chunks.clear();
+    }
+
+    /// Inserts element (copy) before `pos`.
+    iterator
+    insert(const_iterator pos, const T &value) {
+        return insert_at(pos.idx, T(value));
+    }
+
+    /// Inserts element (move) before `pos`.
+    iterator
+    insert(const_iterator pos, T &&value) {
+        return insert_at(pos.idx, std::move(value));
+    }
+
+    /// Inserts elements of range [first, last) before `pos`.
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    iterator
+    insert(const_iterator pos, InputIt first, InputIt last) {
+        auto oldSize = size();
+
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+
+        std::rotate(
+            std::next(begin(), pos.idx),
+            std::next(begin(), oldSize),
+            end());
+
+        return iterator(this, pos.idx);
+    }
+
+    /// Inserts elements of initializer list before `pos`.
+    iterator
+    insert(const_iterator pos, std::initializer_list<T> ilist) {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    /// Constructs element in-place before `pos`.
+    template<class... Args>
+    iterator
+    emplace(const_iterator pos, Args&&... args) {
+        return insert_at(pos.idx, T(std::forward<Args>(args)...));
+    }
+
+    /// Erase element at `pos`.
+    iterator
+    erase(const_iterator pos) {
+        return erase_at(pos.idx);
+    }
+
+    /// Erase elements of range [first, last).
+    iterator
+    erase(const_iterator first, const_iterator last) {
+        auto count = last.idx - first.idx;
+
+        if (count > 0) {
+            std::move(
+                std::next(begin(), last.idx), end(),
+                std::next(begin(), first.idx));
+
+            for (; count > 0; --count) {
+                pop_back();
+            }
+        }
+
+        return iterator(this, first.idx);
+    }
+
+    /// Adds an element (copy) to the end.
+    void
+    push_back(const T &value) {
+        emplace_back(value);
+    }
+
+    /// Adds an element (move) to the end.
+    void
+    push_back(T &&value) {
+        emplace_back(std::move(value));
+    }
+
+    /// Constructs an element in-place at the end.
+    template<class... Args>
+    reference
+    emplace_back(Args&&... args) {
+        if (!chunks.empty()
+            && chunks.back().count == chunks.back().cap
+            && chunks.back().cap < ChunkSize)
+        {
+            // the first chunk grows: args may refer to its elements.
+            T value(std::forward<Args>(args)...);
+
+            reserve_back();
+            chunk_push_back(chunks.back(), std::move(value));
+        }
+        else {
+            reserve_back();
+            chunk_push_back(chunks.back(), std::forward<Args>(args)...);
+        }
+
+        auto &last = chunks.back();
+
+        return slot(last, last.count - 1);
+    }
+
+    /// Removes the last element.
+    void
+    pop_back() {
+        chunk_pop_back(chunks.back());
+        release_back();
+    }
+
+    /// Changes the number of elements stored.
+    void
+    resize(size_type count) {
+        while (size() > count) {
+            pop_back();
+        }
+        while (size() < count) {
+            emplace_back();
+        }
+    }
+
+    /// Changes the number of elements stored (copy `value`).
+    void
+    resize(size_type count, const value_type& value) {
+        while (size() > count) {
+            pop_back();
+        }
+        while (size() < count) {
+            emplace_back(value);
+        }
+    }
+
+    /// Exchange content with `other`.
+    void
+    swap(tiered_vector &other) noexcept {
+        using std::swap;
+
+        chunks.swap(other.chunks);
+        swap(alloc, other.alloc);
+    }
+
+    /// @}
+
+}; // class tiered_vector
+
+
+template<class T, class Allocator, std::size_t ChunkSize>
+constexpr typename tiered_vector<T, Allocator, ChunkSize>::size_type
+tiered_vector<T, Allocator, ChunkSize>::initial_chunk_size;
+
+
+/**
+ * Equal operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs`.
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator==(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return (lhs.size() == rhs.size()
+            && std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+#if __cplusplus >= 202002L // c++20
+
+/**
+ * Three way compare of `tiered_vector`.
+ *
+ * Requires *C++20* or higher.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Comparison category type (`std::lexicographical_compare_three_way`).
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline auto
+operator<=>(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return std::lexicographical_compare_three_way(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+#else // until c++20, __cplusplus < 202002L
+
+/**
+ * Not equal operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator!=(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * Less operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs < rhs` (`std::lexicographical_compare`).
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator<(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return std::lexicographical_compare(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/**
+ * Less or equal operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs <= rhs` (`std::lexicographical_compare`).
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator<=(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+/**
+ * Greater operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs > rhs` (`std::lexicographical_compare`).
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator>(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return (rhs < lhs);
+}
+
+/**
+ * Greater or equal operator of `tiered_vector`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs >= rhs` (`std::lexicographical_compare`).
+ */
+template<class T, class Alloc, std::size_t ChunkSize>
+inline bool
+operator>=(
+    const tiered_vector<T, Alloc, ChunkSize>& lhs,
+    const tiered_vector<T, Alloc, ChunkSize>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+#endif // __cplusplus < 202002L
+
+
+/**
+ * `vectorset` with tiered vector storage.
+ *
+ * Inserts and erases in unique ordered mode shift at most one chunk
+ * plus one element per following chunk instead of the whole tail.
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>,
+    std::size_t ChunkSize = 1024
+    >
+using tiered_vectorset =
+    vectorset<Key, Compare, Allocator,
+              tiered_vector<Key, Allocator, ChunkSize>>;
+
+#endif /* TIERED_VECTOR_H */
@@ -0,0 +1,1181 @@
+//
+// Map based on two vectors (keys and mapped values).
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Flat map with the modes of vectorset, which stores keys and mapped
+// values in separate vectors (structure of arrays).
+
+#ifndef VECTOR_SET_MAP_H
+#define VECTOR_SET_MAP_H
+
+#include "vectorset.h"
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Map based on two `std::vector`: one for the keys and one for the
+ * mapped values.
+ *
+ * The mapped value of the key at index `i` is stored at index `i` of
+ * the second vector. Lookups search the key vector only, so large
+ * mapped values are not loaded into the cache by a binary search
+ * (unlike `vectorset<std::pair<Key, T>>`).
+ *
+ * Like `vectorset`, the container has two modes:
+ *
+ * - `vectorset_mode::unordered`: Elements are appended by
+ *   `push_back()` or `insert()` in any order (with duplicate keys).
+ *   Lookups search linearly.
+ * - `vectorset_mode::unique_ordered`: The keys are sorted and unique.
+ *   Switching to this mode sorts both vectors by the keys and keeps
+ *   the first inserted element of equal keys. Lookups use a binary
+ *   search.
+ *
+ * The iterators are random access iterators. Dereferencing returns a
+ * `std::pair<const Key&, T&>` by value; `key()` and `value()` of the
+ * iterator access the element directly.
+ *
+ * @tparam Key Type of the keys.
+ * @tparam T Type of the mapped values.
+ * @tparam Compare Compare function object of the keys.
+ */
+template<class Key, class T, class Compare = std::less<Key>>
+class vectormap {
+public:
+
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+
+    using key_vector_type = std::vector<Key>;
+    using mapped_vector_type = std::vector<T>;
+
+    /**
+     * Random access iterator of `vectormap`.
+     *
+     * @tparam IsConst `true` for the constant iterator.
+     */
+    template<bool IsConst>
+    class basic_iterator {
+    public:
+        using map_pointer = typename std::conditional<
+            IsConst, const vectormap*, vectormap*>::type;
+        using mapped_reference = typename std::conditional<
+            IsConst, const T&, T&>::type;
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::pair<Key, T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::pair<const Key&, mapped_reference>;
+
+        /// Result of `operator->()` (holds the reference pair).
+        struct pointer {
+            reference ref;
+
+            const reference *
+            operator->() const noexcept {
+                return &ref;
+            }
+        };
+
+        basic_iterator() = default;
+
+        /// Conversion of iterator to constant iterator.
+        template<
+            bool OtherConst,
+            class = typename std::enable_if<
+                IsConst && !OtherConst>::type>
+        basic_iterator(const basic_iterator<OtherConst> &other) noexcept
+            : owner(other.owner), idx(other.idx)
+        { /* empty */ }
+
+        /// Key of the element.
+        const Key &
+        key() const {
+            return owner->keys[idx];
+        }
+
+        /// Mapped value of the element.
+        mapped_reference
+        value() const {
+            return owner->values[idx];
+        }
+
+        reference
+        operator*() const {
+            return reference(owner->keys[idx], owner->values[idx]);
+        }
+
+        pointer
+        operator->() const {
+            return pointer{**this};
+        }
+
+        reference
+        operator[](difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        basic_iterator &
+        operator++() {
+            ++idx;
+            return *this;
+        }
+
+        basic_iterator
+        operator++(int) {
+            auto result = *this;
+            ++idx;
+            return result;
+        }
+
+        basic_iterator &
+        operator--() {
+            --idx;
+            return *this;
+        }
+
+        basic_iterator
+        operator--(int) {
+            auto result = *this;
+            --idx;
+            return result;
+        }
+
+        basic_iterator &
+        operator+=(difference_type offset) {
+            idx += offset;
+            return *this;
+        }
+
+        basic_iterator &
+        operator-=(difference_type offset) {
+            idx -= offset;
+            return *this;
+        }
+
+        friend basic_iterator
+        operator+(basic_iterator iter, difference_type offset) {
+            return (iter += offset);
+        }
+
+        friend basic_iterator
+        operator+(difference_type offset, basic_iterator iter) {
+            return (iter += offset);
+        }
+
+        friend basic_iterator
+        operator-(basic_iterator iter, difference_type offset) {
+            return (iter -= offset);
+        }
+
+        friend difference_type
+        operator-(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (static_cast<difference_type>(lhs.idx)
+                    - static_cast<difference_type>(rhs.idx));
+        }
+
+        friend bool
+        operator==(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx == rhs.idx);
+        }
+
+        friend bool
+        operator!=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx != rhs.idx);
+        }
+
+        friend bool
+        operator<(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx < rhs.idx);
+        }
+
+        friend bool
+        operator>(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx > rhs.idx);
+        }
+
+        friend bool
+        operator<=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx <= rhs.idx);
+        }
+
+        friend bool
+        operator>=(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return (lhs.idx >= rhs.idx);
+        }
+
+    private:
+        friend class vectormap;
+        friend class basic_iterator<!IsConst>;
+
+        basic_iterator(map_pointer owner, size_type idx)
+            : owner(owner), idx(idx)
+        { /* empty */ }
+
+        map_pointer owner = nullptr;
+        size_type idx = 0;
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    /// Keys (sorted and unique in mode `unique_ordered`).
+    key_vector_type keys;
+
+    /// Mapped values (same index as the key).
+    mapped_vector_type values;
+
+    /// Compare method of the keys.
+    VSET_no_unique_address Compare comp;
+
+    /// Mode of the container.
+    vectorset_mode opMode = vectorset_mode::unordered;
+
+    /// Equal operator based on `comp`.
+    bool
+    comp_eq(const Key &lhv, const Key &rhv) const {
+        return !(comp(lhv, rhv) || comp(rhv, lhv));
+    }
+
+    /// Index of the first key not less than `key` (ordered).
+    size_type
+    lower_index(const Key &key) const {
+        return static_cast<size_type>(
+            std::lower_bound(keys.begin(), keys.end(), key, comp)
+            - keys.begin());
+    }
+
+    /// Index of the first key greater than `key` (ordered).
+    size_type
+    upper_index(const Key &key) const {
+        return static_cast<size_type>(
+            std::upper_bound(keys.begin(), keys.end(), key, comp)
+            - keys.begin());
+    }
+
+    /// Index of the first key equal to `key` (`size()`, if not found).
+    size_type
+    find_index(const Key &key) const {
+        if (opMode == vectorset_mode::unordered) {
+            for (size_type idx = 0; idx < keys.size(); ++idx) {
+                if (comp_eq(keys[idx], key)) {
+                    return idx;
+                }
+            }
+
+            return keys.size();
+        }
+
+        auto idx = lower_index(key);
+
+        return ((idx < keys.size() && !comp(key, keys[idx]))
+                ? idx
+                : keys.size());
+    }
+
+    /**
+     * Insert key and mapped value at `idx`, if `key` is not contained.
+     *
+     * The key is searched by a binary search in mode
+     * `vectorset_mode::unique_ordered` and linearly in mode
+     * `vectorset_mode::unordered` (new keys are appended).
+     *
+     * @return index of the element and `true`, if it was inserted.
+     */
+    template<class K, class... Args>
+    std::pair<size_type, bool>
+    impl_try_emplace(K&& key, Args&&... args) {
+        size_type idx = keys.size();
+
+        if (opMode == vectorset_mode::unique_ordered) {
+            idx = lower_index(key);
+            if (idx < keys.size() && !comp(key, keys[idx])) {
+                return {idx, false};
+            }
+        }
+        else {
+            auto found = find_index(key);
+            if (found != keys.size()) {
+                return {found, false};
+            }
+        }
+
+        impl_emplace_at(
+            idx, std::forward<K>(key), std::forward<Args>(args)...);
+
+        return {idx, true};
+    }
+
+    /**
+     * Insert key and mapped value (`insert()`).
+     *
+     * Like `impl_try_emplace`, but the element is always appended in
+     * mode `vectorset_mode::unordered` (no linear search).
+     *
+     * @return index of the element and `true`, if it was inserted.
+     */
+    template<class K, class M>
+    std::pair<size_type, bool>
+    impl_insert(K&& key, M&& value) {
+        if (opMode == vectorset_mode::unique_ordered) {
+            return impl_try_emplace(
+                std::forward<K>(key), std::forward<M>(value));
+        }
+
+        impl_emplace_at(
+            keys.size(), std::forward<K>(key), std::forward<M>(value));
+
+        return {keys.size() - 1, true};
+    }
+
+    /// Insert key and mapped value at `idx` (both or none).
+    template<class K, class... Args>
+    void
+    impl_emplace_at(size_type idx, K&& key, Args&&... args) {
+        values.emplace(
+            values.begin() + idx, std::forward<Args>(args)...);
+        try {
+            keys.emplace(keys.begin() + idx, std::forward<K>(key));
+        }
+        catch (...) {
+            values.erase(values.begin() + idx);
+            throw;
+        }
+    }
+
+    /**
+     * Sort both vectors by the keys and remove duplicate keys.
+     *
+     * The sort permutes an index vector, so keys and mapped values
+     * are moved only once into their final position. Of equal keys
+     * the first inserted element is kept.
+     */
+    void
+    make_unique_ordered() {
+        bool sortedUnique = true;
+
+        for (size_type idx = 1; idx < keys.size() && sortedUnique; ++idx) {
+            sortedUnique = comp(keys[idx - 1], keys[idx]);
+        }
+
+        if (sortedUnique) {
+            return;
+        }
+
+        std::vector<size_type> order(keys.size());
+        std::iota(order.begin(), order.end(), size_type(0));
+
+        std::stable_sort(
+            order.begin(), order.end(),
+            [this](size_type lhs, size_type rhs) {
+                return comp(keys[lhs], keys[rhs]);
+            });
+
+        order.erase(
+            std::unique(
+                order.begin(), order.end(),
+                [this](size_type lhs, size_type rhs) {
+                    return comp_eq(keys[lhs], keys[rhs]);
+                }),
+            order.end());
+
+        key_vector_type newKeys;
+        mapped_vector_type newValues;
+
+        newKeys.reserve(order.size());
+        newValues.reserve(order.size());
+        for (auto idx : order) {
+            newKeys.push_back(std::move(keys[idx]));
+            newValues.push_back(std::move(values[idx]));
+        }
+
+        keys.swap(newKeys);
+        values.swap(newValues);
+    }
+
+    /// Throw `std::logic_error`, if the container is not ordered.
+    void
+    check_ordered(const char *name) const {
+        if (opMode != vectorset_mode::unique_ordered) {
+            throw std::logic_error(
+                std::string(name)
+                + " is only available in vectorset_mode::unique_ordered");
+        }
+    }
+
+public:
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor (empty, `vectorset_mode::unordered`).
+    vectormap() : comp(Compare()) {
+        /* empty */
+    }
+
+    /**
+     * Construct empty container (comparator).
+     *
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     */
+    explicit
+    vectormap(const Compare& comp) : comp(comp) {
+        /* empty */
+    }
+
+    /**
+     * Range constructor (`vectorset_mode::unordered`).
+     *
+     * @param first Input iterator to the first key/value pair.
+     * @param last Input iterator after the last key/value pair.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     */
+    template<
+        class InputIt,
+        class = typename std::enable_if<
+            !std::is_integral<InputIt>::value>::type>
+    vectormap(InputIt first, InputIt last, const Compare& comp = Compare())
+        : comp(comp)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * Initializer-list constructor (`vectorset_mode::unordered`).
+     *
+     * @param init Initializer-list of key/value pairs.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     */
+    vectormap(
+        std::initializer_list<value_type> init,
+        const Compare& comp = Compare())
+        : vectormap(init.begin(), init.end(), comp)
+    {
+        /* empty */
+    }
+
+    /**
+     * Construct from a key and a value vector
+     * (`vectorset_mode::unordered`).
+     *
+     * @throws std::invalid_argument The vectors have different sizes.
+     *
+     * @param keyVec Keys.
+     * @param valueVec Mapped values (same index as the key).
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     */
+    vectormap(
+        key_vector_type keyVec, mapped_vector_type valueVec,
+        const Compare& comp = Compare())
+        : keys(std::move(keyVec)), values(std::move(valueVec)), comp(comp)
+    {
+        if (keys.size() != values.size()) {
+            throw std::invalid_argument(
+                "vectormap: keys and values have different sizes");
+        }
+    }
+
+    /// @}
+
+    /// @name Mode
+
+    /// @{
+
+    /**
+     * Set mode of container.
+     *
+     * Switching to `vectorset_mode::unique_ordered` sorts keys and
+     * mapped values by the keys and removes elements with duplicate
+     * keys (the first inserted element is kept).
+     *
+     * @throws std::invalid_argument Mode `vectorset_mode::ordered` is
+     *                               not supported.
+     *
+     * @param op_mode New operation mode.
+     */
+    void
+    set_mode(vectorset_mode op_mode) {
+        if (op_mode == vectorset_mode::ordered) {
+            throw std::invalid_argument(
+                "vectormap: vectorset_mode::ordered is not supported");
+        }
+
+        if (opMode == op_mode) {
+            return;
+        }
+
+        if (op_mode == vectorset_mode::unique_ordered) {
+            make_unique_ordered();
+        }
+
+        opMode = op_mode;
+    }
+
+    /// Get current mode of container.
+    vectorset_mode
+    get_mode() const noexcept {
+        return opMode;
+    }
+
+    /// @}
+
+    /// @name Element access
+
+    /// @{
+
+    /**
+     * Access mapped value of `key` with bounds checking.
+     *
+     * @throws std::out_of_range The container does not contain `key`.
+     */
+    T &
+    at(const Key &key) {
+        auto idx = find_index(key);
+
+        if (idx == keys.size()) {
+            throw std::out_of_range("vectormap::at: key not found");
+        }
+
+        return values[idx];
+    }
+
+    /**
+     * Access mapped value of `key` with bounds checking (const).
+     *
+     * @throws std::out_of_range The container does not contain `key`.
+     */
+    const T &
+    at(const Key &key) const {
+        auto idx = find_index(key);
+
+        if (idx == keys.size()) {
+            throw std::out_of_range("vectormap::at: key not found");
+        }
+
+        return values[idx];
+    }
+
+    /**
+     * Access or insert mapped value of `key`.
+     *
+     * If the container does not contain `key`, a value initialized
+     * mapped value is inserted.
+     */
+    T &
+    operator[](const Key &key) {
+        return values[impl_try_emplace(key).first];
+    }
+
+    /// Access or insert mapped value of `key` (move key).
+    T &
+    operator[](Key &&key) {
+        return values[impl_try_emplace(std::move(key)).first];
+    }
+
+    /// Get vector of keys.
+    const key_vector_type &
+    get_keys() const noexcept {
+        return keys;
+    }
+
+    /// Get vector of mapped values (same index as the key).
+    const mapped_vector_type &
+    get_values() const noexcept {
+        return values;
+    }
+
+    /// @}
+
+    /// @name Iterators
+
+    /// @{
+
+    /// Iterator to the beginning.
+    iterator
+    begin() noexcept {
+        return iterator(this, 0);
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    /// Iterator to the beginning (const).
+    const_iterator
+    cbegin() const noexcept {
+        return begin();
+    }
+
+    /// Iterator to the end.
+    iterator
+    end() noexcept {
+        return iterator(this, keys.size());
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    end() const noexcept {
+        return const_iterator(this, keys.size());
+    }
+
+    /// Iterator to the end (const).
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    /// Reverse iterator to the beginning.
+    reverse_iterator
+    rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+
+    /// Reverse iterator to the beginning (const).
+    const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+
+    /// Reverse iterator to the end.
+    reverse_iterator
+    rend() noexcept {
+        return reverse_iterator(begin());
+    }
+
+    /// Reverse iterator to the end (const).
+    const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    /// @}
+
+    /// @name Capacity
+
+    /// @{
+
+    /// Checks if the container has no elements.
+    [[nodiscard]]
+    bool
+    empty() const noexcept {
+        return keys.empty();
+    }
+
+    /// Number of elements in the container.
+    size_type
+    size() const noexcept {
+        return keys.size();
+    }
+
+    /// Maximum possible number of elements.
+    size_type
+    max_size() const noexcept {
+        return std::min(keys.max_size(), values.max_size());
+    }
+
+    /// Reserve storage for `new_cap` elements.
+    void
+    reserve(size_type new_cap) {
+        keys.reserve(new_cap);
+        values.reserve(new_cap);
+    }
+
+    /// Number of elements that can be held without reallocation.
+    size_type
+    capacity() const noexcept {
+        return std::min(keys.capacity(), values.capacity());
+    }
+
+    /// Free unused memory.
+    void
+    shrink_to_fit() {
+        keys.shrink_to_fit();
+        values.shrink_to_fit();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /// Clears the contents (the mode is kept).
+    void
+    clear() noexcept {
+        keys.clear();
+        values.clear();
+    }
+
+    /**
+     * Inserts new element (copy).
+     *
+     * * Insert the element in sorted container
+     *   (`vectorset_mode::unique_ordered`), if the container does not
+     *   contain the key.
+     * * If the container is unordered (`vectorset_mode::unordered`),
+     *   the element is always appended (`push_back`).
+     *
+     * @param value Key/value pair to insert.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element (or the element with the key) and a
+     *         bool value set to true if the insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(const value_type &value) {
+        auto result = impl_insert(value.first, value.second);
+
+        return {iterator(this, result.first), result.second};
+    }
+
+    /**
+     * Inserts new element (move).
+     *
+     * See `insert(const value_type&)`.
+     *
+     * @param value Key/value pair to insert.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element (or the element with the key) and a
+     *         bool value set to true if the insertion took place.
+     */
+    std::pair<iterator, bool>
+    insert(value_type &&value) {
+        auto result =
+            impl_insert(std::move(value.first), std::move(value.second));
+
+        return {iterator(this, result.first), result.second};
+    }
+
+    /**
+     * Inserts elements from range [first, last).
+     *
+     * The elements are appended. In mode
+     * `vectorset_mode::unique_ordered` both vectors are sorted again
+     * afterwards; elements with keys already contained are dropped.
+     * If an exception is thrown, the appended elements are removed
+     * and the mode is kept.
+     *
+     * @param first Iterator to first key/value pair to insert.
+     * @param last Iterator _after_ last key/value pair to insert.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last) {
+        auto mode = opMode;
+        auto oldSize = keys.size();
+
+        opMode = vectorset_mode::unordered;
+        try {
+            for (; first != last; ++first) {
+                push_back(first->first, first->second);
+            }
+        }
+        catch (...) {
+            // remove the appended elements, restore the mode
+            keys.erase(keys.begin() + oldSize, keys.end());
+            values.erase(values.begin() + oldSize, values.end());
+            opMode = mode;
+            throw;
+        }
+        set_mode(mode);
+    }
+
+    /**
+     * Inserts elements from initializer list.
+     *
+     * See `insert(InputIt,InputIt)`.
+     *
+     * @param ilist Initializer-list of key/value pairs.
+     */
+    void
+    insert(std::initializer_list<value_type> ilist) {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * Insert a mapped value constructed from `args`, if the container
+     * does not contain `key` (unordered: linear search, append).
+     *
+     * @param key Key of the new element.
+     * @param args Arguments to construct the mapped value.
+     *
+     * @return Returns a pair consisting of an iterator to the
+     *         inserted element (or the element with the key) and a
+     *         bool value set to true if the insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool>
+    try_emplace(const Key &key, Args&&... args) {
+        auto result = impl_try_emplace(key, std::forward<Args>(args)...);
+
+        return {iterator(this, result.first), result.second};
+    }
+
+    /// See `try_emplace(const Key&, Args&&...)` (move key).
+    template<class... Args>
+    std::pair<iterator, bool>
+    try_emplace(Key &&key, Args&&... args) {
+        auto result =
+            impl_try_emplace(std::move(key), std::forward<Args>(args)...);
+
+        return {iterator(this, result.first), result.second};
+    }
+
+    /**
+     * Insert or assign the mapped value of `key`.
+     *
+     * In mode `vectorset_mode::unordered` the first element with
+     * `key` is assigned.
+     *
+     * @param key Key of the element.
+     * @param obj Mapped value to assign.
+     *
+     * @return Returns a pair consisting of an iterator to the element
+     *         and a bool value set to true if the insertion took
+     *         place.
+     */
+    template<class M>
+    std::pair<iterator, bool>
+    insert_or_assign(const Key &key, M&& obj) {
+        auto idx = find_index(key);
+
+        if (idx != keys.size()) {
+            values[idx] = std::forward<M>(obj);
+            return {iterator(this, idx), false};
+        }
+
+        return try_emplace(key, std::forward<M>(obj));
+    }
+
+    /**
+     * Appends key and mapped value to the end of the container (only
+     * unordered container).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param key Key to append.
+     * @param value Mapped value to append.
+     */
+    template<class K, class M>
+    void
+    push_back(K&& key, M&& value) {
+        if (opMode == vectorset_mode::unique_ordered) {
+            throw std::logic_error(
+                "push_back is only available in vectorset_mode::unordered");
+        }
+
+        impl_emplace_at(
+            keys.size(), std::forward<K>(key), std::forward<M>(value));
+    }
+
+    /**
+     * Erase element at position.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return Iterator following the removed element.
+     */
+    iterator
+    erase(const_iterator pos) {
+        _VECTOR_SET_ASSERT(pos.owner == this && pos.idx < keys.size());
+
+        keys.erase(keys.begin() + pos.idx);
+        values.erase(values.begin() + pos.idx);
+
+        return iterator(this, pos.idx);
+    }
+
+    /**
+     * Erase elements by key.
+     *
+     * @param key Key of the elements to remove.
+     *
+     * @return Number of elements removed (more than 1 is only
+     *         possible in mode `vectorset_mode::unordered`).
+     */
+    size_type
+    erase(const Key &key) {
+        if (opMode == vectorset_mode::unique_ordered) {
+            auto idx = find_index(key);
+
+            if (idx == keys.size()) {
+                return 0;
+            }
+
+            erase(const_iterator(this, idx));
+            return 1;
+        }
+
+        // stable compaction of both vectors
+        size_type write = 0;
+
+        for (size_type read = 0; read < keys.size(); ++read) {
+            if (!comp_eq(keys[read], key)) {
+                if (write != read) {
+                    keys[write] = std::move(keys[read]);
+                    values[write] = std::move(values[read]);
+                }
+                ++write;
+            }
+        }
+
+        auto count = keys.size() - write;
+
+        keys.erase(keys.begin() + write, keys.end());
+        values.erase(values.begin() + write, values.end());
+
+        return count;
+    }
+
+    /**
+     * swap content.
+     *
+     * @param other Container to exchange the contents with.
+     */
+    void
+    swap(vectormap& other) noexcept {
+        keys.swap(other.keys);
+        values.swap(other.values);
+        std::swap(comp, other.comp);
+        std::swap(opMode, other.opMode);
+    }
+
+    /// @}
+
+    /// @name Lookup
+
+    /// @{
+
+    /**
+     * Number of elements with key `key`.
+     *
+     * @param key Key to count.
+     *
+     * @return number of elements (0 or 1 in mode
+     *         `vectorset_mode::unique_ordered`).
+     */
+    size_type
+    count(const Key &key) const {
+        if (opMode == vectorset_mode::unique_ordered) {
+            return (contains(key) ? 1 : 0);
+        }
+
+        return static_cast<size_type>(
+            std::count_if(
+                keys.begin(), keys.end(),
+                [this, &key](const Key &val) {
+                    return this->comp_eq(val, key);
+                }));
+    }
+
+    /**
+     * Find element with key `key`.
+     *
+     * @param key Key to search for.
+     *
+     * @return iterator to matched element or `end()`, if not found.
+     */
+    iterator
+    find(const Key &key) {
+        return iterator(this, find_index(key));
+    }
+
+    /**
+     * Find element with key `key` (const).
+     *
+     * @param key Key to search for.
+     *
+     * @return iterator to matched element or `end()`, if not found.
+     */
+    const_iterator
+    find(const Key &key) const {
+        return const_iterator(this, find_index(key));
+    }
+
+    /**
+     * Checks if the container contains `key`.
+     *
+     * @param key Key to search for.
+     *
+     * @return `true`, if container conains `key`.
+     */
+    bool
+    contains(const Key &key) const {
+        return (find_index(key) != keys.size());
+    }
+
+    /**
+     * Iterator to the first element with key not less than `key`
+     * (only `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    iterator
+    lower_bound(const Key &key) {
+        check_ordered("lower_bound");
+        return iterator(this, lower_index(key));
+    }
+
+    /// See `lower_bound(const Key&)` (const).
+    const_iterator
+    lower_bound(const Key &key) const {
+        check_ordered("lower_bound");
+        return const_iterator(this, lower_index(key));
+    }
+
+    /**
+     * Iterator to the first element with key greater than `key`
+     * (only `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    iterator
+    upper_bound(const Key &key) {
+        check_ordered("upper_bound");
+        return iterator(this, upper_index(key));
+    }
+
+    /// See `upper_bound(const Key&)` (const).
+    const_iterator
+    upper_bound(const Key &key) const {
+        check_ordered("upper_bound");
+        return const_iterator(this, upper_index(key));
+    }
+
+    /**
+     * Range of elements with key `key` (only
+     * `vectorset_mode::unique_ordered`).
+     *
+     * @throws std::logic_error Method is used in mode
+     *                          `vectorset_mode::unordered`.
+     */
+    std::pair<iterator, iterator>
+    equal_range(const Key &key) {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /// See `equal_range(const Key&)` (const).
+    std::pair<const_iterator, const_iterator>
+    equal_range(const Key &key) const {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /// Get function object that compares the keys.
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+    /// @}
+
+}; // class vectormap
+
+
+/**
+ * Equal operator of `vectormap`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs == rhs` (same elements in same order).
+ */
+template<class Key, class T, class Compare>
+inline bool
+operator==(
+    const vectormap<Key, T, Compare>& lhs,
+    const vectormap<Key, T, Compare>& rhs)
+{
+    return (lhs.get_keys() == rhs.get_keys()
+            && lhs.get_values() == rhs.get_values());
+}
+
+/**
+ * Not equal operator of `vectormap`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true` if `lhs != rhs`.
+ */
+template<class Key, class T, class Compare>
+inline bool
+operator!=(
+    const vectormap<Key, T, Compare>& lhs,
+    const vectormap<Key, T, Compare>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * Swap content of two `vectormap`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ */
+template<class Key, class T, class Compare>
+inline void
+swap(
+    vectormap<Key, T, Compare>& lhs,
+    vectormap<Key, T, Compare>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+#endif /* VECTOR_SET_MAP_H */
@@ -31,6 +31,12 @@
 #include <memory>
 #include <algorithm>
 #include <stdexcept>
+#include <type_traits>
+#include <cstring>
+
+#if __cplusplus >= 201703L // c++17
+#    include <memory_resource>
+#endif
 
 #if __cplusplus >= 201402L // c++14
 #    define VSET_CXX11_empty_constexpr constexpr
@@ -38,6 +44,16 @@
 #    define VSET_CXX11_empty_constexpr
 #endif
 
+// Empty members (e.g. `std::less<Key>`) occupy no storage.
+#if defined(__has_cpp_attribute)
+#    if __has_cpp_attribute(no_unique_address)
+#        define VSET_no_unique_address [[no_unique_address]]
+#    endif
+#endif
+#ifndef VSET_no_unique_address
+#    define VSET_no_unique_address
+#endif
+
 // Debug defines
 #if _VECTOR_SET_DO_TRACE == 1
 
@@ -195,10 +211,193 @@ enum class vectorset_mode : char {
     unique_ordered,
 
     /// unordered content (vector).
-    unordered
+    unordered,
+
+    /// ordered content, duplicates are kept (multiset).
+    ordered
+};
+
+
+/// Tag type to construct a `vectorset` from sorted unique values.
+struct vectorset_sorted_unique_t {
+    explicit vectorset_sorted_unique_t() = default;
+};
+
+/// Tag: the values are sorted and contain no duplicates.
+constexpr vectorset_sorted_unique_t vectorset_sorted_unique{};
+
+
+/**
+ * Trait: Values of type `T` can be relocated by copying their bytes.
+ *
+ * A relocation moves an object to a new address and ends the lifetime
+ * of the source without calling its move constructor and destructor.
+ * If the trait is `true`, `vectorset` shifts elements of ordered
+ * inserts and erases by `memmove()`.
+ *
+ * The default is `std::is_trivially_copyable<T>`. Specialize it for
+ * own types, that do not store pointers into themselves (e.g. a
+ * record holding a `std::unique_ptr`):
+ *
+ *     template<>
+ *     struct vectorset_is_trivially_relocatable<my_record>
+ *         : std::true_type {};
+ */
+template<class T>
+struct vectorset_is_trivially_relocatable
+    : std::is_trivially_copyable<T>
+{};
+
+
+/**
+ * Trait: Maximal size of a `Container`, which is searched linearly.
+ *
+ * Lookups in unique ordered mode step through small containers
+ * instead of a binary search. The default is 0 (always binary
+ * search); `small_vector` uses its inline capacity (at most 16).
+ */
+template<class Container>
+struct vectorset_linear_search_limit
+    : std::integral_constant<std::size_t, 0>
+{};
+
+
+/**
+ * Trait: `Container` stores the mode of the `vectorset`.
+ *
+ * If the trait is `true`, `vectorset` keeps its mode in two spare
+ * bits of the container (`get_owner_bits()` / `set_owner_bits()`)
+ * instead of a separate member. The owner bits are not copied, moved
+ * or swapped together with the elements. The default is `false`;
+ * `compact_vector` embeds the mode.
+ */
+template<class Container>
+struct vectorset_embeds_mode : std::false_type {};
+
+
+/// Storage of the mode of a `vectorset` (separate member).
+template<
+    class Container,
+    bool Embedded = vectorset_embeds_mode<Container>::value>
+struct _vectorset_mode_store {
+    vectorset_mode op_mode = vectorset_mode::unordered;
+
+    vectorset_mode
+    get(const Container&) const noexcept {
+        return op_mode;
+    }
+
+    void
+    set(Container&, vectorset_mode mode) noexcept {
+        op_mode = mode;
+    }
+};
+
+
+/// Storage of the mode of a `vectorset` (owner bits of container).
+template<class Container>
+struct _vectorset_mode_store<Container, true> {
+    // owner bits 0 (default) are vectorset_mode::unordered
+    vectorset_mode
+    get(const Container& values) const noexcept {
+        auto bits = values.get_owner_bits();
+
+        return (bits == 0
+                ? vectorset_mode::unordered
+                : static_cast<vectorset_mode>(bits - 1));
+    }
+
+    void
+    set(Container& values, vectorset_mode mode) noexcept {
+        values.set_owner_bits(
+            mode == vectorset_mode::unordered
+            ? 0u
+            : static_cast<unsigned>(mode) + 1);
+    }
 };
 
 
+/**
+ * Search lower bound forward from `first` (galloping).
+ *
+ * The elements at distance 1, 2, 4, ... from `first` are probed
+ * before the binary search. The costs are logarithmic in the distance
+ * of the result to `first`, which makes merges of sorted ranges of
+ * very different sizes fast.
+ *
+ * @param first Begin of sorted range (random access).
+ * @param last End of sorted range.
+ * @param value Value to search for.
+ * @param comp Compare function.
+ *
+ * @return Iterator to first element in [first, last) not less than
+ *         `value`.
+ */
+template<class RandomIt, class T, class Compare>
+RandomIt
+_vectorset_gallop_lower_bound(
+    RandomIt first, RandomIt last, const T& value, Compare comp)
+{
+    auto count = std::distance(first, last);
+    decltype(count) bound = 1;
+
+    while (bound <= count && comp(*std::next(first, bound - 1), value)) {
+        bound *= 2;
+    }
+
+    return std::lower_bound(
+        std::next(first, bound / 2),
+        std::next(first, std::min(bound, count)),
+        value, comp);
+}
+
+
+/**
+ * Search lower bound (linear up to `Limit` elements).
+ *
+ * @tparam Limit Maximal size of the range to search linearly.
+ *
+ * @param first Begin of the sorted range.
+ * @param last End of the sorted range.
+ * @param value Value to search.
+ * @param comp Compare function of the range.
+ *
+ * @return Iterator to the first element not less than `value`.
+ */
+template<std::size_t Limit, class RandomIt, class T, class Compare>
+inline RandomIt
+_vectorset_lower_bound(
+    RandomIt first, RandomIt last, const T& value, Compare comp)
+{
+    if (Limit > 0 && static_cast<std::size_t>(last - first) <= Limit) {
+        while (first != last && comp(*first, value)) {
+            ++first;
+        }
+        return first;
+    }
+
+    return std::lower_bound(first, last, value, comp);
+}
+
+
+/**
+ * Check, if the sizes of two merged ranges are very different.
+ *
+ * Merges of skewed ranges search by galloping instead of stepping
+ * through each element.
+ *
+ * @param lhsSize Size of the first range.
+ * @param rhsSize Size of the second range.
+ *
+ * @return `true`, if one range is more than 32 times larger.
+ */
+inline bool
+_vectorset_is_skewed(size_t lhsSize, size_t rhsSize) noexcept
+{
+    return (lhsSize / 32 > rhsSize || rhsSize / 32 > lhsSize);
+}
+
+
 /**
  * A set based on `std::vector` container.
  *
@@ -209,16 +408,27 @@ enum class vectorset_mode : char {
  *
  * You can toggle between the two modes, affecting the performance of
  * the container.
+ *
+ * The underlying sequence container can be replaced by `Container`
+ * (e.g. `tiered_vector`). It has to provide the interface of
+ * `std::vector` with random access iterators; `data()`, `reserve()`,
+ * `capacity()` and `shrink_to_fit()` are only required if they are
+ * used.
  */
 template<
     class Key,
     class Compare = std::less<Key>,
-    class Allocator = std::allocator<Key>
+    class Allocator = std::allocator<Key>,
+    class Container = std::vector<Key, Allocator>
     >
 class vectorset {
+    static_assert(
+        std::is_same<typename Container::value_type, Key>::value,
+        "value_type of Container must be Key");
+
 public:
 
-    using vector_type = std::vector<Key, Allocator>;
+    using vector_type = Container;
     using key_type = Key;
     using value_type = Key;
     using size_type  = typename vector_type::size_type;
@@ -311,10 +521,28 @@ private:
     vector_type values;
 
     /// operating mode (unique ordered or unordered)
-    vectorset_mode op_mode = vectorset_mode::unordered;
+    VSET_no_unique_address _vectorset_mode_store<vector_type> op_mode;
 
     /// compare method
-    Compare comp;
+    VSET_no_unique_address Compare comp;
+
+    /// Current operating mode.
+    vectorset_mode
+    mode() const noexcept {
+        return op_mode.get(values);
+    }
+
+    /// Change operating mode (without reordering the values).
+    void
+    store_mode(vectorset_mode newMode) noexcept {
+        op_mode.set(values, newMode);
+    }
+
+    /// Values are sorted (`unique_ordered` or `ordered`).
+    bool
+    sorted_mode() const noexcept {
+        return (mode() != vectorset_mode::unordered);
+    }
 
 
     /**
@@ -331,6 +559,22 @@ private:
     }
 
 
+    /**
+     * Check, that the values are sorted and unique (debug).
+     *
+     * @return `true`, if each value is less than its successor.
+     */
+    bool
+    is_sorted_unique() const {
+        return (
+            std::adjacent_find(
+                values.begin(), values.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return !this->comp(lhv, rhv);
+                }) == values.end());
+    }
+
+
     /**
      * Insert value into ordered vector.
      *
@@ -346,7 +590,7 @@ private:
         _VECTOR_SET_TRACE("start");
 
         auto iter =
-            std::lower_bound(values.begin(), values.end(), value, comp);
+            impl_lower_bound(values.begin(), values.end(), value, comp);
 
         _VECTOR_SET_TRACE_ITER("lower_bound", iter);
 
@@ -356,7 +600,9 @@ private:
             return std::make_pair(iter, false);
         }
         else {
-            auto resIter = values.insert(iter, std::forward<ValType>(value));
+            auto resIter =
+                emplace_at(
+                    iter, relocate_by_memmove(), std::forward<ValType>(value));
             _VECTOR_SET_TRACE_ITER("insert", resIter);
 
             return std::make_pair(resIter, true);
@@ -390,6 +636,33 @@ private:
         return result;
     }
 
+    /**
+     * Insert value into ordered vector with duplicates.
+     *
+     * The value is inserted after all equal values (upper bound), so
+     * equal values keep their insertion order.
+     *
+     * @param value Value to insert.
+     *
+     * @return result pair: iterator to inserted value and `true`.
+     */
+    template<class ValType>
+    std::pair<iterator, bool>
+    impl_insert_ordered(ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_insert_ordered(ValType&&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto iter = std::upper_bound(values.begin(), values.end(), value, comp);
+
+        _VECTOR_SET_TRACE_ITER("upper_bound", iter);
+
+        auto resIter =
+            emplace_at(
+                iter, relocate_by_memmove(), std::forward<ValType>(value));
+
+        return std::make_pair(resIter, true);
+    }
+
     /**
      * Insert value at position (ordered vector).
      *
@@ -412,7 +685,10 @@ private:
             if ( (pos == values.begin() || comp(*std::prev(pos), value))
                  && (pos == values.end() || comp(value, *pos)))
             {
-                auto result = values.insert(pos, std::forward<ValType>(value));
+                auto result =
+                    emplace_at(
+                        pos, relocate_by_memmove(),
+                        std::forward<ValType>(value));
 
                 _VECTOR_SET_TRACE_ITER("insert-at-position", result);
 
@@ -464,10 +740,112 @@ private:
         return result;
     }
 
+    /**
+     * Insert value at position (ordered vector with duplicates).
+     *
+     * The position is used, if the value belongs there and follows
+     * all equal values. Otherwise the value is inserted at the upper
+     * bound.
+     *
+     * @param pos Position (hint).
+     * @param value Value to add.
+     *
+     * @return Iterator to added value.
+     */
+    template<class ValType>
+    iterator
+    impl_insert_ordered(const_iterator pos, ValType&& value) {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_insert_ordered(const_iterator,ValType&&)");
+
+        _VECTOR_SET_TRACE_ITER("start", pos);
+
+        if ( (pos == values.begin() || !comp(value, *std::prev(pos)))
+             && (pos == values.end() || comp(value, *pos)))
+        {
+            auto result =
+                emplace_at(
+                    pos, relocate_by_memmove(), std::forward<ValType>(value));
+
+            _VECTOR_SET_TRACE_ITER("insert-at-position", result);
+
+            return result;
+        }
+
+        return impl_insert_ordered(std::forward<ValType>(value)).first;
+    }
+
+
+    /// Elements are relocated by `memmove()` (contiguous storage only).
+    using relocate_by_memmove =
+        std::integral_constant<
+            bool,
+            vectorset_is_trivially_relocatable<Key>::value
+            && std::is_same<Container, std::vector<Key, Allocator>>::value
+            && !std::is_same<Key, bool>::value>;
+
+
+    /**
+     * Rotate value at `last` to `first` (by `memmove()`).
+     *
+     * @param first Target position of the value.
+     * @param last Position of the value.
+     */
+    static void
+    relocate_backward(iterator first, iterator last, std::true_type) {
+        alignas(Key) unsigned char tmp[sizeof(Key)];
+
+        std::memcpy(
+            tmp, static_cast<void*>(std::addressof(*last)), sizeof(Key));
+        std::memmove(
+            static_cast<void*>(std::addressof(*std::next(first))),
+            static_cast<void*>(std::addressof(*first)),
+            std::distance(first, last) * sizeof(Key));
+        std::memcpy(
+            static_cast<void*>(std::addressof(*first)), tmp, sizeof(Key));
+    }
+
+    /**
+     * Rotate value at `last` to `first` (by move assignment).
+     *
+     * @param first Target position of the value.
+     * @param last Position of the value.
+     */
+    static void
+    relocate_backward(iterator first, iterator last, std::false_type) {
+        Key tmp(std::move(*last));
+
+        std::move_backward(first, last, std::next(last));
+        *first = std::move(tmp);
+    }
+
+    /**
+     * Rotate value at `first` to `last` (by `memmove()`).
+     *
+     * @param first Position of the value.
+     * @param last Target position of the value.
+     */
+    static void
+    relocate_forward(iterator first, iterator last, std::true_type) {
+        alignas(Key) unsigned char tmp[sizeof(Key)];
+
+        std::memcpy(
+            tmp, static_cast<void*>(std::addressof(*first)), sizeof(Key));
+        std::memmove(
+            static_cast<void*>(std::addressof(*first)),
+            static_cast<void*>(std::addressof(*std::next(first))),
+            std::distance(first, last) * sizeof(Key));
+        std::memcpy(
+            static_cast<void*>(std::addressof(*last)), tmp, sizeof(Key));
+    }
+
 
     /**
      * Move value from end into position.
      *
+     * The elements in between are shifted by one position, by
+     * `memmove()` for trivially relocatable keys.
+     *
      * Expects val_iter > pos.
      *
      * @param val_iter Position of value.
@@ -478,12 +856,81 @@ private:
         _VECTOR_SET_TRACE_SET_NAME("move_into_position");
         _VECTOR_SET_TRACE_ITER_RANGE("start", val_iter, pos);
 
-        while (val_iter != pos) {
-            _VECTOR_SET_TRACE_ITER_PAIR("swap", prev(val_iter), val_iter);
+        auto first =
+            std::next(values.begin(), std::distance(values.cbegin(), pos));
+
+        if (first == val_iter) {
+            return;
+        }
+
+        _VECTOR_SET_TRACE_INT(
+            (relocate_by_memmove::value ? "relocate" : "shift"),
+            std::distance(first, val_iter));
+
+        relocate_backward(first, val_iter, relocate_by_memmove());
+    }
+
+
+    /**
+     * Construct value at position (shift by relocation).
+     *
+     * @param pos Position to construct value.
+     * @param args Constructor arguments.
+     *
+     * @return Iterator to constructed value.
+     */
+    template<class... Args>
+    iterator
+    emplace_at(const_iterator pos, std::true_type, Args&&... args) {
+        auto distance = std::distance(values.cbegin(), pos);
+
+        values.emplace_back(std::forward<Args>(args)...);
+
+        auto first = std::next(values.begin(), distance);
+        auto last = std::prev(values.end());
 
-            std::swap(*prev(val_iter), *val_iter);
-            --val_iter;
+        if (first != last) {
+            relocate_backward(first, last, std::true_type());
         }
+
+        return first;
+    }
+
+    /**
+     * Construct value at position (shift by container).
+     *
+     * @param pos Position to construct value.
+     * @param args Constructor arguments.
+     *
+     * @return Iterator to constructed value.
+     */
+    template<class... Args>
+    iterator
+    emplace_at(const_iterator pos, std::false_type, Args&&... args) {
+        return values.emplace(pos, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Erase value at position (shift by relocation).
+     *
+     * The value is relocated to the end and removed by `pop_back()`.
+     *
+     * @param pos Position of value to erase.
+     */
+    void
+    erase_at(iterator pos, std::true_type) {
+        relocate_forward(pos, std::prev(values.end()), std::true_type());
+        values.pop_back();
+    }
+
+    /**
+     * Erase value at position (shift by container).
+     *
+     * @param pos Position of value to erase.
+     */
+    void
+    erase_at(iterator pos, std::false_type) {
+        values.erase(pos);
     }
 
 
@@ -588,6 +1035,81 @@ private:
         return std::make_pair(std::prev(values.end()), true);
     }
 
+    /**
+     * Emplace new value (ordered with duplicates).
+     *
+     * The value is constructed at the end and moved behind all equal
+     * values.
+     *
+     * @param args Constructor arguments.
+     *
+     * @return result pair: iterator to inserted value and `true`.
+     */
+    template<class... Args>
+    std::pair<iterator, bool>
+    impl_emplace_ordered(Args&&... args) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_emplace_ordered(Args&&...)");
+        _VECTOR_SET_TRACE("start");
+
+        values.emplace_back(std::forward<Args>(args)...);
+
+        auto last = std::prev(values.end());
+        auto iter = std::upper_bound(values.begin(), last, *last, comp);
+
+        _VECTOR_SET_TRACE_ITER("upper_bound", iter);
+
+        move_into_position(last, iter);
+
+        return std::make_pair(iter, true);
+    }
+
+    /**
+     * Emplace new value (ordered with duplicates, with hint).
+     *
+     * The hint is used, if the value belongs there and follows all
+     * equal values. Otherwise the value is moved behind all equal
+     * values (upper bound).
+     *
+     * @param hint Position in front of which the element should be
+     *             created.
+     * @param args Constructor arguments.
+     *
+     * @return Iterator to emplaced value.
+     */
+    template<class... Args>
+    iterator
+    impl_emplace_ordered(const_iterator hint, Args&&... args) {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_emplace_ordered(const_iterator,Args&&...)");
+
+        _VECTOR_SET_TRACE_ITER("start", hint);
+
+        auto hintDistance = std::distance(values.cbegin(), hint);
+
+        values.emplace_back(std::forward<Args>(args)...);
+
+        auto valIter = std::prev(values.end());
+        auto hintIter = std::next(values.begin(), hintDistance);
+
+        if ( (hintIter == values.begin()
+              || !comp(*valIter, *std::prev(hintIter)))
+             && (hintIter == valIter || comp(*valIter, *hintIter)))
+        {
+            _VECTOR_SET_TRACE_ITER("hint-on-spot", hintIter);
+
+            move_into_position(valIter, hintIter);
+            return hintIter;
+        }
+
+        auto iter = std::upper_bound(values.begin(), valIter, *valIter, comp);
+
+        _VECTOR_SET_TRACE_ITER("upper_bound", iter);
+
+        move_into_position(valIter, iter);
+
+        return iter;
+    }
+
 
     /**
      * Emplace new value (ordered, with hint).
@@ -695,13 +1217,13 @@ private:
         _VECTOR_SET_TRACE("start");
 
         auto iter =
-            std::lower_bound(values.begin(), values.end(), key, comp);
+            impl_lower_bound(values.begin(), values.end(), key, comp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
         if (iter != values.end() && !comp(key, *iter)) {
             _VECTOR_SET_TRACE("found-erase:1");
-            values.erase(iter);
+            erase_at(iter, relocate_by_memmove());
             return 1;
         }
         else {
@@ -713,22 +1235,46 @@ private:
     }
 
     /**
-     * Erase on unordered vector (remove all key values).
+     * Erase on ordered vector with duplicates (remove all key values).
      *
      * @param key Key value(s) to remove.
      *
      * @return number of values removed.
      */
     size_type
-    impl_erase_unordered(const Key& key) {
-        _VECTOR_SET_TRACE_SET_NAME("impl_erase_unordered(const Key&)");
+    impl_erase_ordered(const Key& key) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_erase_ordered(const Key&)");
         _VECTOR_SET_TRACE("start");
 
-        auto rmIter =
-            std::remove_if(
-                values.begin(), values.end(),
-                [&key, this] (const Key &val){
-                    return this->comp_eq(key, val);
+        auto first =
+            impl_lower_bound(values.begin(), values.end(), key, comp);
+        auto last = std::upper_bound(first, values.end(), key, comp);
+        auto rmSize = std::distance(first, last);
+
+        _VECTOR_SET_TRACE_INT("rmSize", rmSize);
+
+        values.erase(first, last);
+
+        return rmSize;
+    }
+
+    /**
+     * Erase on unordered vector (remove all key values).
+     *
+     * @param key Key value(s) to remove.
+     *
+     * @return number of values removed.
+     */
+    size_type
+    impl_erase_unordered(const Key& key) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_erase_unordered(const Key&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto rmIter =
+            std::remove_if(
+                values.begin(), values.end(),
+                [&key, this] (const Key &val){
+                    return this->comp_eq(key, val);
                 });
 
         auto rmSize = std::distance(rmIter, values.end());
@@ -751,7 +1297,7 @@ private:
             "impl_find_unique_ordered(const_reference)");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), key, comp);
+        auto iter = impl_lower_bound(values.begin(), values.end(), key, comp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -767,7 +1313,7 @@ private:
             "impl_find_unique_ordered(const_reference)const");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), key, comp);
+        auto iter = impl_lower_bound(values.begin(), values.end(), key, comp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -783,7 +1329,7 @@ private:
         _VECTOR_SET_TRACE_SET_NAME("impl_find_unique_ordered(const K&)");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), x);
+        auto iter = impl_lower_bound(values.begin(), values.end(), x, x_less());
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -800,7 +1346,7 @@ private:
         _VECTOR_SET_TRACE_SET_NAME("impl_find_unique_ordered(const K&)const");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), x);
+        auto iter = impl_lower_bound(values.begin(), values.end(), x, x_less());
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -899,7 +1445,7 @@ private:
             "impl_count_unique_ordered(const_reference)const");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), key, comp);
+        auto iter = impl_lower_bound(values.begin(), values.end(), key, comp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -916,7 +1462,7 @@ private:
             "impl_count_unique_ordered(const K&)const");
         _VECTOR_SET_TRACE("start");
 
-        auto iter = std::lower_bound(values.begin(), values.end(), x);
+        auto iter = impl_lower_bound(values.begin(), values.end(), x, x_less());
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -958,7 +1504,24 @@ private:
     }
 
     /**
-     * Equal range for unique ordered mode.
+     * Count key in ordered container with duplicates.
+     */
+    template<class Value, class AlgoComp>
+    size_type
+    impl_count_ordered(const Value& value, AlgoComp algoComp) const {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_count_ordered(const Value&,AlgoComp)const");
+        _VECTOR_SET_TRACE("start");
+
+        auto first =
+            impl_lower_bound(values.begin(), values.end(), value, algoComp);
+
+        return std::distance(
+            first, std::upper_bound(first, values.end(), value, algoComp));
+    }
+
+    /**
+     * Equal range for ordered modes.
      */
     template<class Value, class AlgoComp>
     std::pair<iterator,iterator>
@@ -967,7 +1530,7 @@ private:
         _VECTOR_SET_TRACE_SET_NAME("impl_equal_range(const Value&, AlgoComp)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unordered) {
+        if (mode() == vectorset_mode::unordered) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "equal_range is only available in"
@@ -975,7 +1538,7 @@ private:
         }
 
         auto iter =
-            std::lower_bound(values.begin(), values.end(), value, algoComp);
+            impl_lower_bound(values.begin(), values.end(), value, algoComp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -989,6 +1552,14 @@ private:
             return std::make_pair(iter, iter);
         }
 
+        if (mode() == vectorset_mode::ordered) {
+            auto last = std::upper_bound(iter, values.end(), value, algoComp);
+
+            _VECTOR_SET_TRACE_ITER_RANGE("range", iter, last);
+
+            return std::make_pair(iter, last);
+        }
+
         _VECTOR_SET_TRACE_ITER_RANGE("range", iter, std::next(iter));
 
         return std::make_pair(iter, std::next(iter));
@@ -996,7 +1567,7 @@ private:
 
 
     /**
-     * Equal range for unique ordered mode (const).
+     * Equal range for ordered modes (const).
      */
     template<class Value, class AlgoComp>
     std::pair<const_iterator,const_iterator>
@@ -1006,7 +1577,7 @@ private:
             "impl_equal_range(const Value&, AlgoComp)const");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unordered) {
+        if (mode() == vectorset_mode::unordered) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "equal_range is only available in"
@@ -1014,7 +1585,7 @@ private:
         }
 
         auto iter =
-            std::lower_bound(values.begin(), values.end(), value, algoComp);
+            impl_lower_bound(values.begin(), values.end(), value, algoComp);
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
 
@@ -1028,9 +1599,17 @@ private:
             return std::make_pair(iter, iter);
         }
 
+        if (mode() == vectorset_mode::ordered) {
+            auto last = std::upper_bound(iter, values.end(), value, algoComp);
+
+            _VECTOR_SET_TRACE_ITER_RANGE("range", iter, last);
+
+            return std::make_pair(iter, last);
+        }
+
         _VECTOR_SET_TRACE_ITER_RANGE("range", iter, std::next(iter));
 
-        return std::make_pair(iter, next(iter));
+        return std::make_pair(iter, std::next(iter));
     }
 
 
@@ -1042,7 +1621,7 @@ private:
             "impl_bound_fn(const Value&,bool,AlgoComp)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unordered) {
+        if (mode() == vectorset_mode::unordered) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "lower_bound and upper_bound are only available"
@@ -1051,7 +1630,7 @@ private:
 
         auto iter =
             (lowerBound
-             ? std::lower_bound(values.begin(), values.end(), value, algoComp)
+             ? impl_lower_bound(values.begin(), values.end(), value, algoComp)
              : std::upper_bound(values.begin(), values.end(), value, algoComp));
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
@@ -1068,7 +1647,7 @@ private:
             "impl_bound_fn(const Value&,bool,AlgoComp)const");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unordered) {
+        if (mode() == vectorset_mode::unordered) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "lower_bound and upper_bound are only available"
@@ -1077,7 +1656,7 @@ private:
 
         auto iter =
             (lowerBound
-             ? std::lower_bound(values.begin(), values.end(), value, algoComp)
+             ? impl_lower_bound(values.begin(), values.end(), value, algoComp)
              : std::upper_bound(values.begin(), values.end(), value, algoComp));
 
         _VECTOR_SET_TRACE_ITER("iter", iter);
@@ -1094,9 +1673,11 @@ private:
         _VECTOR_SET_TRACE_SET_NAME("make_unique_ordered()");
         _VECTOR_SET_TRACE("start");
 
-        std::sort(values.begin(), values.end(), comp);
+        if (mode() != vectorset_mode::ordered) {
+            std::sort(values.begin(), values.end(), comp);
+        }
         auto rmIter =
-            unique(
+            std::unique(
                 values.begin(), values.end(),
                 [this](const Key &lhv, const Key &rhv) {
                     return this->comp_eq(lhv, rhv);
@@ -1107,6 +1688,531 @@ private:
         values.erase(rmIter, values.end());
     }
 
+    /**
+     * Sort vector and keep duplicates (stable).
+     */
+    void
+    make_ordered() {
+        _VECTOR_SET_TRACE_SET_NAME("make_ordered()");
+        _VECTOR_SET_TRACE("start");
+
+        std::stable_sort(values.begin(), values.end(), comp);
+    }
+
+
+    /**
+     * Search upper bound backwards from `last` (galloping).
+     *
+     * The distance to `last` is probed in steps 1, 2, 4, ... before
+     * the binary search. The costs are logarithmic in the distance of
+     * the result to `last`.
+     *
+     * @param first Begin of sorted range.
+     * @param last End of sorted range.
+     * @param value Value to search for.
+     *
+     * @return Iterator to first element in [first, last) greater than
+     *         `value`.
+     */
+    iterator
+    gallop_upper_bound_back(iterator first, iterator last, const Key& value) {
+        difference_type step = 1;
+        auto lower = first;
+        auto upper = last;
+
+        while (std::distance(first, upper) > step) {
+            auto probe = std::prev(upper, step);
+
+            if (!comp(value, *probe)) {
+                lower = std::next(probe);
+                break;
+            }
+
+            upper = probe;
+            step *= 2;
+        }
+
+        return std::upper_bound(lower, upper, value, comp);
+    }
+
+
+    /**
+     * Insert range into unique ordered container.
+     *
+     * Only the new elements are sorted. They are merged into the
+     * existing elements by `merge_tail_unique_ordered()`, so few new
+     * elements cost O(m log(n/m)) comparisons and O(n + m) moves.
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     * @param scratch Allocator of the temporary merge buffer.
+     */
+    template<class InputIt, class ScratchAlloc>
+    void
+    impl_insert_range_unique_ordered(
+        InputIt first, InputIt last, const ScratchAlloc& scratch)
+    {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_insert_range_unique_ordered(InputIt,InputIt)");
+        _VECTOR_SET_TRACE("start");
+
+        auto oldSize = values.size();
+
+        values.insert(values.end(), first, last);
+
+        auto mid = std::next(values.begin(), oldSize);
+
+        // sort and remove duplicates of the new elements.
+        std::sort(mid, values.end(), comp);
+        auto rmIter =
+            std::unique(
+                mid, values.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return this->comp_eq(lhv, rhv);
+                });
+
+        // remove elements already in the container.
+        rmIter =
+            std::remove_if(
+                mid, rmIter,
+                [this, mid](const Key &value) {
+                    return std::binary_search(
+                        this->values.begin(), mid, value, this->comp);
+                });
+
+        values.erase(rmIter, values.end());
+
+        _VECTOR_SET_TRACE_INT("new", values.size() - oldSize);
+
+        merge_tail_unique_ordered(oldSize, scratch);
+    }
+
+    /// Insert range into unique ordered container (see above).
+    template<class InputIt>
+    void
+    impl_insert_range_unique_ordered(InputIt first, InputIt last) {
+        impl_insert_range_unique_ordered(first, last, values.get_allocator());
+    }
+
+    /**
+     * Insert range into ordered container with duplicates.
+     *
+     * The new elements are sorted (stable) and merged behind equal
+     * existing elements by `merge_tail_unique_ordered()`.
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     * @param scratch Allocator of the temporary merge buffer.
+     */
+    template<class InputIt, class ScratchAlloc>
+    void
+    impl_insert_range_ordered(
+        InputIt first, InputIt last, const ScratchAlloc& scratch)
+    {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_insert_range_ordered(InputIt,InputIt)");
+        _VECTOR_SET_TRACE("start");
+
+        auto oldSize = values.size();
+
+        values.insert(values.end(), first, last);
+        std::stable_sort(
+            std::next(values.begin(), oldSize), values.end(), comp);
+
+        _VECTOR_SET_TRACE_INT("new", values.size() - oldSize);
+
+        merge_tail_unique_ordered(oldSize, scratch);
+    }
+
+    /**
+     * Merge the sorted tail of the vector into the sorted head.
+     *
+     * The new elements of the tail are sorted (in mode
+     * `vectorset_mode::unique_ordered` also unique and not contained
+     * in the head). They are merged backwards after a single growth
+     * of the vector, the position of each new element is searched by
+     * galloping from the end. New elements are placed behind equal
+     * elements of the head.
+     *
+     * @param oldSize Size of the sorted head.
+     * @param scratch Allocator of the temporary buffer of the tail.
+     */
+    template<class ScratchAlloc>
+    void
+    merge_tail_unique_ordered(size_type oldSize, const ScratchAlloc& scratch) {
+        auto newSize = values.size() - oldSize;
+
+        if (newSize == 0 || oldSize == 0) {
+            return;
+        }
+
+        std::vector<Key, ScratchAlloc> newValues(
+            std::make_move_iterator(std::next(values.begin(), oldSize)),
+            std::make_move_iterator(values.end()),
+            scratch);
+
+        // backward merge
+        auto oldEnd = std::next(values.begin(), oldSize);
+
+        for (auto idx = newSize; idx > 0 ; --idx) {
+            auto &value = newValues[idx - 1];
+            auto pos = gallop_upper_bound_back(values.begin(), oldEnd, value);
+
+            std::move_backward(pos, oldEnd, std::next(oldEnd, idx));
+            *std::next(pos, idx - 1) = std::move(value);
+
+            oldEnd = pos;
+        }
+    }
+
+    /// Merge tail (see above), temporary buffer uses the allocator.
+    void
+    merge_tail_unique_ordered(size_type oldSize) {
+        merge_tail_unique_ordered(oldSize, values.get_allocator());
+    }
+
+    /**
+     * Move the elements of `source` into this container.
+     *
+     * See `merge(vectorset&)`.
+     *
+     * @param source Container to move the elements from.
+     * @param scratch Allocator of the temporary merge buffer.
+     */
+    template<class ScratchAlloc>
+    void
+    impl_merge(vectorset& source, const ScratchAlloc& scratch) {
+        _VECTOR_SET_TRACE_SET_NAME("merge(vectorset&)");
+        _VECTOR_SET_TRACE("start");
+
+        if (&source == this) {
+            return;
+        }
+
+        if (mode() == vectorset_mode::ordered) {
+            _VECTOR_SET_TRACE_INT("merge-all", source.values.size());
+
+            auto oldSize = values.size();
+
+            values.insert(
+                values.end(),
+                std::make_move_iterator(source.values.begin()),
+                std::make_move_iterator(source.values.end()));
+            source.values.clear();
+
+            if (source.mode() == vectorset_mode::unordered) {
+                std::stable_sort(
+                    std::next(values.begin(), oldSize), values.end(), comp);
+            }
+
+            merge_tail_unique_ordered(oldSize, scratch);
+            return;
+        }
+
+        if (mode() != vectorset_mode::unique_ordered) {
+            _VECTOR_SET_TRACE_INT("append", source.values.size());
+
+            values.insert(
+                values.end(),
+                std::make_move_iterator(source.values.begin()),
+                std::make_move_iterator(source.values.end()));
+            source.values.clear();
+            return;
+        }
+
+        if (source.mode() == vectorset_mode::unordered) {
+            _VECTOR_SET_TRACE("sort-source");
+            std::sort(source.values.begin(), source.values.end(), comp);
+        }
+
+        // move new elements to the tail, keep duplicates in source.
+        size_type oldSize = values.size();
+        size_type idx = 0;
+        auto write = source.values.begin();
+
+        for (auto read = write; read != source.values.end(); ++read) {
+            while (idx < oldSize && comp(values[idx], *read)) {
+                ++idx;
+            }
+
+            if ((idx < oldSize && !comp(*read, values[idx]))
+                || (values.size() > oldSize && !comp(values.back(), *read)))
+            {
+                if (write != read) {
+                    *write = std::move(*read);
+                }
+                ++write;
+            }
+            else {
+                values.push_back(std::move(*read));
+            }
+        }
+
+        source.values.erase(write, source.values.end());
+
+        _VECTOR_SET_TRACE_INT("new", values.size() - oldSize);
+        _VECTOR_SET_TRACE_INT("remain", source.values.size());
+
+        merge_tail_unique_ordered(oldSize, scratch);
+    }
+
+    /**
+     * Erase elements by many keys.
+     *
+     * See `erase_many(InputIt,InputIt)`.
+     *
+     * @param first Iterator to first key to remove.
+     * @param last Iterator _after_ last key to remove.
+     * @param scratch Allocator of the temporary copy of the keys.
+     *
+     * @return Number of elements removed.
+     */
+    template<class InputIt, class ScratchAlloc>
+    size_type
+    impl_erase_many(InputIt first, InputIt last, const ScratchAlloc& scratch) {
+        _VECTOR_SET_TRACE_SET_NAME("erase_many(InputIt,InputIt)");
+        _VECTOR_SET_TRACE("start");
+
+        std::vector<Key, ScratchAlloc> keys(first, last, scratch);
+
+        if (!std::is_sorted(keys.begin(), keys.end(), comp)) {
+            _VECTOR_SET_TRACE("sort-keys");
+            std::sort(keys.begin(), keys.end(), comp);
+        }
+
+        keys.erase(
+            std::unique(
+                keys.begin(), keys.end(),
+                [this](const Key &lhv, const Key &rhv) {
+                    return this->comp_eq(lhv, rhv);
+                }),
+            keys.end());
+
+        _VECTOR_SET_TRACE_INT("keys", keys.size());
+
+        if (keys.empty() || values.empty()) {
+            return 0;
+        }
+
+        return (sorted_mode()
+                ? impl_erase_many_unique_ordered(keys)
+                : impl_erase_many_unordered(keys));
+    }
+
+
+    /**
+     * Erase many keys on ordered vector (both ordered modes).
+     *
+     * The elements are compacted in a single pass: Each key is
+     * searched by galloping from the position of the previous key
+     * and the elements between two matches are moved only once.
+     *
+     * @param keys Sorted key values without duplicates.
+     *
+     * @return number of values removed.
+     */
+    template<class KeyVector>
+    size_type
+    impl_erase_many_unique_ordered(const KeyVector& keys) {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_erase_many_unique_ordered(const vector_type&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto read = values.begin();
+        auto write = values.begin();
+        auto search = values.begin();
+
+        for (const auto &key : keys) {
+            auto pos =
+                _vectorset_gallop_lower_bound(
+                    search, values.end(), key, comp);
+
+            if (pos == values.end()) {
+                break;
+            }
+
+            search = pos;
+
+            if (comp(key, *pos)) {
+                continue;
+            }
+
+            // skip equal elements (only vectorset_mode::ordered)
+            auto next = std::next(pos);
+
+            while (next != values.end() && !comp(key, *next)) {
+                ++next;
+            }
+
+            write = (write == read ? pos : std::move(read, pos, write));
+            read = search = next;
+        }
+
+        write = (write == read ? values.end()
+                 : std::move(read, values.end(), write));
+
+        auto rmSize = std::distance(write, values.end());
+
+        _VECTOR_SET_TRACE_INT("rmSize", rmSize);
+
+        values.erase(write, values.end());
+
+        return rmSize;
+    }
+
+    /**
+     * Search lower bound in `[first, last)`.
+     *
+     * Small containers are searched linearly (see
+     * `vectorset_linear_search_limit`).
+     */
+    template<class It, class T, class Less>
+    static It
+    impl_lower_bound(It first, It last, const T& value, Less less) {
+        return _vectorset_lower_bound<
+            vectorset_linear_search_limit<Container>::value>(
+                first, last, value, less);
+    }
+
+    /**
+     * Erase many keys on unordered vector (remove all key values).
+     *
+     * @param keys Sorted key values without duplicates.
+     *
+     * @return number of values removed.
+     */
+    template<class KeyVector>
+    size_type
+    impl_erase_many_unordered(const KeyVector& keys) {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "impl_erase_many_unordered(const vector_type&)");
+        _VECTOR_SET_TRACE("start");
+
+        auto rmIter =
+            std::remove_if(
+                values.begin(), values.end(),
+                [&keys, this] (const Key &val){
+                    return std::binary_search(
+                        keys.begin(), keys.end(), val, this->comp);
+                });
+
+        auto rmSize = std::distance(rmIter, values.end());
+
+        _VECTOR_SET_TRACE_INT("rmSize", rmSize);
+
+        values.erase(rmIter, values.end());
+
+        return rmSize;
+    }
+
+
+    /// Less operator for alternative values (compare to keys).
+    struct x_less {
+        template<class L, class R>
+        bool
+        operator()(const L& lhv, const R& rhv) const {
+            return (lhv < rhv);
+        }
+    };
+
+
+    /**
+     * Search position to emplace a value equal to `x`.
+     *
+     * @param x Value to search for.
+     * @param less Compare function of `x` and keys.
+     *
+     * @return Pair of position and flag: `true`, if `x` is not
+     *         contained and has to be emplaced at position. `false`,
+     *         if position is the existing element.
+     */
+    template<class K, class Less>
+    std::pair<iterator, bool>
+    impl_emplace_position(const K& x, Less less) {
+        _VECTOR_SET_TRACE_SET_NAME("impl_emplace_position(const K&,Less)");
+        _VECTOR_SET_TRACE("start");
+
+        if (sorted_mode()) {
+            auto iter =
+                impl_lower_bound(values.begin(), values.end(), x, less);
+
+            _VECTOR_SET_TRACE_ITER("lower_bound", iter);
+
+            if (iter != values.end() && !less(x, *iter)) {
+                _VECTOR_SET_TRACE("found-no-emplace");
+                return std::make_pair(iter, false);
+            }
+
+            return std::make_pair(iter, true);
+        }
+
+        auto iter =
+            std::find_if(
+                values.begin(), values.end(),
+                [&x, &less](const Key &value) {
+                    return !(less(x, value) || less(value, x));
+                });
+
+        _VECTOR_SET_TRACE_ITER("find", iter);
+
+        if (iter != values.end()) {
+            _VECTOR_SET_TRACE("found-no-emplace");
+            return std::make_pair(iter, false);
+        }
+
+        return std::make_pair(iter, true);
+    }
+
+    /// Emplace element at position (constructor arguments given).
+    template<class K, class... Args>
+    iterator
+    impl_try_emplace_at(
+        iterator pos, const K& x, std::false_type, Args&&... args)
+    {
+        (void)x;
+        return emplace_at(
+            pos, relocate_by_memmove(), std::forward<Args>(args)...);
+    }
+
+    /// Emplace element at position (no arguments: construct from `x`).
+    template<class K>
+    iterator
+    impl_try_emplace_at(iterator pos, const K& x, std::true_type) {
+        return emplace_at(pos, relocate_by_memmove(), x);
+    }
+
+    /**
+     * Emplace value only if `x` is not contained.
+     *
+     * Without constructor arguments, the element is constructed
+     * from `x`.
+     *
+     * @param x Value to search for.
+     * @param less Compare function of `x` and keys.
+     * @param args Constructor arguments.
+     *
+     * @return result pair: iterator to emplaced or existing value and
+     *         flag, if value has been emplaced.
+     */
+    template<class K, class Less, class... Args>
+    std::pair<iterator, bool>
+    impl_try_emplace(const K& x, Less less, Args&&... args) {
+        auto pos = impl_emplace_position(x, less);
+
+        if (pos.second) {
+            pos.first =
+                impl_try_emplace_at(
+                    pos.first, x,
+                    std::integral_constant<bool, sizeof...(Args) == 0>(),
+                    std::forward<Args>(args)...);
+
+            _VECTOR_SET_ASSERT(
+                !less(x, *pos.first) && !less(*pos.first, x));
+        }
+
+        return pos;
+    }
+
 public:
 
     /// @name Constructors
@@ -1207,14 +2313,31 @@ public:
      *              the elements of the container with.
      */
     vectorset(const vectorset& other)
-        : vectorset()
+        : values(other.values), comp(other.comp)
     {
         _VECTOR_SET_TRACE_SET_NAME(
             "vectorset(const vectorset& other)");
         _VECTOR_SET_TRACE("construct");
 
-        values = other.values;
-        op_mode = other.op_mode;
+        store_mode(other.mode());
+    };
+
+    /**
+     * Copy constructor with allocator.
+     *
+     * @param other Another container to be used as source to initialize
+     *              the elements of the container with.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    vectorset(const vectorset& other, const Allocator& alloc)
+        : values(other.values, alloc), comp(other.comp)
+    {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "vectorset(const vectorset& other, const Allocator& alloc)");
+        _VECTOR_SET_TRACE("construct");
+
+        store_mode(other.mode());
     };
 
     /**
@@ -1224,27 +2347,29 @@ public:
      *              the elements of the container with.
      */
     vectorset(vectorset&& other)
-        : vectorset()
+        : values(std::move(other.values)), comp(other.comp)
     {
         _VECTOR_SET_TRACE_SET_NAME("vectorset(vectorset&& other)");
         _VECTOR_SET_TRACE("construct");
 
-        values = std::move(other.values);
-        op_mode = other.op_mode;
-        other.op_mode = vectorset_mode::unordered;
+        store_mode(other.mode());
+        other.store_mode(vectorset_mode::unordered);
     }
 
 
     /**
      * Move constructor with allocator.
      *
+     * If `alloc` differs from the allocator of `other`, the elements
+     * are moved one by one into memory of `alloc`.
+     *
      * @param other Another container to be used as source to initialize
      *              the elements of the container with.
      * @param alloc Allocator to use for all memory allocations
      *              of this container.
      */
     vectorset(vectorset&& other, const Allocator& alloc)
-        : vectorset(alloc)
+        : vectorset(other.comp, alloc)
     {
         _VECTOR_SET_TRACE_SET_NAME("vectorset(vectorset&& other)");
         _VECTOR_SET_TRACE("construct");
@@ -1257,7 +2382,7 @@ public:
         _VECTOR_SET_TRACE("move-values");
 
         values = std::move(other.values);
-        op_mode = other.op_mode;
+        store_mode(other.mode());
     }
 
     /**
@@ -1294,9 +2419,68 @@ public:
         : vectorset(init, Compare(), alloc)
     {
         _VECTOR_SET_TRACE_SET_NAME(
-            "vectorset(std::initializer_list<value_type> init,"
-            " const Allocator& alloc )");
+            "vectorset(std::initializer_list<value_type> init,"
+            " const Allocator& alloc )");
+        _VECTOR_SET_TRACE("construct");
+    }
+
+    /**
+     * Construct unique ordered container from sorted unique values.
+     *
+     * The values are taken over without sorting, e.g. the result of
+     * a set operation. They have to be sorted by `comp` and must not
+     * contain duplicates.
+     *
+     * @param tag `vectorset_sorted_unique`.
+     * @param sorted Sorted unique values to move into the container.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     */
+    vectorset(
+        vectorset_sorted_unique_t tag,
+        vector_type&& sorted,
+        const Compare& comp = Compare())
+        : values(std::move(sorted)), comp(comp)
+    {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "vectorset(vectorset_sorted_unique_t,vector_type&&,"
+            "const Compare&)");
+        _VECTOR_SET_TRACE("construct");
+
+        (void)tag;
+        store_mode(vectorset_mode::unique_ordered);
+
+        _VECTOR_SET_ASSERT(is_sorted_unique());
+    }
+
+    /**
+     * Construct unique ordered container from sorted unique range.
+     *
+     * @param tag `vectorset_sorted_unique`.
+     * @param first Iterator to first sorted unique value.
+     * @param last Iterator _after_ last sorted unique value.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    template<class InputIt>
+    vectorset(
+        vectorset_sorted_unique_t tag,
+        InputIt first, InputIt last,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : values(first, last, alloc), comp(comp)
+    {
+        _VECTOR_SET_TRACE_SET_NAME(
+            "vectorset(vectorset_sorted_unique_t,InputIt,InputIt,"
+            "const Compare&,const Allocator&)");
         _VECTOR_SET_TRACE("construct");
+
+        (void)tag;
+        store_mode(vectorset_mode::unique_ordered);
+
+        _VECTOR_SET_ASSERT(is_sorted_unique());
     }
 
     /// @}
@@ -1330,22 +2514,37 @@ public:
     /**
      * Set mode of container.
      *
-     * @param op_mode New operation mode: `vectorset_mode::unordered` or
-     *             `  vectorset_mode::unique_ordered`.
+     * * `vectorset_mode::unique_ordered` sorts the values and removes
+     *   duplicates.
+     * * `vectorset_mode::ordered` sorts the values (stable) and keeps
+     *   duplicates.
+     * * `vectorset_mode::unordered` keeps the order of the values.
+     *
+     * @param op_mode New operation mode.
      */
     void
     set_mode(vectorset_mode op_mode) {
         _VECTOR_SET_TRACE_SET_NAME("set_mode(vectorset_mode)");
         _VECTOR_SET_TRACE("start");
 
-        if (this->op_mode == op_mode) {
+        if (mode() == op_mode) {
             _VECTOR_SET_TRACE("mode-equal");
             return;
         }
 
         if (op_mode == vectorset_mode::unordered) {
             _VECTOR_SET_TRACE("mode-unordered");
-            this->op_mode = vectorset_mode::unordered;
+            store_mode(vectorset_mode::unordered);
+            return;
+        }
+
+        if (op_mode == vectorset_mode::ordered) {
+            if (mode() == vectorset_mode::unordered) {
+                make_ordered();
+            }
+
+            _VECTOR_SET_TRACE("mode-ordered-multi");
+            store_mode(vectorset_mode::ordered);
             return;
         }
 
@@ -1354,22 +2553,23 @@ public:
         }
 
         _VECTOR_SET_TRACE("mode-ordered");
-        this->op_mode = vectorset_mode::unique_ordered;
+        store_mode(vectorset_mode::unique_ordered);
     }
 
 
     /**
      * Get current mode of container.
      *
-     * @return Mode: `vectorset_mode::unordered` or
-     *         `vectorset_mode::unique_ordered`.
+     * @return Mode: `vectorset_mode::unordered`,
+     *         `vectorset_mode::unique_ordered` or
+     *         `vectorset_mode::ordered`.
      */
     vectorset_mode
     get_mode() const noexcept {
         _VECTOR_SET_TRACE_SET_NAME("get_mode() const noexcept");
         _VECTOR_SET_TRACE("start");
 
-        return op_mode;
+        return mode();
     }
 
     /// @}
@@ -1403,7 +2603,7 @@ public:
         _VECTOR_SET_TRACE("copy-values");
 
         values = other.values;
-        op_mode = other.op_mode;
+        store_mode(other.mode());
 
         return *this;
     }
@@ -1416,12 +2616,21 @@ public:
      * (i.e. the data in other is moved from other into this
      * container).
      *
+     * The move is `noexcept`, if the allocator propagates on move
+     * assignment or all instances of the allocator are equal. Otherwise
+     * (e.g. `std::pmr::polymorphic_allocator`) the elements are moved
+     * one by one, if the allocators differ.
+     *
      * @param other Other instance to move.
      *
      * @return Reference to this class.
      */
     vectorset&
-    operator=(vectorset&& other) noexcept {
+    operator=(vectorset&& other) noexcept(
+        std::allocator_traits<Allocator>::
+            propagate_on_container_move_assignment::value
+        || std::allocator_traits<Allocator>::is_always_equal::value)
+    {
         _VECTOR_SET_TRACE_SET_NAME(
             "operator=(vectorset&& other) noexcept");
         _VECTOR_SET_TRACE("start");
@@ -1433,8 +2642,8 @@ public:
 
         _VECTOR_SET_TRACE("move-values");
 
-        values = move(other.values);
-        op_mode = other.op_mode;
+        values = std::move(other.values);
+        store_mode(other.mode());
 
         return *this;
     }
@@ -1454,11 +2663,22 @@ public:
             "operator=(std::initializer_list<value_type> ilist)");
         _VECTOR_SET_TRACE("start");
 
-        copy(ilist.begin(), ilist.end(), back_inserter(values));
-        if (op_mode == vectorset_mode::unique_ordered) {
-            _VECTOR_SET_TRACE("sort-vector");
-            make_unique_ordered();
+        values.clear();
+
+        if (mode() == vectorset_mode::unique_ordered) {
+            _VECTOR_SET_TRACE(
+                "call:impl_insert_range_unique_ordered(InputIt,InputIt)");
+            impl_insert_range_unique_ordered(ilist.begin(), ilist.end());
+        }
+        else if (mode() == vectorset_mode::ordered) {
+            impl_insert_range_ordered(
+                ilist.begin(), ilist.end(), values.get_allocator());
         }
+        else {
+            values.insert(values.end(), ilist);
+        }
+
+        return *this;
     }
 
     /// @}
@@ -1756,6 +2976,9 @@ public:
      * * Insert the element in sorted container
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   conains the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`), the new
      *   values is always insert at the end (`push_back`).
      *
@@ -1768,8 +2991,10 @@ public:
      */
     std::pair<iterator, bool>
     insert(const value_type& value) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_insert_unique_ordered(value)
+                : mode() == vectorset_mode::ordered
+                ? impl_insert_ordered(value)
                 : impl_insert_unordered(value));
     }
 
@@ -1779,6 +3004,9 @@ public:
      * * Insert the element in sorted container
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   already conains the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`), the new
      *   value is always insert at the end (`push_back`).
      *
@@ -1791,8 +3019,10 @@ public:
      */
     std::pair<iterator, bool>
     insert(value_type&& value) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_insert_unique_ordered(std::move(value))
+                : mode() == vectorset_mode::ordered
+                ? impl_insert_ordered(std::move(value))
                 : impl_insert_unordered(std::move(value)));
     }
 
@@ -1803,6 +3033,9 @@ public:
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   already conains the value. The position is used as a hint
      *   where to insert the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value is inserted before the position.
      *
@@ -1814,8 +3047,10 @@ public:
      */
     iterator
     insert(const_iterator pos, const value_type& value) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_insert_unique_ordered(pos, value)
+                : mode() == vectorset_mode::ordered
+                ? impl_insert_ordered(pos, value)
                 : impl_insert_unordered(pos, value));
     }
 
@@ -1826,6 +3061,9 @@ public:
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   already conains the value. The position is used as a hint
      *   where to insert the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value is inserted before the position.
      *
@@ -1837,8 +3075,10 @@ public:
      */
     iterator
     insert(const_iterator pos, value_type&& value) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_insert_unique_ordered(pos, std::move(value))
+                : mode() == vectorset_mode::ordered
+                ? impl_insert_ordered(pos, std::move(value))
                 : impl_insert_unordered(pos, std::move(value)));
     }
 
@@ -1847,7 +3087,11 @@ public:
      *
      * * Insert the elements in sorted container
      *   (`vectorset_mode::unique_ordered`), if the container does not
-     *   already conains a value.
+     *   already conains a value. Only the new elements are sorted,
+     *   then they are merged into the container.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value appened at the end (`push_back()`).
      *
@@ -1860,19 +3104,61 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("insert(InputIt,InputIt)");
         _VECTOR_SET_TRACE("start");
 
-        values.insert(values.end(), first, last);
-        if (op_mode == vectorset_mode::unique_ordered) {
-            _VECTOR_SET_TRACE("call:make_unique_ordered()");
-            make_unique_ordered();
+        if (mode() == vectorset_mode::unique_ordered) {
+            _VECTOR_SET_TRACE(
+                "call:impl_insert_range_unique_ordered(InputIt,InputIt)");
+            impl_insert_range_unique_ordered(first, last);
+        }
+        else if (mode() == vectorset_mode::ordered) {
+            impl_insert_range_ordered(first, last, values.get_allocator());
+        }
+        else {
+            values.insert(values.end(), first, last);
+        }
+    }
+
+#if __cplusplus >= 201703L // c++17
+    /**
+     * Inserts elements from range [first, last) (scratch memory).
+     *
+     * Like `insert(InputIt,InputIt)`, but the temporary merge buffer
+     * is allocated from `scratch` (e.g. a
+     * `std::pmr::monotonic_buffer_resource` reused for many calls).
+     *
+     * @param first Iterator to first element to insert.
+     * @param last Iterator _after_ last element to insert.
+     * @param scratch Memory resource for temporary memory.
+     */
+    template<class InputIt>
+    void
+    insert(InputIt first, InputIt last, std::pmr::memory_resource *scratch) {
+        _VECTOR_SET_TRACE_SET_NAME("insert(InputIt,InputIt,scratch)");
+        _VECTOR_SET_TRACE("start");
+
+        if (mode() == vectorset_mode::unique_ordered) {
+            impl_insert_range_unique_ordered(
+                first, last, std::pmr::polymorphic_allocator<Key>(scratch));
+        }
+        else if (mode() == vectorset_mode::ordered) {
+            impl_insert_range_ordered(
+                first, last, std::pmr::polymorphic_allocator<Key>(scratch));
+        }
+        else {
+            values.insert(values.end(), first, last);
         }
     }
+#endif
 
     /**
      * Inserts elements from initializer list.
      *
      * * Insert the elements in sorted container
      *   (`vectorset_mode::unique_ordered`), if the container does not
-     *   already conains a value.
+     *   already conains a value. Only the new elements are sorted,
+     *   then they are merged into the container.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value appened at the end (`push_back()`).
      *
@@ -1884,10 +3170,17 @@ public:
             "insert(std::initializer_list<value_type>)");
         _VECTOR_SET_TRACE("start");
 
-        values.insert(values.end(), ilist);
-        if (op_mode == vectorset_mode::unique_ordered) {
-            _VECTOR_SET_TRACE("call:make_unique_ordered()");
-            make_unique_ordered();
+        if (mode() == vectorset_mode::unique_ordered) {
+            _VECTOR_SET_TRACE(
+                "call:impl_insert_range_unique_ordered(InputIt,InputIt)");
+            impl_insert_range_unique_ordered(ilist.begin(), ilist.end());
+        }
+        else if (mode() == vectorset_mode::ordered) {
+            impl_insert_range_ordered(
+                ilist.begin(), ilist.end(), values.get_allocator());
+        }
+        else {
+            values.insert(values.end(), ilist);
         }
     };
 
@@ -1898,6 +3191,9 @@ public:
      * * Create the element in sorted container
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   already conains the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value is created at end.
      *
@@ -1911,8 +3207,10 @@ public:
     template<class... Args>
     std::pair<iterator,bool>
     emplace(Args&&... args) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_emplace_unique_ordered(std::forward<Args>(args)...)
+                : mode() == vectorset_mode::ordered
+                ? impl_emplace_ordered(std::forward<Args>(args)...)
                 : impl_emplace_unordered(std::forward<Args>(args)...));
     }
 
@@ -1923,6 +3221,9 @@ public:
      *   (`vectorset_mode::unique_ordered`), if the container does not
      *   already conains the value. The `hint` is used as a guess
      *   where to insert the value.
+     * * If the container is ordered with duplicates
+     *   (`vectorset_mode::ordered`), the new value is always
+     *   inserted behind equal values.
      * * If the container is unordered (`vectorset_mode::unordered`),
      *   the new value is inserted before the position of `hint`.
      *
@@ -1933,11 +3234,125 @@ public:
     template <class... Args>
     iterator
     emplace_hint(const_iterator hint, Args&&... args) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_emplace_unique_ordered(hint, std::forward<Args>(args)...)
+                : mode() == vectorset_mode::ordered
+                ? impl_emplace_ordered(hint, std::forward<Args>(args)...)
                 : impl_emplace_unordered(hint, std::forward<Args>(args)...));
     }
 
+    /**
+     * Constructs element in-place, if the key is not contained.
+     *
+     * The container is searched for `key` first. The element is only
+     * constructed (at its final position), if no element with `key`
+     * exists. The constructed element has to be equal to `key`;
+     * without `args` it is copied from `key`.
+     *
+     * In contrast to `emplace()`, this method does not insert
+     * duplicates in `vectorset_mode::unordered` (linear search).
+     *
+     * @param key Key value to search for.
+     * @param args Arguments to forward to the constructor of the element.
+     *
+     * @return Returns a pair consisting of an iterator to the new or
+     *         existing element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator,bool>
+    try_emplace(const Key& key, Args&&... args) {
+        _VECTOR_SET_TRACE_SET_NAME("try_emplace(const Key&,Args&&...)");
+        _VECTOR_SET_TRACE("start");
+
+        return impl_try_emplace(key, comp, std::forward<Args>(args)...);
+    }
+
+    /**
+     * Constructs element in-place, if the value is not contained.
+     *
+     * See `try_emplace(const Key&,Args&&...)`.
+     *
+     * @param x A value of any type that can be transparently compared
+     *          with a key (less Operator to Key needed).
+     * @param args Arguments to forward to the constructor of the element.
+     *
+     * @return Returns a pair consisting of an iterator to the new or
+     *         existing element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class K, class... Args>
+    std::pair<iterator,bool>
+    try_emplace(const K& x, Args&&... args) {
+        _VECTOR_SET_TRACE_SET_NAME("try_emplace(const K&,Args&&...)");
+        _VECTOR_SET_TRACE("start");
+
+        return impl_try_emplace(x, x_less(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * Constructs element by factory, if the key is not contained.
+     *
+     * The container is searched for `key` first. `factory()` is only
+     * called, if no element with `key` exists. Its result is moved to
+     * the final position and has to be equal to `key`.
+     *
+     * @param key Key value to search for.
+     * @param factory Function without arguments returning the new
+     *                element.
+     *
+     * @return Returns a pair consisting of an iterator to the new or
+     *         existing element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class Factory>
+    std::pair<iterator,bool>
+    lazy_emplace(const Key& key, Factory factory) {
+        _VECTOR_SET_TRACE_SET_NAME("lazy_emplace(const Key&,Factory)");
+        _VECTOR_SET_TRACE("start");
+
+        auto pos = impl_emplace_position(key, comp);
+
+        if (pos.second) {
+            pos.first = emplace_at(pos.first, relocate_by_memmove(), factory());
+
+            _VECTOR_SET_ASSERT(comp_eq(*pos.first, key));
+        }
+
+        return pos;
+    }
+
+    /**
+     * Constructs element by factory, if the value is not contained.
+     *
+     * See `lazy_emplace(const Key&,Factory)`.
+     *
+     * @param x A value of any type that can be transparently compared
+     *          with a key (less Operator to Key needed).
+     * @param factory Function without arguments returning the new
+     *                element.
+     *
+     * @return Returns a pair consisting of an iterator to the new or
+     *         existing element and a bool value set to true if the
+     *         insertion took place.
+     */
+    template<class K, class Factory>
+    std::pair<iterator,bool>
+    lazy_emplace(const K& x, Factory factory) {
+        _VECTOR_SET_TRACE_SET_NAME("lazy_emplace(const K&,Factory)");
+        _VECTOR_SET_TRACE("start");
+
+        auto pos = impl_emplace_position(x, x_less());
+
+        if (pos.second) {
+            pos.first = emplace_at(pos.first, relocate_by_memmove(), factory());
+
+            _VECTOR_SET_ASSERT(!(x < *pos.first) && !(*pos.first < x));
+        }
+
+        return pos;
+    }
+
 
     /**
      * Erase element at position.
@@ -1982,18 +3397,98 @@ public:
      */
     size_type
     erase(const Key& key) {
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_erase_unique_ordered(key)
+                : mode() == vectorset_mode::ordered
+                ? impl_erase_ordered(key)
                 : impl_erase_unordered(key));
     }
 
+    /**
+     * Erase elements by many keys.
+     *
+     * The keys may be unsorted and may contain duplicates. They are
+     * sorted (if needed) and all matching elements are removed in a
+     * single compaction pass over the vector. This is much faster
+     * than calling `erase(const Key&)` for each key.
+     *
+     * @param first Iterator to first key to remove.
+     * @param last Iterator _after_ last key to remove.
+     *
+     * @return Number of elements removed.
+     */
+    template<class InputIt>
+    size_type
+    erase_many(InputIt first, InputIt last) {
+        return impl_erase_many(first, last, values.get_allocator());
+    }
+
+#if __cplusplus >= 201703L // c++17
+    /**
+     * Erase elements by many keys (scratch memory).
+     *
+     * Like `erase_many(InputIt,InputIt)`, but the temporary copy of
+     * the keys is allocated from `scratch` (e.g. a
+     * `std::pmr::monotonic_buffer_resource` reused for many calls).
+     *
+     * @param first Iterator to first key to remove.
+     * @param last Iterator _after_ last key to remove.
+     * @param scratch Memory resource for temporary memory.
+     *
+     * @return Number of elements removed.
+     */
+    template<class InputIt>
+    size_type
+    erase_many(
+        InputIt first, InputIt last, std::pmr::memory_resource *scratch)
+    {
+        return impl_erase_many(
+            first, last, std::pmr::polymorphic_allocator<Key>(scratch));
+    }
+#endif
+
+    /**
+     * Keep only the elements satisfying a predicate.
+     *
+     * All other elements are removed in a single stable compaction
+     * pass. The order of the kept elements is unchanged, so no
+     * re-sort is required in `vectorset_mode::unique_ordered`.
+     *
+     * @param pred Unary predicate which returns `true` for elements
+     *             to keep.
+     *
+     * @return Number of elements removed.
+     */
+    template<class Pred>
+    size_type
+    retain(Pred pred) {
+        _VECTOR_SET_TRACE_SET_NAME("retain(Pred)");
+        _VECTOR_SET_TRACE("start");
+
+        auto rmIter =
+            std::remove_if(
+                values.begin(), values.end(),
+                [&pred] (const Key &val){
+                    return !pred(val);
+                });
+
+        auto rmSize = std::distance(rmIter, values.end());
+
+        _VECTOR_SET_TRACE_INT("rmSize", rmSize);
+
+        values.erase(rmIter, values.end());
+
+        return rmSize;
+    }
+
 
     /**
      * Appends the given element value to the end of the container
      * (copy, only unordered container).
      *
      * @throws std::logic_error Method is used in mode
-     *                          `vectorset_mode::unique_ordered`.
+     *                          `vectorset_mode::unique_ordered` or
+     *                          `vectorset_mode::ordered`.
      *
      * @param value The value of the element to append.
      *
@@ -2004,7 +3499,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("push_back(const Key&)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unique_ordered) {
+        if (sorted_mode()) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "push_back is only available in vectorset_mode::unordered");
@@ -2018,7 +3513,8 @@ public:
      * (move, only unordered container).
      *
      * @throws std::logic_error Method is used in mode
-     *                          `vectorset_mode::unique_ordered`.
+     *                          `vectorset_mode::unique_ordered` or
+     *                          `vectorset_mode::ordered`.
      *
      * @param value The value of the element to append.
      *
@@ -2029,7 +3525,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("push_back(Key&&)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unique_ordered) {
+        if (sorted_mode()) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "push_back is only available in vectorset_mode::unordered");
@@ -2066,7 +3562,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("resize(size_type)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unique_ordered && count > size()) {
+        if (sorted_mode() && count > size()) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "resize cannot expand container"
@@ -2091,7 +3587,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("resize(size_type,const value_type&)");
         _VECTOR_SET_TRACE("start");
 
-        if (op_mode == vectorset_mode::unique_ordered) {
+        if (sorted_mode()) {
             _VECTOR_SET_TRACE("logic_error");
             throw std::logic_error(
                 "resize cannot expand container"
@@ -2105,6 +3601,9 @@ public:
     /**
      * swap content.
      *
+     * If the allocator does not propagate on swap, both containers
+     * must use equal allocators (like the standard containers).
+     *
      * @param other Container to exchange the contents with.
      */
     void
@@ -2112,8 +3611,202 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("swap(vectorset&)");
         _VECTOR_SET_TRACE("start");
 
+        _VECTOR_SET_ASSERT(
+            std::allocator_traits<Allocator>::propagate_on_container_swap::value
+            || values.get_allocator() == other.values.get_allocator());
+
+        auto otherMode = other.mode();
+
         values.swap(other.values);
-        std::swap(op_mode, other.op_mode);
+        other.store_mode(mode());
+        store_mode(otherMode);
+    }
+
+    /**
+     * Move the elements of `source` into this container.
+     *
+     * If this container is `vectorset_mode::unique_ordered`, elements
+     * which are already contained remain in `source` (like
+     * `std::set::merge()`). Both containers are merged in a single
+     * linear pass, an unordered `source` is sorted before.
+     *
+     * If this container is `vectorset_mode::ordered`, all elements
+     * are merged behind equal elements and `source` becomes empty.
+     *
+     * If this container is `vectorset_mode::unordered`, all elements
+     * are appended and `source` becomes empty.
+     *
+     * @param source Container to move the elements from.
+     */
+    void
+    merge(vectorset& source) {
+        impl_merge(source, values.get_allocator());
+    }
+
+#if __cplusplus >= 201703L // c++17
+    /**
+     * Move the elements of `source` into this container (scratch memory).
+     *
+     * Like `merge(vectorset&)`, but the temporary merge buffer is
+     * allocated from `scratch`.
+     *
+     * @param source Container to move the elements from.
+     * @param scratch Memory resource for temporary memory.
+     */
+    void
+    merge(vectorset& source, std::pmr::memory_resource *scratch) {
+        impl_merge(source, std::pmr::polymorphic_allocator<Key>(scratch));
+    }
+#endif
+
+    /**
+     * Move the elements of `source` into this container.
+     *
+     * See `merge(vectorset&)`.
+     *
+     * @param source Container to move the elements from.
+     */
+    void
+    merge(vectorset&& source) {
+        merge(source);
+    }
+
+    /**
+     * Extract a range of elements into a new container.
+     *
+     * The elements are moved (not copied) into the new container,
+     * which gets the mode of this container.
+     *
+     * @param first Iterator to first element to extract.
+     * @param last Iterator _after_ last element to extract.
+     *
+     * @return Container with the extracted elements.
+     */
+    vectorset
+    extract(const_iterator first, const_iterator last) {
+        _VECTOR_SET_TRACE_SET_NAME("extract(const_iterator,const_iterator)");
+        _VECTOR_SET_TRACE_ITER_RANGE("start", first, last);
+
+        auto firstIter =
+            std::next(values.begin(), std::distance(values.cbegin(), first));
+        auto lastIter =
+            std::next(values.begin(), std::distance(values.cbegin(), last));
+
+        vectorset result(comp, values.get_allocator());
+
+        result.values.insert(
+            result.values.end(),
+            std::make_move_iterator(firstIter),
+            std::make_move_iterator(lastIter));
+        result.store_mode(mode());
+
+        values.erase(firstIter, lastIter);
+
+        return result;
+    }
+
+    /**
+     * Keep only the elements, which are contained in `other`.
+     *
+     * In-place intersection without allocation. The smaller side is
+     * searched by galloping, if the sizes are very different.
+     *
+     * @throws std::logic_error One of the containers is not in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param other Container to intersect with.
+     *
+     * @return Number of elements removed.
+     */
+    size_type
+    intersect_with(const vectorset& other) {
+        _VECTOR_SET_TRACE_SET_NAME("intersect_with(const vectorset&)");
+        _VECTOR_SET_TRACE("start");
+
+        if (mode() != vectorset_mode::unique_ordered
+            || other.mode() != vectorset_mode::unique_ordered)
+        {
+            _VECTOR_SET_TRACE("logic_error");
+            throw std::logic_error(
+                "intersect_with is only available in"
+                " vectorset_mode::unique_ordered");
+        }
+
+        auto gallop = _vectorset_is_skewed(values.size(), other.values.size());
+
+        _VECTOR_SET_TRACE_BOOL("gallop", gallop);
+
+        auto read = values.begin();
+        auto write = values.begin();
+        auto oFirst = other.values.begin();
+        auto oLast = other.values.end();
+
+        while (read != values.end() && oFirst != oLast) {
+            if (comp(*read, *oFirst)) {
+                read = (gallop
+                        ? _vectorset_gallop_lower_bound(
+                            read, values.end(), *oFirst, comp)
+                        : std::next(read));
+            }
+            else if (comp(*oFirst, *read)) {
+                oFirst = (gallop
+                          ? _vectorset_gallop_lower_bound(
+                              oFirst, oLast, *read, comp)
+                          : std::next(oFirst));
+            }
+            else {
+                if (write != read) {
+                    *write = std::move(*read);
+                }
+                ++write;
+                ++read;
+                ++oFirst;
+            }
+        }
+
+        auto rmSize = std::distance(write, values.end());
+
+        _VECTOR_SET_TRACE_INT("rmSize", rmSize);
+
+        values.erase(write, values.end());
+
+        return rmSize;
+    }
+
+    /**
+     * Remove all elements, which are contained in `other`.
+     *
+     * In-place difference without allocation (single compaction
+     * pass, keys of `other` are searched by galloping).
+     *
+     * @throws std::logic_error One of the containers is not in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param other Container with the elements to remove.
+     *
+     * @return Number of elements removed.
+     */
+    size_type
+    subtract(const vectorset& other) {
+        _VECTOR_SET_TRACE_SET_NAME("subtract(const vectorset&)");
+        _VECTOR_SET_TRACE("start");
+
+        if (mode() != vectorset_mode::unique_ordered
+            || other.mode() != vectorset_mode::unique_ordered)
+        {
+            _VECTOR_SET_TRACE("logic_error");
+            throw std::logic_error(
+                "subtract is only available in"
+                " vectorset_mode::unique_ordered");
+        }
+
+        if (&other == this) {
+            auto rmSize = values.size();
+            values.clear();
+            return rmSize;
+        }
+
+        return impl_erase_many_unique_ordered(other.values);
     }
 
     /// @}
@@ -2135,8 +3828,10 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("count(const Key&)const");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_count_unique_ordered(key)
+                : mode() == vectorset_mode::ordered
+                ? impl_count_ordered(key, comp)
                 : impl_count_unordered(key));
     }
 
@@ -2154,8 +3849,10 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("count(const K&)const");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (mode() == vectorset_mode::unique_ordered
                 ? impl_count_unique_ordered(x)
+                : mode() == vectorset_mode::ordered
+                ? impl_count_ordered(x, x_less())
                 : impl_count_unordered(x));
     }
 
@@ -2173,7 +3870,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("find(const Key&)");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (sorted_mode()
                 ? impl_find_unique_ordered(key)
                 : impl_find_unordered(key));
     }
@@ -2191,7 +3888,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("find(const Key&)const");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (sorted_mode()
                 ? impl_find_unique_ordered(key)
                 : impl_find_unordered(key));
     }
@@ -2211,7 +3908,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("find(const K&)");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (sorted_mode()
                 ? impl_find_unique_ordered(x)
                 : impl_find_unordered(x));
     }
@@ -2231,7 +3928,7 @@ public:
         _VECTOR_SET_TRACE_SET_NAME("find(const K&)const");
         _VECTOR_SET_TRACE("start");
 
-        return (op_mode == vectorset_mode::unique_ordered
+        return (sorted_mode()
                 ? impl_find_unique_ordered(x)
                 : impl_find_unordered(x));
     }
@@ -2541,6 +4238,30 @@ public:
 }; // class vectorset
 
 
+/**
+ * Erase all elements satisfying a predicate (uniform container
+ * erasure).
+ *
+ * The elements are removed in a single stable compaction pass, the
+ * mode of the container is kept.
+ *
+ * @param c Container from which to erase.
+ * @param pred Unary predicate which returns `true` for elements to
+ *             erase.
+ *
+ * @return Number of elements removed.
+ */
+template<class T, class Compare, class Alloc, class Container, class Pred>
+inline typename vectorset<T, Compare, Alloc, Container>::size_type
+erase_if(vectorset<T, Compare, Alloc, Container>& c, Pred pred)
+{
+    return c.retain(
+        [&pred](const T& value) {
+            return !pred(value);
+        });
+}
+
+
 #if __cplusplus >= 202002L // c++20
 
 /**
@@ -2553,11 +4274,11 @@ public:
  *
  * @return Comparison category type (`std::lexicographical_compare_three_way`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline constexpr auto
 operator<=>(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() <=> rhs.get_vector());
 }
@@ -2571,11 +4292,11 @@ operator<=>(
  *
  * @return `true` if `lhs == rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline constexpr bool
 operator==(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() == rhs.get_vector());
 }
@@ -2590,11 +4311,11 @@ operator==(
  *
  * @return `true` if `lhs == rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator==(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() == rhs.get_vector());
 }
@@ -2607,11 +4328,11 @@ operator==(
  *
  * @return `true` if `lhs != rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator!=(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() != rhs.get_vector());
 }
@@ -2624,11 +4345,11 @@ operator!=(
  *
  * @return `true` if `lhs < rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator<(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() < rhs.get_vector());
 }
@@ -2641,11 +4362,11 @@ operator<(
  *
  * @return `true` if `lhs <= rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator<=(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() <= rhs.get_vector());
 }
@@ -2658,11 +4379,11 @@ operator<=(
  *
  * @return `true` if `lhs > rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator>(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() > rhs.get_vector());
 }
@@ -2675,15 +4396,29 @@ operator>(
  *
  * @return `true` if `lhs >= rhs` (`std::lexicographical_compare`).
  */
-template<class T, class Compare, class Alloc>
+template<class T, class Compare, class Alloc, class Container>
 inline bool
 operator>=(
-    const vectorset<T, Compare, Alloc>& lhs,
-    const vectorset<T, Compare, Alloc>& rhs)
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
 {
     return (lhs.get_vector() >= rhs.get_vector());
 }
 
 #endif // __cplusplus < 202002L
 
+#if __cplusplus >= 201703L // c++17
+namespace pmr {
+/**
+ * `vectorset` using a polymorphic allocator.
+ *
+ * Copies keep the default memory resource (like `std::pmr::vector`),
+ * moves and the allocator-extended constructors keep the given one.
+ */
+template<class Key, class Compare = std::less<Key>>
+using vectorset = ::vectorset<
+    Key, Compare, std::pmr::polymorphic_allocator<Key>>;
+} // namespace pmr
+#endif
+
 #endif /* VECTOR_SET_H */
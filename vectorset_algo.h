@@ -0,0 +1,1421 @@
+//
+// Set algebra on unique ordered vectorsets.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef VECTOR_SET_ALGO_H
+#define VECTOR_SET_ALGO_H
+
+#include "vectorset.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(VECTOR_SET_NO_SIMD) && defined(__GNUC__)   \
+    && (defined(__x86_64__) || defined(__i386__))
+#   define _VECTOR_SET_SIMD_X86 1
+#   include <immintrin.h>
+#endif
+
+
+/**
+ * Number of set bits of a 64 bit word.
+ *
+ * @param word Word to count.
+ *
+ * @return Number of set bits.
+ */
+inline unsigned
+_vectorset_popcount64(uint64_t word) {
+#ifdef __GNUC__
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+    unsigned count = 0;
+
+    for (; word != 0; word &= word - 1) {
+        ++count;
+    }
+
+    return count;
+#endif
+}
+
+
+/**
+ * Position of the `rank`-th set bit of a 64 bit word.
+ *
+ * @param word Word to search (at least `rank + 1` bits set).
+ * @param rank Number of set bits to skip.
+ *
+ * @return Position of the bit (0 = least significant bit).
+ */
+inline unsigned
+_vectorset_select64(uint64_t word, unsigned rank) {
+    for (; rank > 0; --rank) {
+        word &= word - 1;
+    }
+
+#ifdef __GNUC__
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned pos = 0;
+
+    for (; (word & 1) == 0; word >>= 1) {
+        ++pos;
+    }
+
+    return pos;
+#endif
+}
+
+
+/**
+ * Set algorithms on sorted unique ranges.
+ *
+ * The ranges need random access iterators. If the sizes of both
+ * ranges are very different, the larger range is searched by
+ * galloping, so the costs of the comparisons are O(m log(n/m))
+ * instead of O(n + m).
+ */
+namespace vectorset_algo {
+
+    /// Parts of two merged ranges to copy to the output (bit mask).
+    enum merge_part : unsigned {
+        /// Elements only in the first range.
+        only_first = 1,
+
+        /// Elements only in the second range.
+        only_second = 2,
+
+        /// Elements in both ranges (copied from the first range).
+        both = 4
+    };
+
+
+    /**
+     * Merge two sorted unique ranges (stepping or galloping).
+     *
+     * @tparam Parts Parts to copy to the output (`merge_part` mask).
+     * @tparam Gallop Search next position by galloping.
+     *
+     * @param first1 Begin of the first range.
+     * @param last1 End of the first range.
+     * @param first2 Begin of the second range.
+     * @param last2 End of the second range.
+     * @param d_first Begin of the output range.
+     * @param comp Compare function of both ranges.
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<
+        unsigned Parts, bool Gallop,
+        class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    merge_parts_impl(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        while (first1 != last1 && first2 != last2) {
+            if (comp(*first1, *first2)) {
+                auto next =
+                    (Gallop
+                     ? _vectorset_gallop_lower_bound(
+                         first1, last1, *first2, comp)
+                     : std::next(first1));
+
+                if (Parts & only_first) {
+                    d_first = std::copy(first1, next, d_first);
+                }
+                first1 = next;
+            }
+            else if (comp(*first2, *first1)) {
+                auto next =
+                    (Gallop
+                     ? _vectorset_gallop_lower_bound(
+                         first2, last2, *first1, comp)
+                     : std::next(first2));
+
+                if (Parts & only_second) {
+                    d_first = std::copy(first2, next, d_first);
+                }
+                first2 = next;
+            }
+            else {
+                if (Parts & both) {
+                    *d_first = *first1;
+                    ++d_first;
+                }
+                ++first1;
+                ++first2;
+            }
+        }
+
+        if (Parts & only_first) {
+            d_first = std::copy(first1, last1, d_first);
+        }
+
+        if (Parts & only_second) {
+            d_first = std::copy(first2, last2, d_first);
+        }
+
+        return d_first;
+    }
+
+
+    /**
+     * Merge two sorted unique ranges (kernel of all set operations).
+     *
+     * Ranges of very different sizes are merged by galloping.
+     *
+     * @tparam Parts Parts to copy to the output (`merge_part` mask).
+     *
+     * @param first1 Begin of the first range.
+     * @param last1 End of the first range.
+     * @param first2 Begin of the second range.
+     * @param last2 End of the second range.
+     * @param d_first Begin of the output range.
+     * @param comp Compare function of both ranges.
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<
+        unsigned Parts,
+        class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    merge_parts(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        return (
+            _vectorset_is_skewed(
+                std::distance(first1, last1), std::distance(first2, last2))
+            ? merge_parts_impl<Parts, true>(
+                first1, last1, first2, last2, d_first, comp)
+            : merge_parts_impl<Parts, false>(
+                first1, last1, first2, last2, d_first, comp));
+    }
+
+
+    /**
+     * Union of two sorted unique ranges.
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    set_union(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        return merge_parts<only_first | only_second | both>(
+            first1, last1, first2, last2, d_first, comp);
+    }
+
+    /**
+     * Intersection of two sorted unique ranges.
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    set_intersection(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        return merge_parts<both>(
+            first1, last1, first2, last2, d_first, comp);
+    }
+
+    /**
+     * Difference of two sorted unique ranges (first without second).
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    set_difference(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        return merge_parts<only_first>(
+            first1, last1, first2, last2, d_first, comp);
+    }
+
+    /**
+     * Symmetric difference of two sorted unique ranges.
+     *
+     * @return Iterator past the last copied element.
+     */
+    template<class RandomIt1, class RandomIt2, class OutputIt, class Compare>
+    OutputIt
+    set_symmetric_difference(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        OutputIt d_first, Compare comp)
+    {
+        return merge_parts<only_first | only_second>(
+            first1, last1, first2, last2, d_first, comp);
+    }
+
+
+    /**
+     * Output iterator, which only counts the assigned elements.
+     */
+    class counting_iterator {
+    public:
+        typedef std::output_iterator_tag iterator_category;
+        typedef void value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef void pointer;
+        typedef void reference;
+
+        counting_iterator&
+        operator*() {
+            return *this;
+        }
+
+        template<class T>
+        counting_iterator&
+        operator=(const T&) {
+            ++counter;
+            return *this;
+        }
+
+        counting_iterator&
+        operator++() {
+            return *this;
+        }
+
+        counting_iterator&
+        operator++(int) {
+            return *this;
+        }
+
+        /// Number of assigned elements.
+        size_t
+        count() const {
+            return counter;
+        }
+
+    private:
+        size_t counter = 0;
+    };
+
+
+    /**
+     * Size of the intersection of two sorted unique ranges.
+     *
+     * @return Number of elements contained in both ranges.
+     */
+    template<class RandomIt1, class RandomIt2, class Compare>
+    size_t
+    intersection_size(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        Compare comp)
+    {
+        return merge_parts<both>(
+            first1, last1, first2, last2, counting_iterator(), comp).count();
+    }
+
+
+    /**
+     * Check for a common element of two sorted unique ranges
+     * (stepping or galloping).
+     *
+     * @tparam Gallop Search next position by galloping.
+     *
+     * @return `true`, if there is no common element.
+     */
+    template<bool Gallop, class RandomIt1, class RandomIt2, class Compare>
+    bool
+    is_disjoint_impl(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        Compare comp)
+    {
+        while (first1 != last1 && first2 != last2) {
+            if (comp(*first1, *first2)) {
+                first1 =
+                    (Gallop
+                     ? _vectorset_gallop_lower_bound(
+                         first1, last1, *first2, comp)
+                     : std::next(first1));
+            }
+            else if (comp(*first2, *first1)) {
+                first2 =
+                    (Gallop
+                     ? _vectorset_gallop_lower_bound(
+                         first2, last2, *first1, comp)
+                     : std::next(first2));
+            }
+            else {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Check for a common element of two sorted unique ranges.
+     *
+     * Stops at the first common element.
+     *
+     * @return `true`, if there is no common element.
+     */
+    template<class RandomIt1, class RandomIt2, class Compare>
+    bool
+    is_disjoint(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        Compare comp)
+    {
+        return (
+            _vectorset_is_skewed(
+                std::distance(first1, last1), std::distance(first2, last2))
+            ? is_disjoint_impl<true>(first1, last1, first2, last2, comp)
+            : is_disjoint_impl<false>(first1, last1, first2, last2, comp));
+    }
+
+
+    /**
+     * Check, if a sorted unique range contains all elements of
+     * another one.
+     *
+     * Stops at the first missing element.
+     *
+     * @return `true`, if all elements of the second range are
+     *         contained in the first range.
+     */
+    template<class RandomIt1, class RandomIt2, class Compare>
+    bool
+    includes(
+        RandomIt1 first1, RandomIt1 last1,
+        RandomIt2 first2, RandomIt2 last2,
+        Compare comp)
+    {
+        auto size1 = std::distance(first1, last1);
+        auto size2 = std::distance(first2, last2);
+
+        if (size2 > size1) {
+            return false;
+        }
+
+        bool gallop = _vectorset_is_skewed(size1, size2);
+
+        for (; first2 != last2; ++first2, ++first1) {
+            if (gallop) {
+                first1 =
+                    _vectorset_gallop_lower_bound(first1, last1, *first2, comp);
+            }
+            else {
+                while (first1 != last1 && comp(*first1, *first2)) {
+                    ++first1;
+                }
+            }
+
+            if (first1 == last1 || comp(*first2, *first1)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    /// Padding of the output array of `simd_intersection()` (elements).
+    constexpr size_t simd_padding = 4;
+
+
+    /// Check, if the keys are supported by the SIMD kernels.
+    template<class T>
+    struct is_simd_key
+        : std::integral_constant<
+              bool,
+              std::is_same<T, uint32_t>::value
+              || std::is_same<T, uint64_t>::value>
+    {};
+
+
+    /// Result of the intersection kernels.
+    enum simd_result {
+        /// Store the common elements.
+        simd_store,
+
+        /// Count the common elements.
+        simd_count,
+
+        /// Stop at the first common element (result 0 or 1).
+        simd_any
+    };
+
+
+    /**
+     * Intersection of sorted unique integer arrays (scalar).
+     *
+     * @tparam Result What to compute (`simd_result`).
+     *
+     * @param lhs First array.
+     * @param lhsSize Size of the first array.
+     * @param rhs Second array.
+     * @param rhsSize Size of the second array.
+     * @param out Output array (only `simd_store`).
+     *
+     * @return Number of common elements (`simd_any`: 0 or 1).
+     */
+    template<int Result, class T>
+    size_t
+    scalar_intersection(
+        const T *lhs, size_t lhsSize, const T *rhs, size_t rhsSize, T *out)
+    {
+        switch (Result) {
+        case simd_store:
+            return (
+                vectorset_algo::set_intersection(
+                    lhs, lhs + lhsSize, rhs, rhs + rhsSize, out,
+                    std::less<T>())
+                - out);
+
+        case simd_count:
+            return vectorset_algo::intersection_size(
+                lhs, lhs + lhsSize, rhs, rhs + rhsSize, std::less<T>());
+
+        default:
+            return (
+                vectorset_algo::is_disjoint(
+                    lhs, lhs + lhsSize, rhs, rhs + rhsSize, std::less<T>())
+                ? 0 : 1);
+        }
+    }
+
+#ifdef _VECTOR_SET_SIMD_X86
+
+    /**
+     * Shuffle masks to pack the matching lanes to the front.
+     *
+     * Index is the bit mask of the matching lanes
+     * (`_mm_movemask_ps()` or `_mm_movemask_pd()`).
+     */
+    struct simd_pack_table {
+        /// Masks for 4 lanes of 32 bit.
+        alignas(16) uint8_t mask32[16][16];
+
+        /// Masks for 2 lanes of 64 bit.
+        alignas(16) uint8_t mask64[4][16];
+
+        simd_pack_table() {
+            init(mask32, 4);
+            init(mask64, 2);
+        }
+
+        template<size_t Masks>
+        static void
+        init(uint8_t (&masks)[Masks][16], unsigned lanes) {
+            auto laneBytes = 16 / lanes;
+
+            for (unsigned bits = 0; bits < Masks; ++bits) {
+                unsigned pos = 0;
+
+                for (unsigned lane = 0; lane < lanes; ++lane) {
+                    if (bits & (1u << lane)) {
+                        for (unsigned byte = 0; byte < laneBytes; ++byte) {
+                            masks[bits][pos * laneBytes + byte] =
+                                static_cast<uint8_t>(lane * laneBytes + byte);
+                        }
+                        ++pos;
+                    }
+                }
+
+                for (auto byte = pos * laneBytes; byte < 16; ++byte) {
+                    masks[bits][byte] = 0x80;
+                }
+            }
+        }
+
+        static const simd_pack_table&
+        get() {
+            static const simd_pack_table table;
+            return table;
+        }
+    };
+
+
+    /**
+     * Intersection of sorted unique 32 bit arrays (SSE4.1).
+     *
+     * Blocks of 4 elements of both arrays are compared all-to-all,
+     * the matching elements are packed by a shuffle. The block with
+     * the smaller maximum is replaced by the next block.
+     *
+     * @tparam Result What to compute (`simd_result`).
+     *
+     * @param out Output array with room for `min(lhsSize, rhsSize) +
+     *            simd_padding` elements (only `simd_store`).
+     *
+     * @return Number of common elements (`simd_any`: 0 or 1).
+     */
+    template<int Result>
+    __attribute__((target("sse4.1")))
+    size_t
+    sse_intersection(
+        const uint32_t *lhs, size_t lhsSize,
+        const uint32_t *rhs, size_t rhsSize,
+        uint32_t *out)
+    {
+        const auto &table = simd_pack_table::get();
+        size_t lhsPos = 0;
+        size_t rhsPos = 0;
+        size_t count = 0;
+
+        while (lhsPos + 4 <= lhsSize && rhsPos + 4 <= rhsSize) {
+            auto lhsVec =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + lhsPos));
+            auto rhsVec =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + rhsPos));
+
+            auto match =
+                _mm_or_si128(
+                    _mm_or_si128(
+                        _mm_cmpeq_epi32(lhsVec, rhsVec),
+                        _mm_cmpeq_epi32(
+                            lhsVec, _mm_shuffle_epi32(rhsVec, 0x39))),
+                    _mm_or_si128(
+                        _mm_cmpeq_epi32(
+                            lhsVec, _mm_shuffle_epi32(rhsVec, 0x4e)),
+                        _mm_cmpeq_epi32(
+                            lhsVec, _mm_shuffle_epi32(rhsVec, 0x93))));
+
+            auto bits = _mm_movemask_ps(_mm_castsi128_ps(match));
+
+            if (Result == simd_any && bits != 0) {
+                return 1;
+            }
+
+            if (Result == simd_store) {
+                auto packed =
+                    _mm_shuffle_epi8(
+                        lhsVec,
+                        _mm_load_si128(
+                            reinterpret_cast<const __m128i*>(
+                                table.mask32[bits])));
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(out + count), packed);
+            }
+            count += __builtin_popcount(bits);
+
+            auto lhsMax = lhs[lhsPos + 3];
+            auto rhsMax = rhs[rhsPos + 3];
+
+            if (lhsMax <= rhsMax) {
+                lhsPos += 4;
+            }
+            if (rhsMax <= lhsMax) {
+                rhsPos += 4;
+            }
+        }
+
+        return count + scalar_intersection<Result>(
+            lhs + lhsPos, lhsSize - lhsPos,
+            rhs + rhsPos, rhsSize - rhsPos,
+            Result == simd_store ? out + count : out);
+    }
+
+    /**
+     * Intersection of sorted unique 64 bit arrays (SSE4.1).
+     *
+     * Like the 32 bit version with blocks of 2 elements.
+     *
+     * @tparam Result What to compute (`simd_result`).
+     *
+     * @param out Output array with room for `min(lhsSize, rhsSize) +
+     *            simd_padding` elements (only `simd_store`).
+     *
+     * @return Number of common elements (`simd_any`: 0 or 1).
+     */
+    template<int Result>
+    __attribute__((target("sse4.1")))
+    size_t
+    sse_intersection(
+        const uint64_t *lhs, size_t lhsSize,
+        const uint64_t *rhs, size_t rhsSize,
+        uint64_t *out)
+    {
+        const auto &table = simd_pack_table::get();
+        size_t lhsPos = 0;
+        size_t rhsPos = 0;
+        size_t count = 0;
+
+        while (lhsPos + 2 <= lhsSize && rhsPos + 2 <= rhsSize) {
+            auto lhsVec =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + lhsPos));
+            auto rhsVec =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + rhsPos));
+
+            auto match =
+                _mm_or_si128(
+                    _mm_cmpeq_epi64(lhsVec, rhsVec),
+                    _mm_cmpeq_epi64(
+                        lhsVec, _mm_shuffle_epi32(rhsVec, 0x4e)));
+
+            auto bits = _mm_movemask_pd(_mm_castsi128_pd(match));
+
+            if (Result == simd_any && bits != 0) {
+                return 1;
+            }
+
+            if (Result == simd_store) {
+                auto packed =
+                    _mm_shuffle_epi8(
+                        lhsVec,
+                        _mm_load_si128(
+                            reinterpret_cast<const __m128i*>(
+                                table.mask64[bits])));
+
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i*>(out + count), packed);
+            }
+            count += __builtin_popcount(bits);
+
+            auto lhsMax = lhs[lhsPos + 1];
+            auto rhsMax = rhs[rhsPos + 1];
+
+            if (lhsMax <= rhsMax) {
+                lhsPos += 2;
+            }
+            if (rhsMax <= lhsMax) {
+                rhsPos += 2;
+            }
+        }
+
+        return count + scalar_intersection<Result>(
+            lhs + lhsPos, lhsSize - lhsPos,
+            rhs + rhsPos, rhsSize - rhsPos,
+            Result == simd_store ? out + count : out);
+    }
+
+
+    /**
+     * Check (once), if the CPU supports SSE4.1.
+     *
+     * @return `true`, if SSE4.1 is supported.
+     */
+    inline bool
+    has_sse41() {
+        static const bool result = __builtin_cpu_supports("sse4.1");
+        return result;
+    }
+
+#endif // _VECTOR_SET_SIMD_X86
+
+
+    /**
+     * Intersection of sorted unique integer arrays (dispatcher).
+     *
+     * Uses SSE4.1, if supported by the CPU (checked at runtime) and
+     * the sizes of both arrays are similar. Otherwise the scalar
+     * (galloping) version is used.
+     *
+     * @tparam Result What to compute (`simd_result`).
+     *
+     * @return Number of common elements (`simd_any`: 0 or 1).
+     */
+    template<int Result, class T>
+    inline size_t
+    simd_intersection_impl(
+        const T *lhs, size_t lhsSize, const T *rhs, size_t rhsSize, T *out)
+    {
+#ifdef _VECTOR_SET_SIMD_X86
+        if (!_vectorset_is_skewed(lhsSize, rhsSize) && has_sse41()) {
+            return sse_intersection<Result>(lhs, lhsSize, rhs, rhsSize, out);
+        }
+#endif
+
+        return scalar_intersection<Result>(lhs, lhsSize, rhs, rhsSize, out);
+    }
+
+
+    /**
+     * Intersection of sorted unique integer arrays.
+     *
+     * @param lhs First array.
+     * @param lhsSize Size of the first array.
+     * @param rhs Second array.
+     * @param rhsSize Size of the second array.
+     * @param out Output array with room for `min(lhsSize, rhsSize) +
+     *            simd_padding` elements.
+     *
+     * @return Number of elements written to `out`.
+     */
+    template<class T>
+    inline typename std::enable_if<is_simd_key<T>::value, size_t>::type
+    simd_intersection(
+        const T *lhs, size_t lhsSize, const T *rhs, size_t rhsSize, T *out)
+    {
+        return simd_intersection_impl<simd_store>(
+            lhs, lhsSize, rhs, rhsSize, out);
+    }
+
+    /**
+     * Size of the intersection of sorted unique integer arrays.
+     *
+     * @return Number of elements contained in both arrays.
+     */
+    template<class T>
+    inline typename std::enable_if<is_simd_key<T>::value, size_t>::type
+    simd_intersection_size(
+        const T *lhs, size_t lhsSize, const T *rhs, size_t rhsSize)
+    {
+        return simd_intersection_impl<simd_count, T>(
+            lhs, lhsSize, rhs, rhsSize, nullptr);
+    }
+
+    /**
+     * Check for a common element of sorted unique integer arrays.
+     *
+     * @return `true`, if there is no common element.
+     */
+    template<class T>
+    inline typename std::enable_if<is_simd_key<T>::value, bool>::type
+    simd_is_disjoint(
+        const T *lhs, size_t lhsSize, const T *rhs, size_t rhsSize)
+    {
+        return simd_intersection_impl<simd_any, T>(
+            lhs, lhsSize, rhs, rhsSize, nullptr) == 0;
+    }
+
+} // namespace vectorset_algo
+
+
+/**
+ * Check, if both vectorsets are unique ordered.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param name Name of the operation (error message).
+ */
+template<class T, class Compare, class Alloc, class Container>
+void
+_vectorset_check_unique_ordered(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    const char *name)
+{
+    if (lhs.get_mode() != vectorset_mode::unique_ordered
+        || rhs.get_mode() != vectorset_mode::unique_ordered)
+    {
+        throw std::logic_error(
+            std::string(name)
+            + " is only available in vectorset_mode::unique_ordered");
+    }
+}
+
+
+/**
+ * Intersection of two unique ordered vectorsets into `result`.
+ *
+ * @param result Container to append the elements to.
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline void
+_vectorset_intersection(
+    Container& result,
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    vectorset_algo::merge_parts<vectorset_algo::both>(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        std::back_inserter(result), lhs.key_comp());
+}
+
+/**
+ * Intersection of two unique ordered vectorsets of 32/64 bit
+ * integers into `result` (SIMD).
+ *
+ * @param result Container to store the elements to.
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ */
+template<class T, class Alloc>
+inline typename std::enable_if<vectorset_algo::is_simd_key<T>::value>::type
+_vectorset_intersection(
+    std::vector<T, Alloc>& result,
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& lhs,
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& rhs)
+{
+    result.resize(
+        std::min(lhs.size(), rhs.size()) + vectorset_algo::simd_padding);
+
+    auto count =
+        vectorset_algo::simd_intersection(
+            lhs.get_vector().data(), lhs.size(),
+            rhs.get_vector().data(), rhs.size(),
+            result.data());
+
+    result.resize(count);
+}
+
+
+/**
+ * Set operation on two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @tparam Parts Parts to copy to the result (`merge_part` mask).
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param name Name of the operation (error message).
+ *
+ * @return Unique ordered result.
+ */
+template<
+    unsigned Parts, class T, class Compare, class Alloc, class Container>
+vectorset<T, Compare, Alloc, Container>
+_vectorset_set_operation(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    const char *name)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, name);
+
+    Container result(lhs.get_allocator());
+
+    result.reserve(
+        Parts == vectorset_algo::both
+        ? std::min(lhs.size(), rhs.size())
+        : ((Parts & vectorset_algo::only_first ? lhs.size() : 0)
+           + (Parts & vectorset_algo::only_second ? rhs.size() : 0)));
+
+    if (Parts == vectorset_algo::both) {
+        _vectorset_intersection(result, lhs, rhs);
+    }
+    else {
+        vectorset_algo::merge_parts<Parts>(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+            std::back_inserter(result), lhs.key_comp());
+    }
+
+    return vectorset<T, Compare, Alloc, Container>(
+        vectorset_sorted_unique, std::move(result), lhs.key_comp());
+}
+
+
+/**
+ * Union of two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Unique ordered container with the elements of both sides.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+set_union(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return _vectorset_set_operation<
+        vectorset_algo::only_first | vectorset_algo::only_second
+        | vectorset_algo::both>(
+            lhs, rhs, "set_union");
+}
+
+/**
+ * Intersection of two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Unique ordered container with the elements of `lhs`, which
+ *         are contained in `rhs`.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+set_intersection(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return _vectorset_set_operation<vectorset_algo::both>(
+        lhs, rhs, "set_intersection");
+}
+
+/**
+ * Difference of two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Unique ordered container with the elements of `lhs`, which
+ *         are not contained in `rhs`.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+set_difference(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return _vectorset_set_operation<vectorset_algo::only_first>(
+        lhs, rhs, "set_difference");
+}
+
+/**
+ * Symmetric difference of two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Unique ordered container with the elements, which are
+ *         contained in only one of both sides.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+set_symmetric_difference(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return _vectorset_set_operation<
+        vectorset_algo::only_first | vectorset_algo::only_second>(
+            lhs, rhs, "set_symmetric_difference");
+}
+
+
+/**
+ * Size of the intersection of two unique ordered vectorsets (generic).
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline size_t
+_vectorset_intersection_size(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return vectorset_algo::intersection_size(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.key_comp());
+}
+
+/**
+ * Size of the intersection of two unique ordered vectorsets of 32/64
+ * bit integers (SIMD).
+ */
+template<class T, class Alloc>
+inline typename std::enable_if<
+    vectorset_algo::is_simd_key<T>::value, size_t>::type
+_vectorset_intersection_size(
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& lhs,
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& rhs)
+{
+    return vectorset_algo::simd_intersection_size(
+        lhs.get_vector().data(), lhs.size(),
+        rhs.get_vector().data(), rhs.size());
+}
+
+/**
+ * Check for a common element of two unique ordered vectorsets
+ * (generic).
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline bool
+_vectorset_is_disjoint(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return vectorset_algo::is_disjoint(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.key_comp());
+}
+
+/**
+ * Check for a common element of two unique ordered vectorsets of
+ * 32/64 bit integers (SIMD).
+ */
+template<class T, class Alloc>
+inline typename std::enable_if<
+    vectorset_algo::is_simd_key<T>::value, bool>::type
+_vectorset_is_disjoint(
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& lhs,
+    const vectorset<T, std::less<T>, Alloc, std::vector<T, Alloc>>& rhs)
+{
+    return vectorset_algo::simd_is_disjoint(
+        lhs.get_vector().data(), lhs.size(),
+        rhs.get_vector().data(), rhs.size());
+}
+
+
+/**
+ * Size of the intersection of two unique ordered vectorsets.
+ *
+ * Counts without creating the intersection.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Number of elements contained in both sides.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline size_t
+intersection_size(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, "intersection_size");
+    return _vectorset_intersection_size(lhs, rhs);
+}
+
+/**
+ * Jaccard similarity of two unique ordered vectorsets.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return Size of the intersection divided by the size of the union
+ *         (1.0, if both sides are empty).
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline double
+jaccard(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, "jaccard");
+
+    if (lhs.empty() && rhs.empty()) {
+        return 1.0;
+    }
+
+    auto common = _vectorset_intersection_size(lhs, rhs);
+
+    return (
+        static_cast<double>(common)
+        / static_cast<double>(lhs.size() + rhs.size() - common));
+}
+
+/**
+ * Check for a common element of two unique ordered vectorsets.
+ *
+ * Stops at the first common element.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true`, if there is no common element.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline bool
+is_disjoint(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, "is_disjoint");
+    return _vectorset_is_disjoint(lhs, rhs);
+}
+
+/**
+ * Check, if a unique ordered vectorset contains all elements of
+ * another one.
+ *
+ * Stops at the first missing element.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ *
+ * @return `true`, if `rhs` is a subset of `lhs`.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline bool
+includes(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, "includes");
+    return vectorset_algo::includes(
+        lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.key_comp());
+}
+
+
+/**
+ * Check, if all vectorsets are unique ordered.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param sets Vectorsets to check (not null).
+ * @param name Name of the operation (error message).
+ */
+template<class T, class Compare, class Alloc, class Container>
+void
+_vectorset_check_unique_ordered(
+    const std::vector<const vectorset<T, Compare, Alloc, Container>*>& sets,
+    const char *name)
+{
+    for (auto set : sets) {
+        if (set->get_mode() != vectorset_mode::unique_ordered) {
+            throw std::logic_error(
+                std::string(name)
+                + " is only available in vectorset_mode::unique_ordered");
+        }
+    }
+}
+
+
+/**
+ * Intersection of many unique ordered vectorsets.
+ *
+ * The sets are processed from the smallest to the largest. Each
+ * element of the smallest set is searched by galloping in the other
+ * sets. On a miss the smallest set gallops to the found element. The
+ * operation stops, if one of the sets is exhausted. No intermediate
+ * results are created.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param sets Vectorsets to intersect (not null).
+ *
+ * @return Unique ordered container with the elements, which are
+ *         contained in all sets (empty, if `sets` is empty).
+ */
+template<class T, class Compare, class Alloc, class Container>
+vectorset<T, Compare, Alloc, Container>
+set_intersection(
+    const std::vector<const vectorset<T, Compare, Alloc, Container>*>& sets)
+{
+    typedef vectorset<T, Compare, Alloc, Container> set_type;
+    typedef typename set_type::const_iterator const_iterator;
+
+    _vectorset_check_unique_ordered(sets, "set_intersection");
+
+    if (sets.empty()) {
+        return set_type(vectorset_sorted_unique, Container());
+    }
+    if (sets.size() == 1) {
+        return *sets.front();
+    }
+    if (sets.size() == 2) {
+        return set_intersection(*sets[0], *sets[1]);
+    }
+
+    auto ordered = sets;
+    std::sort(
+        ordered.begin(), ordered.end(),
+        [](const set_type *lhs, const set_type *rhs) {
+            return lhs->size() < rhs->size();
+        });
+
+    auto comp = ordered.front()->key_comp();
+    Container result(ordered.front()->get_allocator());
+    std::vector<const_iterator> cursor;
+
+    result.reserve(ordered.front()->size());
+    cursor.reserve(ordered.size());
+    for (auto set : ordered) {
+        cursor.push_back(set->begin());
+    }
+
+    auto &candidate = cursor.front();
+    auto candidateEnd = ordered.front()->end();
+
+    while (candidate != candidateEnd) {
+        bool found = true;
+
+        for (size_t idx = 1; idx < ordered.size(); ++idx) {
+            auto setEnd = ordered[idx]->end();
+
+            cursor[idx] =
+                _vectorset_gallop_lower_bound(
+                    cursor[idx], setEnd, *candidate, comp);
+
+            if (cursor[idx] == setEnd) {
+                return set_type(
+                    vectorset_sorted_unique, std::move(result), comp);
+            }
+
+            if (comp(*candidate, *cursor[idx])) {
+                candidate =
+                    _vectorset_gallop_lower_bound(
+                        candidate + 1, candidateEnd, *cursor[idx], comp);
+                found = false;
+                break;
+            }
+        }
+
+        if (found) {
+            result.push_back(*candidate);
+            ++candidate;
+        }
+    }
+
+    return set_type(vectorset_sorted_unique, std::move(result), comp);
+}
+
+
+/**
+ * Union of many unique ordered vectorsets.
+ *
+ * The sets are merged in rounds like a tournament: each round merges
+ * pairs of runs, until one run is left. Only two buffers of the
+ * result size are used, no intermediate vectorsets are created. Every
+ * element is copied `log2(sets.size())` times by the linear two-way
+ * merge, whose branches are much better predicted than the ones of a
+ * heap.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param sets Vectorsets to unite (not null).
+ *
+ * @return Unique ordered container with the elements, which are
+ *         contained in any set (empty, if `sets` is empty).
+ */
+template<class T, class Compare, class Alloc, class Container>
+vectorset<T, Compare, Alloc, Container>
+set_union(
+    const std::vector<const vectorset<T, Compare, Alloc, Container>*>& sets)
+{
+    typedef vectorset<T, Compare, Alloc, Container> set_type;
+    typedef typename set_type::const_iterator const_iterator;
+    typedef std::pair<const_iterator, const_iterator> range_type;
+
+    _vectorset_check_unique_ordered(sets, "set_union");
+
+    if (sets.empty()) {
+        return set_type(vectorset_sorted_unique, Container());
+    }
+    if (sets.size() == 1) {
+        return *sets.front();
+    }
+    if (sets.size() == 2) {
+        return set_union(*sets[0], *sets[1]);
+    }
+
+    auto comp = sets.front()->key_comp();
+    std::vector<range_type> runs;
+    std::vector<size_t> runEnds;
+    size_t sumSize = 0;
+
+    runs.reserve(sets.size());
+    runEnds.reserve(sets.size());
+    for (auto set : sets) {
+        if (!set->empty()) {
+            runs.push_back(range_type(set->begin(), set->end()));
+            sumSize += set->size();
+        }
+    }
+
+    Container buffers[2] = {
+        Container(sets.front()->get_allocator()),
+        Container(sets.front()->get_allocator())
+    };
+    size_t out = 0;
+
+    if (runs.size() <= 1) {
+        // only the sets of one run are not empty
+        for (const auto &run : runs) {
+            buffers[out].insert(buffers[out].end(), run.first, run.second);
+        }
+        return set_type(
+            vectorset_sorted_unique, std::move(buffers[out]), comp);
+    }
+
+    buffers[0].reserve(sumSize);
+    buffers[1].reserve(sumSize);
+
+    while (runs.size() > 1) {
+        auto &buffer = buffers[out];
+
+        buffer.clear();
+        runEnds.clear();
+
+        for (size_t idx = 0; idx < runs.size(); idx += 2) {
+            if (idx + 1 < runs.size()) {
+                vectorset_algo::merge_parts<
+                    vectorset_algo::only_first | vectorset_algo::only_second
+                    | vectorset_algo::both>(
+                        runs[idx].first, runs[idx].second,
+                        runs[idx + 1].first, runs[idx + 1].second,
+                        std::back_inserter(buffer), comp);
+            }
+            else {
+                buffer.insert(
+                    buffer.end(), runs[idx].first, runs[idx].second);
+            }
+            runEnds.push_back(buffer.size());
+        }
+
+        runs.clear();
+
+        size_t runBegin = 0;
+        for (auto runEnd : runEnds) {
+            runs.push_back(
+                range_type(
+                    buffer.cbegin() + runBegin, buffer.cbegin() + runEnd));
+            runBegin = runEnd;
+        }
+
+        out = 1 - out;
+    }
+
+    return set_type(
+        vectorset_sorted_unique, std::move(buffers[1 - out]), comp);
+}
+
+#endif /* VECTOR_SET_ALGO_H */
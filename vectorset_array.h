@@ -0,0 +1,847 @@
+//
+// Packed array of unique ordered sets.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Many small unique ordered sets in one contiguous buffer (CSR layout).
+
+#ifndef VECTOR_SET_ARRAY_H
+#define VECTOR_SET_ARRAY_H
+
+#include "vectorset_parallel.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+/**
+ * An array of unique ordered sets stored back to back.
+ *
+ * The keys of all sets are stored in one contiguous buffer, the set
+ * `idx` is the range `[offsets[idx], offsets[idx + 1])` of the buffer
+ * (compressed sparse row layout). Each set costs one offset instead
+ * of a `vectorset` header and a heap allocation, e.g. for the
+ * adjacency lists of a graph.
+ *
+ * The sets are read only. `operator[]` returns a `set_ref` with the
+ * lookup interface of an unique ordered `vectorset`. New sets are
+ * appended by `push_back()`; many sets are filled in any order by a
+ * `builder`, which sorts and deduplicates all sets at once (in
+ * parallel).
+ *
+ * @tparam Key Type of the keys.
+ * @tparam Compare Compare function of the keys.
+ * @tparam Allocator Allocator of the key buffer (rebound for offsets).
+ */
+template<
+    class Key,
+    class Compare = std::less<Key>,
+    class Allocator = std::allocator<Key>
+    >
+class vectorset_array {
+public:
+
+    using key_type = Key;
+    using value_type = Key;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare = Compare;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+    using key_vector = std::vector<Key, Allocator>;
+    using offset_vector =
+        std::vector<
+            size_type,
+            typename std::allocator_traits<Allocator>::template
+                rebind_alloc<size_type>>;
+
+    /**
+     * Read only reference to one set of the array.
+     *
+     * The reference is invalidated by all modifications of the array.
+     */
+    class set_ref {
+    public:
+
+        using key_type = Key;
+        using value_type = Key;
+        using size_type = typename vectorset_array::size_type;
+        using difference_type = typename vectorset_array::difference_type;
+        using key_compare = Compare;
+        using const_reference = const Key&;
+        using const_iterator = const Key*;
+        using iterator = const_iterator;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+        using reverse_iterator = const_reverse_iterator;
+
+        set_ref() = default;
+
+        /// @name Iterators
+
+        /// @{
+
+        const_iterator
+        begin() const noexcept {
+            return first;
+        }
+
+        const_iterator
+        cbegin() const noexcept {
+            return first;
+        }
+
+        const_iterator
+        end() const noexcept {
+            return last;
+        }
+
+        const_iterator
+        cend() const noexcept {
+            return last;
+        }
+
+        const_reverse_iterator
+        rbegin() const noexcept {
+            return const_reverse_iterator(last);
+        }
+
+        const_reverse_iterator
+        rend() const noexcept {
+            return const_reverse_iterator(first);
+        }
+
+        /// @}
+
+        /// @name Element access
+
+        /// @{
+
+        /// Checks if the set has no elements.
+        bool
+        empty() const noexcept {
+            return (first == last);
+        }
+
+        /// Number of elements in the set.
+        size_type
+        size() const noexcept {
+            return static_cast<size_type>(last - first);
+        }
+
+        /// Access element.
+        const_reference
+        operator[](size_type pos) const {
+            return first[pos];
+        }
+
+        /// Access element with bounds checking.
+        const_reference
+        at(size_type pos) const {
+            if (pos >= size()) {
+                throw std::out_of_range("vectorset_array::set_ref::at");
+            }
+            return first[pos];
+        }
+
+        /// Access first element.
+        const_reference
+        front() const {
+            return *first;
+        }
+
+        /// Access last element.
+        const_reference
+        back() const {
+            return *(last - 1);
+        }
+
+        /// @}
+
+        /// @name Lookup
+
+        /// @{
+
+        /// Iterator to the first element not less than `key`.
+        const_iterator
+        lower_bound(const Key& key) const {
+            return std::lower_bound(first, last, key, comp);
+        }
+
+        /// Iterator to the first element greater than `key`.
+        const_iterator
+        upper_bound(const Key& key) const {
+            return std::upper_bound(first, last, key, comp);
+        }
+
+        /// Range of elements equal to `key` (at most one).
+        std::pair<const_iterator, const_iterator>
+        equal_range(const Key& key) const {
+            auto iter = lower_bound(key);
+
+            if (iter != last && !comp(key, *iter)) {
+                return {iter, iter + 1};
+            }
+
+            return {iter, iter};
+        }
+
+        /// Find element equal to `key` (`end()` if not found).
+        const_iterator
+        find(const Key& key) const {
+            auto iter = lower_bound(key);
+
+            return ((iter != last && !comp(key, *iter)) ? iter : last);
+        }
+
+        /// Number of elements equal to `key` (0 or 1).
+        size_type
+        count(const Key& key) const {
+            return (find(key) != last ? 1 : 0);
+        }
+
+        /// Checks if the set contains `key`.
+        bool
+        contains(const Key& key) const {
+            return (find(key) != last);
+        }
+
+        /// @}
+
+        /// Get compare function of keys.
+        key_compare
+        key_comp() const {
+            return comp;
+        }
+
+    private:
+        friend class vectorset_array;
+
+        set_ref(const Key *first, const Key *last, const Compare &comp)
+            : first(first), last(last), comp(comp)
+        { /* empty */ }
+
+        const Key *first = nullptr;
+        const Key *last = nullptr;
+        Compare comp;
+    };
+
+    /**
+     * Random access iterator through the sets of the array.
+     *
+     * Dereferencing yields a `set_ref` by value (proxy iterator).
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = set_ref;
+        using difference_type = typename vectorset_array::difference_type;
+        using pointer = void;
+        using reference = set_ref;
+
+        const_iterator() = default;
+
+        reference
+        operator*() const {
+            return (*owner)[idx];
+        }
+
+        reference
+        operator[](difference_type offset) const {
+            return (*owner)[idx + offset];
+        }
+
+        const_iterator &
+        operator++() {
+            ++idx;
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            ++idx;
+            return result;
+        }
+
+        const_iterator &
+        operator--() {
+            --idx;
+            return *this;
+        }
+
+        const_iterator
+        operator--(int) {
+            auto result = *this;
+            --idx;
+            return result;
+        }
+
+        const_iterator &
+        operator+=(difference_type offset) {
+            idx += offset;
+            return *this;
+        }
+
+        const_iterator &
+        operator-=(difference_type offset) {
+            idx -= offset;
+            return *this;
+        }
+
+        const_iterator
+        operator+(difference_type offset) const {
+            return const_iterator(owner, idx + offset);
+        }
+
+        friend const_iterator
+        operator+(difference_type offset, const const_iterator &iter) {
+            return iter + offset;
+        }
+
+        const_iterator
+        operator-(difference_type offset) const {
+            return const_iterator(owner, idx - offset);
+        }
+
+        difference_type
+        operator-(const const_iterator &other) const {
+            return static_cast<difference_type>(idx - other.idx);
+        }
+
+        bool
+        operator==(const const_iterator &other) const {
+            return (idx == other.idx);
+        }
+
+        bool
+        operator!=(const const_iterator &other) const {
+            return (idx != other.idx);
+        }
+
+        bool
+        operator<(const const_iterator &other) const {
+            return (idx < other.idx);
+        }
+
+        bool
+        operator<=(const const_iterator &other) const {
+            return (idx <= other.idx);
+        }
+
+        bool
+        operator>(const const_iterator &other) const {
+            return (idx > other.idx);
+        }
+
+        bool
+        operator>=(const const_iterator &other) const {
+            return (idx >= other.idx);
+        }
+
+    private:
+        friend class vectorset_array;
+
+        const_iterator(const vectorset_array *owner, size_type idx)
+            : owner(owner), idx(idx)
+        { /* empty */ }
+
+        const vectorset_array *owner = nullptr;
+        size_type idx = 0;
+    };
+
+    using iterator = const_iterator;
+
+    class builder;
+
+    /// @name Constructors
+
+    /// @{
+
+    /// Default constructor (no sets).
+    vectorset_array() : vectorset_array(Compare()) {
+        /* empty */
+    }
+
+    /**
+     * Constructor (comparator / allocator).
+     *
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations
+     *              of this container.
+     */
+    explicit
+    vectorset_array(
+        const Compare& comp, const Allocator& alloc = Allocator())
+        : keys(alloc),
+          offsets(1, 0, typename offset_vector::allocator_type(alloc)),
+          comp(comp)
+    {
+        /* empty */
+    }
+
+    /// @}
+
+    /// @name Sets
+
+    /// @{
+
+    /// Checks if the array has no sets.
+    bool
+    empty() const noexcept {
+        return (offsets.size() == 1);
+    }
+
+    /// Number of sets.
+    size_type
+    size() const noexcept {
+        return offsets.size() - 1;
+    }
+
+    /// Number of keys of all sets.
+    size_type
+    total_size() const noexcept {
+        return keys.size();
+    }
+
+    /// Access set `idx`.
+    set_ref
+    operator[](size_type idx) const {
+        return set_ref(
+            keys.data() + offsets[idx], keys.data() + offsets[idx + 1], comp);
+    }
+
+    /// Access set `idx` with bounds checking.
+    set_ref
+    at(size_type idx) const {
+        if (idx >= size()) {
+            throw std::out_of_range("vectorset_array::at");
+        }
+        return (*this)[idx];
+    }
+
+    const_iterator
+    begin() const noexcept {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator
+    cbegin() const noexcept {
+        return begin();
+    }
+
+    const_iterator
+    end() const noexcept {
+        return const_iterator(this, size());
+    }
+
+    const_iterator
+    cend() const noexcept {
+        return end();
+    }
+
+    /// @}
+
+    /// @name Modifiers
+
+    /// @{
+
+    /**
+     * Append a set with the keys of range [first, last).
+     *
+     * The keys are sorted and duplicates are removed.
+     *
+     * @param first Input iterator to the first key.
+     * @param last Input iterator after the last key.
+     */
+    template<class InputIt>
+    void
+    push_back(InputIt first, InputIt last) {
+        auto setBegin = offsets.back();
+
+        try {
+            keys.insert(keys.end(), first, last);
+            offsets.reserve(offsets.size() + 1);
+        }
+        catch (...) {
+            keys.erase(std::next(keys.begin(), setBegin), keys.end());
+            throw;
+        }
+
+        auto count =
+            sort_unique(keys.data() + setBegin, keys.size() - setBegin);
+
+        keys.erase(std::next(keys.begin(), setBegin + count), keys.end());
+        offsets.push_back(setBegin + count);
+    }
+
+    /// Append a set with the keys of an initializer list.
+    void
+    push_back(std::initializer_list<Key> ilist) {
+        push_back(ilist.begin(), ilist.end());
+    }
+
+    /// Remove all sets.
+    void
+    clear() noexcept {
+        keys.clear();
+        offsets.resize(1);
+    }
+
+    /// Reserve storage for `sets` sets with `total` keys.
+    void
+    reserve(size_type sets, size_type total) {
+        offsets.reserve(sets + 1);
+        keys.reserve(total);
+    }
+
+    /// Reduce memory usage.
+    void
+    shrink_to_fit() {
+        keys.shrink_to_fit();
+        offsets.shrink_to_fit();
+    }
+
+    /// Exchange content with `other`.
+    void
+    swap(vectorset_array &other) noexcept {
+        using std::swap;
+
+        keys.swap(other.keys);
+        offsets.swap(other.offsets);
+        swap(comp, other.comp);
+    }
+
+    /// @}
+
+    /// @name Observers
+
+    /// @{
+
+    /// Buffer with the keys of all sets.
+    const key_vector &
+    get_keys() const noexcept {
+        return keys;
+    }
+
+    /// Offsets of the sets in the key buffer (`size() + 1` entries).
+    const offset_vector &
+    get_offsets() const noexcept {
+        return offsets;
+    }
+
+    /// Get compare function of keys.
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+    /// Get allocator of the key buffer.
+    allocator_type
+    get_allocator() const noexcept {
+        return keys.get_allocator();
+    }
+
+    /// @}
+
+private:
+    /// Keys of all sets.
+    key_vector keys;
+
+    /// Begin of each set in `keys` (and end of the last set).
+    offset_vector offsets;
+
+    /// compare method
+    VSET_no_unique_address Compare comp;
+
+    /**
+     * Sort keys and move unique keys to the front.
+     *
+     * @param first Begin of the keys.
+     * @param count Number of keys.
+     *
+     * @return Number of unique keys.
+     */
+    size_type
+    sort_unique(Key *first, size_type count) const {
+        auto last = first + count;
+        auto &less = comp;
+
+        std::sort(first, last, less);
+
+        return static_cast<size_type>(
+            std::unique(
+                first, last,
+                [&less](const Key& lhs, const Key& rhs) {
+                    return !less(lhs, rhs);
+                })
+            - first);
+    }
+};
+
+
+/**
+ * Builder of a `vectorset_array`.
+ *
+ * Keys are added to the sets in any order and with duplicates
+ * (like the unordered mode of `vectorset`). `build()` distributes
+ * them into the key buffer (counting sort by set) and sorts and
+ * deduplicates all sets with one parallel pass over groups of
+ * consecutive sets.
+ */
+template<class Key, class Compare, class Allocator>
+class vectorset_array<Key, Compare, Allocator>::builder {
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param sets Initial number of sets.
+     * @param comp Comparison function object to use for all
+     *             comparisons of keys.
+     * @param alloc Allocator to use for all memory allocations.
+     */
+    explicit
+    builder(
+        size_type sets = 0,
+        const Compare& comp = Compare(),
+        const Allocator& alloc = Allocator())
+        : keys(alloc),
+          setIdx(typename offset_vector::allocator_type(alloc)),
+          sets(sets),
+          comp(comp)
+    {
+        /* empty */
+    }
+
+    /// Number of sets.
+    size_type
+    size() const noexcept {
+        return sets;
+    }
+
+    /// Number of added keys (with duplicates).
+    size_type
+    total_size() const noexcept {
+        return keys.size();
+    }
+
+    /// Change number of sets (keys of removed sets are dropped).
+    void
+    resize(size_type count) {
+        if (count < sets) {
+            size_type dest = 0;
+
+            for (size_type pos = 0; pos < keys.size(); ++pos) {
+                if (setIdx[pos] < count) {
+                    if (dest != pos) {
+                        keys[dest] = std::move(keys[pos]);
+                        setIdx[dest] = setIdx[pos];
+                    }
+                    ++dest;
+                }
+            }
+            keys.erase(std::next(keys.begin(), dest), keys.end());
+            setIdx.resize(dest);
+        }
+        sets = count;
+    }
+
+    /// Reserve storage for `count` keys.
+    void
+    reserve(size_type count) {
+        keys.reserve(count);
+        setIdx.reserve(count);
+    }
+
+    /**
+     * Add key to a set.
+     *
+     * @param set Index of the set (the number of sets grows, if
+     *            necessary).
+     * @param key Key to add.
+     */
+    void
+    insert(size_type set, const Key& key) {
+        emplace(set, key);
+    }
+
+    /// Add key (move) to a set.
+    void
+    insert(size_type set, Key&& key) {
+        emplace(set, std::move(key));
+    }
+
+    /// Construct key in-place and add it to a set.
+    template<class... Args>
+    void
+    emplace(size_type set, Args&&... args) {
+        setIdx.reserve(setIdx.size() + 1);
+        keys.emplace_back(std::forward<Args>(args)...);
+        setIdx.push_back(set);
+        sets = std::max(sets, set + 1);
+    }
+
+    /**
+     * Build the array.
+     *
+     * The builder is empty afterwards.
+     *
+     * @param threads Number of threads (0: number of hardware
+     *                threads). Small inputs are built by the calling
+     *                thread.
+     *
+     * @return Array with the sorted and deduplicated sets.
+     */
+    vectorset_array
+    build(unsigned threads = 0) {
+        vectorset_array result(comp, keys.get_allocator());
+        auto total = keys.size();
+
+        // counting sort by set
+        auto &offsets = result.offsets;
+
+        offsets.assign(sets + 1, 0);
+        for (auto set : setIdx) {
+            ++offsets[set + 1];
+        }
+        for (size_type set = 0; set < sets; ++set) {
+            offsets[set + 1] += offsets[set];
+        }
+
+        {
+            offset_vector order(total, 0, setIdx.get_allocator());
+            offset_vector next(
+                offsets.begin(), offsets.end() - 1, setIdx.get_allocator());
+
+            for (size_type pos = 0; pos < total; ++pos) {
+                order[next[setIdx[pos]]++] = pos;
+            }
+
+            offset_vector().swap(setIdx);
+
+            result.keys.reserve(total);
+            for (auto pos : order) {
+                result.keys.push_back(std::move(keys[pos]));
+            }
+
+            key_vector(keys.get_allocator()).swap(keys);
+        }
+
+        sort_unique_sets(result, threads);
+        sets = 0;
+
+        return result;
+    }
+
+private:
+    key_vector keys;            ///< Added keys.
+    offset_vector setIdx;       ///< Set of each added key.
+    size_type sets;             ///< Number of sets.
+    Compare comp;               ///< Compare function of keys.
+
+    /**
+     * Sort and deduplicate all sets of `array` (in parallel).
+     *
+     * The sets are split into groups of consecutive sets with about
+     * the same number of keys. Each thread sorts the sets of one
+     * group and compacts them to the begin of the group. At the end,
+     * the groups are moved together.
+     */
+    static void
+    sort_unique_sets(vectorset_array &array, unsigned threads) {
+        auto &offsets = array.offsets;
+        auto &keys = array.keys;
+        auto sets = array.size();
+        auto parts = vectorset_parallel::thread_count(keys.size(), threads);
+
+        // first set of each group
+        std::vector<size_type> groups(parts + 1, sets);
+        groups[0] = 0;
+        for (unsigned part = 1; part < parts; ++part) {
+            groups[part] = static_cast<size_type>(
+                std::lower_bound(
+                    offsets.begin(), offsets.end() - 1,
+                    keys.size() / parts * part)
+                - offsets.begin());
+        }
+
+        offset_vector uniqueCount(sets, 0, offsets.get_allocator());
+        std::vector<size_type> groupEnd(parts, 0);
+
+        vectorset_parallel::run(
+            parts,
+            [&](unsigned part) {
+                auto dest = offsets[groups[part]];
+
+                for (auto set = groups[part]; set < groups[part + 1]; ++set) {
+                    auto first = keys.data() + offsets[set];
+                    auto count = array.sort_unique(
+                        first, offsets[set + 1] - offsets[set]);
+
+                    if (dest != offsets[set]) {
+                        std::move(first, first + count, keys.data() + dest);
+                    }
+                    dest += count;
+                    uniqueCount[set] = count;
+                }
+
+                groupEnd[part] = dest;
+            });
+
+        // move groups together
+        auto dest = groupEnd[0];
+
+        for (unsigned part = 1; part < parts; ++part) {
+            auto first = keys.data() + offsets[groups[part]];
+            auto last = keys.data() + groupEnd[part];
+
+            if (dest != offsets[groups[part]]) {
+                std::move(first, last, keys.data() + dest);
+            }
+            dest += static_cast<size_type>(last - first);
+        }
+        keys.erase(std::next(keys.begin(), dest), keys.end());
+
+        for (size_type set = 0; set < sets; ++set) {
+            offsets[set + 1] = offsets[set] + uniqueCount[set];
+        }
+    }
+};
+
+
+/// Exchange content of two `vectorset_array`.
+template<class Key, class Compare, class Allocator>
+inline void
+swap(
+    vectorset_array<Key, Compare, Allocator>& lhs,
+    vectorset_array<Key, Compare, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+#endif /* VECTOR_SET_ARRAY_H */
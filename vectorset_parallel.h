@@ -0,0 +1,543 @@
+//
+// Set algebra on unique ordered vectorsets.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Parallel set algebra on unique ordered vectorsets.
+
+#ifndef VECTOR_SET_PARALLEL_H
+#define VECTOR_SET_PARALLEL_H
+
+#include "vectorset_algo.h"
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/**
+ * Helpers of the parallel set algebra.
+ *
+ * Both inputs are split by splitter keys into independent key ranges
+ * (slices). Each thread merges one slice into its own preallocated
+ * part of the output. At the end the parts are compacted.
+ */
+namespace vectorset_parallel {
+
+    /// Minimal number of input elements per thread.
+    constexpr size_t min_slice_size = size_t(1) << 16;
+
+
+    /// Key range of both inputs and its part of the output.
+    struct slice {
+        size_t lhsBegin;
+        size_t lhsEnd;
+        size_t rhsBegin;
+        size_t rhsEnd;
+        size_t outBegin;
+        size_t outEnd;
+    };
+
+
+    /**
+     * Get number of threads to use.
+     *
+     * @param elements Number of input elements.
+     * @param threads Requested number of threads (0: number of
+     *                hardware threads).
+     *
+     * @return Number of threads (at least 1).
+     */
+    inline unsigned
+    thread_count(size_t elements, unsigned threads) {
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        return static_cast<unsigned>(
+            std::min<size_t>(
+                threads, std::max<size_t>(1, elements / min_slice_size)));
+    }
+
+
+    /**
+     * Split two sorted unique ranges into slices of independent keys.
+     *
+     * The splitter keys are taken at equal distances from the larger
+     * range, their positions in the smaller range are searched by
+     * `lower_bound`.
+     *
+     * @param lhs Begin of the first range.
+     * @param lhsSize Size of the first range.
+     * @param rhs Begin of the second range.
+     * @param rhsSize Size of the second range.
+     * @param comp Compare function of both ranges.
+     * @param count Number of slices.
+     *
+     * @return Slices (output part not set).
+     */
+    template<class RandomIt, class Compare>
+    std::vector<slice>
+    split(
+        RandomIt lhs, size_t lhsSize, RandomIt rhs, size_t rhsSize,
+        Compare comp, unsigned count)
+    {
+        bool lhsLarger = lhsSize >= rhsSize;
+        auto larger = lhsLarger ? lhs : rhs;
+        auto largerSize = lhsLarger ? lhsSize : rhsSize;
+        auto smaller = lhsLarger ? rhs : lhs;
+        auto smallerSize = lhsLarger ? rhsSize : lhsSize;
+
+        std::vector<slice> result(count);
+        size_t largerPos = 0;
+        size_t smallerPos = 0;
+
+        for (unsigned idx = 0; idx < count; ++idx) {
+            auto &sl = result[idx];
+            size_t largerEnd = largerSize;
+            size_t smallerEnd = smallerSize;
+
+            if (idx + 1 < count) {
+                largerEnd = largerSize / count * (idx + 1);
+                smallerEnd =
+                    std::lower_bound(
+                        smaller + smallerPos, smaller + smallerSize,
+                        larger[largerEnd], comp)
+                    - smaller;
+            }
+
+            sl.lhsBegin = lhsLarger ? largerPos : smallerPos;
+            sl.lhsEnd = lhsLarger ? largerEnd : smallerEnd;
+            sl.rhsBegin = lhsLarger ? smallerPos : largerPos;
+            sl.rhsEnd = lhsLarger ? smallerEnd : largerEnd;
+            sl.outBegin = 0;
+            sl.outEnd = 0;
+
+            largerPos = largerEnd;
+            smallerPos = smallerEnd;
+        }
+
+        return result;
+    }
+
+
+    /**
+     * Call a function for each slice index in parallel.
+     *
+     * The first slice is processed by the calling thread. If a thread
+     * can not be started, its slice is processed by the calling
+     * thread. The first exception of a slice is rethrown after all
+     * threads are finished.
+     *
+     * @param count Number of slices.
+     * @param fn Function called with the slice index.
+     */
+    template<class Function>
+    void
+    run(unsigned count, Function fn)
+    {
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(count);
+
+        auto guarded =
+            [&fn, &errors](unsigned idx) {
+                try {
+                    fn(idx);
+                }
+                catch (...) {
+                    errors[idx] = std::current_exception();
+                }
+            };
+
+        threads.reserve(count);
+
+        unsigned idx = 1;
+        try {
+            for (; idx < count; ++idx) {
+                threads.emplace_back(guarded, idx);
+            }
+        }
+        catch (const std::system_error&) {
+            // no more threads: process the rest here
+        }
+
+        guarded(0);
+        for (; idx < count; ++idx) {
+            guarded(idx);
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        for (const auto &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+
+    /**
+     * Assign the output parts of the slices.
+     *
+     * @param slices Slices to update.
+     * @param bound Upper bound of the output size of a slice
+     *              (called with the sizes of both input parts).
+     *
+     * @return Sum of all output parts.
+     */
+    template<class Bound>
+    size_t
+    assign_output(std::vector<slice>& slices, Bound bound)
+    {
+        size_t outPos = 0;
+
+        for (auto &sl : slices) {
+            sl.outBegin = outPos;
+            outPos +=
+                bound(sl.lhsEnd - sl.lhsBegin, sl.rhsEnd - sl.rhsBegin);
+            sl.outEnd = sl.outBegin;
+        }
+
+        return outPos;
+    }
+
+
+    /**
+     * Compact the output parts of the slices to the front.
+     *
+     * @param out Output container.
+     * @param slices Slices with the used output parts.
+     */
+    template<class Container>
+    void
+    compact(Container& out, const std::vector<slice>& slices)
+    {
+        size_t outPos = 0;
+
+        for (const auto &sl : slices) {
+            if (sl.outBegin != outPos) {
+                std::move(
+                    out.begin() + sl.outBegin, out.begin() + sl.outEnd,
+                    out.begin() + outPos);
+            }
+            outPos += sl.outEnd - sl.outBegin;
+        }
+
+        out.erase(out.begin() + outPos, out.end());
+    }
+
+} // namespace vectorset_parallel
+
+
+/**
+ * Set operation on two unique ordered vectorsets (parallel).
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @tparam Parts Parts to copy to the result (`merge_part` mask).
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param threads Number of threads (0: number of hardware threads).
+ * @param name Name of the operation (error message).
+ *
+ * @return Unique ordered result.
+ */
+template<
+    unsigned Parts, class T, class Compare, class Alloc, class Container>
+vectorset<T, Compare, Alloc, Container>
+_vectorset_parallel_set_operation(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    unsigned threads,
+    const char *name)
+{
+    _vectorset_check_unique_ordered(lhs, rhs, name);
+
+    auto count =
+        vectorset_parallel::thread_count(lhs.size() + rhs.size(), threads);
+
+    if (count == 1) {
+        return _vectorset_set_operation<Parts>(lhs, rhs, name);
+    }
+
+    auto comp = lhs.key_comp();
+    auto slices =
+        vectorset_parallel::split(
+            lhs.begin(), lhs.size(), rhs.begin(), rhs.size(), comp, count);
+
+    auto outSize =
+        vectorset_parallel::assign_output(
+            slices,
+            [](size_t lhsSize, size_t rhsSize) {
+                return (
+                    Parts == vectorset_algo::both
+                    ? std::min(lhsSize, rhsSize)
+                    : ((Parts & vectorset_algo::only_first ? lhsSize : 0)
+                       + (Parts & vectorset_algo::only_second ? rhsSize : 0)));
+            });
+
+    Container result(lhs.get_allocator());
+
+    result.resize(outSize);
+
+    vectorset_parallel::run(
+        count,
+        [&](unsigned idx) {
+            auto &sl = slices[idx];
+            auto out =
+                vectorset_algo::merge_parts<Parts>(
+                    lhs.begin() + sl.lhsBegin, lhs.begin() + sl.lhsEnd,
+                    rhs.begin() + sl.rhsBegin, rhs.begin() + sl.rhsEnd,
+                    result.begin() + sl.outBegin, comp);
+
+            sl.outEnd = out - result.begin();
+        });
+
+    vectorset_parallel::compact(result, slices);
+
+    return vectorset<T, Compare, Alloc, Container>(
+        vectorset_sorted_unique, std::move(result), comp);
+}
+
+
+/**
+ * Union of two unique ordered vectorsets (parallel).
+ *
+ * The key type has to be default constructible.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param threads Number of threads (0: number of hardware threads).
+ *
+ * @return Unique ordered container with the elements of both sides.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+parallel_set_union(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    unsigned threads = 0)
+{
+    return _vectorset_parallel_set_operation<
+        vectorset_algo::only_first | vectorset_algo::only_second
+        | vectorset_algo::both>(
+            lhs, rhs, threads, "parallel_set_union");
+}
+
+/**
+ * Intersection of two unique ordered vectorsets (parallel).
+ *
+ * The key type has to be default constructible.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param threads Number of threads (0: number of hardware threads).
+ *
+ * @return Unique ordered container with the elements of `lhs`, which
+ *         are contained in `rhs`.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+parallel_set_intersection(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    unsigned threads = 0)
+{
+    return _vectorset_parallel_set_operation<vectorset_algo::both>(
+        lhs, rhs, threads, "parallel_set_intersection");
+}
+
+/**
+ * Difference of two unique ordered vectorsets (parallel).
+ *
+ * The key type has to be default constructible.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param threads Number of threads (0: number of hardware threads).
+ *
+ * @return Unique ordered container with the elements of `lhs`, which
+ *         are not contained in `rhs`.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+parallel_set_difference(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    unsigned threads = 0)
+{
+    return _vectorset_parallel_set_operation<vectorset_algo::only_first>(
+        lhs, rhs, threads, "parallel_set_difference");
+}
+
+/**
+ * Symmetric difference of two unique ordered vectorsets (parallel).
+ *
+ * The key type has to be default constructible.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param lhs Left hand side.
+ * @param rhs Right hand side.
+ * @param threads Number of threads (0: number of hardware threads).
+ *
+ * @return Unique ordered container with the elements, which are
+ *         contained in only one of both sides.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline vectorset<T, Compare, Alloc, Container>
+parallel_set_symmetric_difference(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs,
+    unsigned threads = 0)
+{
+    return _vectorset_parallel_set_operation<
+        vectorset_algo::only_first | vectorset_algo::only_second>(
+            lhs, rhs, threads, "parallel_set_symmetric_difference");
+}
+
+
+/**
+ * Merge the elements of `source` into `target` (parallel).
+ *
+ * Like `vectorset::merge()`: all elements of `source`, which are not
+ * contained in `target`, are moved to `target`. The other elements
+ * stay in `source`. The key type has to be default constructible.
+ *
+ * If an exception is thrown, both containers are cleared.
+ *
+ * @throws std::logic_error One of the containers is not in mode
+ *                          `vectorset_mode::unique_ordered`.
+ *
+ * @param target Container to merge into.
+ * @param source Container to merge from.
+ * @param threads Number of threads (0: number of hardware threads).
+ */
+template<class T, class Compare, class Alloc, class Container>
+void
+parallel_merge(
+    vectorset<T, Compare, Alloc, Container>& target,
+    vectorset<T, Compare, Alloc, Container>& source,
+    unsigned threads = 0)
+{
+    typedef vectorset<T, Compare, Alloc, Container> set_type;
+
+    _vectorset_check_unique_ordered(target, source, "parallel_merge");
+
+    auto count =
+        vectorset_parallel::thread_count(
+            target.size() + source.size(), threads);
+
+    if (count == 1 || &target == &source) {
+        target.merge(source);
+        return;
+    }
+
+    auto comp = target.key_comp();
+    auto slices =
+        vectorset_parallel::split(
+            target.begin(), target.size(), source.begin(), source.size(),
+            comp, count);
+
+    // output parts of the remaining source elements
+    auto remainSlices = slices;
+
+    auto targetSize =
+        vectorset_parallel::assign_output(
+            slices,
+            [](size_t lhsSize, size_t rhsSize) { return lhsSize + rhsSize; });
+    auto remainSize =
+        vectorset_parallel::assign_output(
+            remainSlices,
+            [](size_t, size_t rhsSize) { return rhsSize; });
+
+    try {
+        Container merged(target.get_allocator());
+        Container remain(source.get_allocator());
+
+        merged.resize(targetSize);
+        remain.resize(remainSize);
+
+        vectorset_parallel::run(
+            count,
+            [&](unsigned idx) {
+                auto &sl = slices[idx];
+                auto first1 = target.begin() + sl.lhsBegin;
+                auto last1 = target.begin() + sl.lhsEnd;
+                auto first2 = source.begin() + sl.rhsBegin;
+                auto last2 = source.begin() + sl.rhsEnd;
+                auto out = merged.begin() + sl.outBegin;
+                auto remainOut = remain.begin() + remainSlices[idx].outBegin;
+
+                while (first1 != last1 && first2 != last2) {
+                    if (comp(*first1, *first2)) {
+                        *out++ = std::move(*first1++);
+                    }
+                    else if (comp(*first2, *first1)) {
+                        *out++ = std::move(*first2++);
+                    }
+                    else {
+                        *out++ = std::move(*first1++);
+                        *remainOut++ = std::move(*first2++);
+                    }
+                }
+
+                out = std::move(first1, last1, out);
+                out = std::move(first2, last2, out);
+
+                sl.outEnd = out - merged.begin();
+                remainSlices[idx].outEnd = remainOut - remain.begin();
+            });
+
+        vectorset_parallel::compact(merged, slices);
+        vectorset_parallel::compact(remain, remainSlices);
+
+        target = set_type(vectorset_sorted_unique, std::move(merged), comp);
+        source = set_type(vectorset_sorted_unique, std::move(remain), comp);
+    }
+    catch (...) {
+        target.clear();
+        source.clear();
+        throw;
+    }
+}
+
+#endif /* VECTOR_SET_PARALLEL_H */
@@ -0,0 +1,545 @@
+//
+// Set algebra on unique ordered vectorsets.
+//
+// Copyright (c) 2022 kla-sch@gmx.de
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the “Software”), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Lazy set operation views on unique ordered vectorsets.
+
+#ifndef VECTOR_SET_VIEW_H
+#define VECTOR_SET_VIEW_H
+
+#include "vectorset.h"
+
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L // c++20
+#   include <ranges>
+#endif
+
+
+/// Set operation of a `vectorset_view`.
+enum class vectorset_view_op {
+    /// Elements contained in any set.
+    set_union,
+
+    /// Elements contained in all sets.
+    set_intersection,
+
+    /// Elements of the first set, which are not contained in the others.
+    set_difference
+};
+
+
+/**
+ * Lazy set operation on unique ordered vectorsets.
+ *
+ * The elements of the result are computed while iterating, nothing
+ * is materialized. The viewed sets must not be changed or destroyed
+ * while the view or its iterators are used. The iterators don't refer
+ * to the view, they stay valid after the view is destroyed (e.g.
+ * iterators of a temporary view).
+ *
+ * `lower_bound()` and `const_iterator::seek()` move forward by
+ * galloping on all input sets.
+ *
+ * @tparam Set Type of the viewed vectorsets.
+ * @tparam Op Set operation.
+ */
+template<class Set, vectorset_view_op Op>
+class vectorset_view {
+public:
+
+    using set_type = Set;
+    using key_type = typename Set::key_type;
+    using value_type = typename Set::value_type;
+    using size_type = typename Set::size_type;
+    using difference_type = typename Set::difference_type;
+    using key_compare = typename Set::key_compare;
+    using const_reference = typename Set::const_reference;
+
+    /**
+     * Forward iterator through the result of the set operation.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename Set::value_type;
+        using difference_type = typename Set::difference_type;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference
+        operator*() const {
+            return *current;
+        }
+
+        pointer
+        operator->() const {
+            return &*current;
+        }
+
+        const_iterator&
+        operator++() {
+            increment(op_tag());
+            return *this;
+        }
+
+        const_iterator
+        operator++(int) {
+            auto result = *this;
+            increment(op_tag());
+            return result;
+        }
+
+        /**
+         * Move forward to the first element not less than `key`.
+         *
+         * The iterator never moves backward.
+         *
+         * @param key Key to seek.
+         */
+        void
+        seek(const key_type& key) {
+            if (!ended) {
+                seek(key, op_tag());
+            }
+        }
+
+        friend bool
+        operator==(const const_iterator& lhs, const const_iterator& rhs) {
+            return lhs.equal(rhs);
+        }
+
+        friend bool
+        operator!=(const const_iterator& lhs, const const_iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        friend class vectorset_view;
+
+        using set_iterator = typename Set::const_iterator;
+        using op_tag = std::integral_constant<vectorset_view_op, Op>;
+        using union_tag =
+            std::integral_constant<
+                vectorset_view_op, vectorset_view_op::set_union>;
+        using intersection_tag =
+            std::integral_constant<
+                vectorset_view_op, vectorset_view_op::set_intersection>;
+        using difference_tag =
+            std::integral_constant<
+                vectorset_view_op, vectorset_view_op::set_difference>;
+
+        /**
+         * Create iterator at the first element of the result.
+         *
+         * The end iterators of the sets and the compare function are
+         * copied, the iterator does not refer to the view.
+         *
+         * @param view View to iterate.
+         */
+        explicit
+        const_iterator(const vectorset_view &view)
+            : comp(view.comp)
+        {
+            cursors.reserve(view.sets.size());
+            ends.reserve(view.sets.size());
+            for (auto set : view.sets) {
+                cursors.push_back(set->begin());
+                ends.push_back(set->end());
+            }
+
+            ended = cursors.empty();
+            if (!ended) {
+                settle(op_tag());
+            }
+        }
+
+        // positions are equal, if the elements are equal (unique result)
+        bool
+        equal(const const_iterator& other) const {
+            return (
+                ended == other.ended
+                && (ended
+                    || (!comp(*current, *other.current)
+                        && !comp(*other.current, *current))));
+        }
+
+        bool
+        exhausted(size_t idx) const {
+            return cursors[idx] == ends[idx];
+        }
+
+        void
+        gallop(size_t idx, const key_type& key) {
+            cursors[idx] =
+                _vectorset_gallop_lower_bound(
+                    cursors[idx], ends[idx], key, comp);
+        }
+
+        // union: smallest element of all cursors
+
+        void
+        settle(union_tag) {
+            ended = true;
+            for (size_t idx = 0; idx < cursors.size(); ++idx) {
+                if (!exhausted(idx)
+                    && (ended || comp(*cursors[idx], *current)))
+                {
+                    current = cursors[idx];
+                    ended = false;
+                }
+            }
+        }
+
+        void
+        increment(union_tag) {
+            const auto &value = *current;
+
+            for (size_t idx = 0; idx < cursors.size(); ++idx) {
+                if (!exhausted(idx) && !comp(value, *cursors[idx])) {
+                    ++cursors[idx];
+                }
+            }
+            settle(union_tag());
+        }
+
+        void
+        seek(const key_type& key, union_tag) {
+            for (size_t idx = 0; idx < cursors.size(); ++idx) {
+                gallop(idx, key);
+            }
+            settle(union_tag());
+        }
+
+        // intersection: leapfrog until all cursors agree
+
+        void
+        settle(intersection_tag) {
+            if (exhausted(0)) {
+                ended = true;
+                return;
+            }
+
+            auto candidate = cursors[0];
+            size_t agree = 1;
+            size_t idx = 0;
+
+            while (agree < cursors.size()) {
+                idx = (idx + 1) % cursors.size();
+                gallop(idx, *candidate);
+
+                if (exhausted(idx)) {
+                    ended = true;
+                    return;
+                }
+
+                if (comp(*candidate, *cursors[idx])) {
+                    candidate = cursors[idx];
+                    agree = 1;
+                }
+                else {
+                    ++agree;
+                }
+            }
+
+            current = cursors[0];
+        }
+
+        void
+        increment(intersection_tag) {
+            for (auto &cursor : cursors) {
+                ++cursor;
+            }
+            settle(intersection_tag());
+        }
+
+        void
+        seek(const key_type& key, intersection_tag) {
+            gallop(0, key);
+            settle(intersection_tag());
+        }
+
+        // difference: first cursor, skipping elements of the others
+
+        void
+        settle(difference_tag) {
+            while (!exhausted(0)) {
+                bool contained = false;
+
+                for (size_t idx = 1; idx < cursors.size(); ++idx) {
+                    gallop(idx, *cursors[0]);
+
+                    if (!exhausted(idx)
+                        && !comp(*cursors[0], *cursors[idx]))
+                    {
+                        contained = true;
+                        break;
+                    }
+                }
+
+                if (!contained) {
+                    current = cursors[0];
+                    return;
+                }
+
+                ++cursors[0];
+            }
+
+            ended = true;
+        }
+
+        void
+        increment(difference_tag) {
+            ++cursors[0];
+            settle(difference_tag());
+        }
+
+        void
+        seek(const key_type& key, difference_tag) {
+            gallop(0, key);
+            settle(difference_tag());
+        }
+
+        key_compare comp = key_compare();
+        std::vector<set_iterator> cursors;
+        std::vector<set_iterator> ends;
+        set_iterator current{};
+        bool ended = true;
+    };
+
+    using iterator = const_iterator;
+
+
+    vectorset_view() = default;
+
+    /**
+     * Create view on two sets.
+     *
+     * @throws std::logic_error One of the containers is not in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param lhs First set.
+     * @param rhs Second set.
+     */
+    vectorset_view(const Set& lhs, const Set& rhs)
+        : vectorset_view(std::vector<const Set*>{ &lhs, &rhs })
+    {}
+
+    /**
+     * Create view on many sets.
+     *
+     * @throws std::logic_error One of the containers is not in mode
+     *                          `vectorset_mode::unique_ordered`.
+     *
+     * @param sets Sets to view (not null). For a difference the
+     *             elements of the others are removed from the first
+     *             set.
+     */
+    explicit
+    vectorset_view(std::vector<const Set*> sets)
+        : sets(std::move(sets))
+    {
+        for (auto set : this->sets) {
+            if (set->get_mode() != vectorset_mode::unique_ordered) {
+                throw std::logic_error(
+                    "vectorset_view is only available in "
+                    "vectorset_mode::unique_ordered");
+            }
+        }
+
+        if (!this->sets.empty()) {
+            comp = this->sets.front()->key_comp();
+        }
+    }
+
+
+    /**
+     * Get iterator to the first element of the result.
+     */
+    const_iterator
+    begin() const {
+        return const_iterator(*this);
+    }
+
+    /**
+     * Get iterator past the last element of the result.
+     */
+    const_iterator
+    end() const {
+        return const_iterator();
+    }
+
+    /**
+     * Get iterator to the first element not less than `key`.
+     *
+     * @param key Key to search.
+     */
+    const_iterator
+    lower_bound(const key_type& key) const {
+        auto result = begin();
+        result.seek(key);
+        return result;
+    }
+
+    /**
+     * Check, if the result is empty.
+     */
+    bool
+    empty() const {
+        return begin() == end();
+    }
+
+    /**
+     * Get the viewed sets.
+     */
+    const std::vector<const Set*>&
+    get_sets() const noexcept {
+        return sets;
+    }
+
+    /**
+     * Get the compare function.
+     */
+    key_compare
+    key_comp() const {
+        return comp;
+    }
+
+private:
+    std::vector<const Set*> sets;
+    key_compare comp = key_compare();
+};
+
+
+/// Lazy union of unique ordered vectorsets.
+template<class Set>
+using union_view = vectorset_view<Set, vectorset_view_op::set_union>;
+
+/// Lazy intersection of unique ordered vectorsets.
+template<class Set>
+using intersection_view =
+    vectorset_view<Set, vectorset_view_op::set_intersection>;
+
+/// Lazy difference of unique ordered vectorsets.
+template<class Set>
+using difference_view =
+    vectorset_view<Set, vectorset_view_op::set_difference>;
+
+
+/**
+ * Create lazy union of two unique ordered vectorsets.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline union_view<vectorset<T, Compare, Alloc, Container>>
+make_union_view(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return union_view<vectorset<T, Compare, Alloc, Container>>(lhs, rhs);
+}
+
+/**
+ * Create lazy union of many unique ordered vectorsets.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline union_view<vectorset<T, Compare, Alloc, Container>>
+make_union_view(
+    std::vector<const vectorset<T, Compare, Alloc, Container>*> sets)
+{
+    return union_view<vectorset<T, Compare, Alloc, Container>>(
+        std::move(sets));
+}
+
+/**
+ * Create lazy intersection of two unique ordered vectorsets.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline intersection_view<vectorset<T, Compare, Alloc, Container>>
+make_intersection_view(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return intersection_view<vectorset<T, Compare, Alloc, Container>>(
+        lhs, rhs);
+}
+
+/**
+ * Create lazy intersection of many unique ordered vectorsets.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline intersection_view<vectorset<T, Compare, Alloc, Container>>
+make_intersection_view(
+    std::vector<const vectorset<T, Compare, Alloc, Container>*> sets)
+{
+    return intersection_view<vectorset<T, Compare, Alloc, Container>>(
+        std::move(sets));
+}
+
+/**
+ * Create lazy difference of two unique ordered vectorsets.
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline difference_view<vectorset<T, Compare, Alloc, Container>>
+make_difference_view(
+    const vectorset<T, Compare, Alloc, Container>& lhs,
+    const vectorset<T, Compare, Alloc, Container>& rhs)
+{
+    return difference_view<vectorset<T, Compare, Alloc, Container>>(
+        lhs, rhs);
+}
+
+/**
+ * Create lazy difference of many unique ordered vectorsets (elements
+ * of the first set, which are not contained in any other).
+ */
+template<class T, class Compare, class Alloc, class Container>
+inline difference_view<vectorset<T, Compare, Alloc, Container>>
+make_difference_view(
+    std::vector<const vectorset<T, Compare, Alloc, Container>*> sets)
+{
+    return difference_view<vectorset<T, Compare, Alloc, Container>>(
+        std::move(sets));
+}
+
+
+#if __cplusplus >= 202002L // c++20
+
+namespace std {
+    namespace ranges {
+        /// Views are cheap to copy (C++20 ranges).
+        template<class Set, vectorset_view_op Op>
+        inline constexpr bool enable_view<vectorset_view<Set, Op>> = true;
+    } // namespace ranges
+} // namespace std
+
+#endif // c++20
+
+#endif /* VECTOR_SET_VIEW_H */